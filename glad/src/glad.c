@@ -7,16 +7,23 @@
     APIs: gl=3.3
     Profile: compatibility
     Extensions:
-        
+        GL_ARB_buffer_storage
+        GL_ARB_clip_control
+        GL_ARB_get_program_binary
+        GL_ARB_parallel_shader_compile
+        GL_ARB_texture_compression_bptc
+        GL_EXT_texture_compression_s3tc
+        GL_EXT_texture_sRGB
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_clip_control,GL_ARB_get_program_binary,GL_ARB_parallel_shader_compile,GL_ARB_texture_compression_bptc,GL_EXT_texture_compression_s3tc,GL_EXT_texture_sRGB,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_clip_control&extensions=GL_ARB_get_program_binary&extensions=GL_ARB_parallel_shader_compile&extensions=GL_ARB_texture_compression_bptc&extensions=GL_EXT_texture_compression_s3tc&extensions=GL_EXT_texture_sRGB&extensions=GL_KHR_parallel_shader_compile
 */
 
 #include <stdio.h>
@@ -165,96 +172,6 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
-
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
-
-        if (exts_i == NULL) {
-            return 0;
-        }
-
-        for(index = 0; index < num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
-
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
-    }
-#endif
-    return 1;
-}
-
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
-    }
-}
-
-static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
-        }
-    }
-#endif
-
-    return 0;
-}
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -267,6 +184,14 @@ int GLAD_GL_VERSION_3_0 = 0;
 int GLAD_GL_VERSION_3_1 = 0;
 int GLAD_GL_VERSION_3_2 = 0;
 int GLAD_GL_VERSION_3_3 = 0;
+int GLAD_GL_ARB_buffer_storage = 0;
+int GLAD_GL_ARB_get_program_binary = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+int GLAD_GL_ARB_parallel_shader_compile = 0;
+int GLAD_GL_EXT_texture_compression_s3tc = 0;
+int GLAD_GL_EXT_texture_sRGB = 0;
+int GLAD_GL_ARB_texture_compression_bptc = 0;
+int GLAD_GL_ARB_clip_control = 0;
 PFNGLACCUMPROC glad_glAccum = NULL;
 PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
 PFNGLALPHAFUNCPROC glad_glAlphaFunc = NULL;
@@ -991,6 +916,13 @@ PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = NULL;
 PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = NULL;
 PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = NULL;
 PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = NULL;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSARBPROC glad_glMaxShaderCompilerThreadsARB = NULL;
+PFNGLCLIPCONTROLPROC glad_glClipControl = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1754,10 +1686,1694 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+static void load_GL_ARB_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_ARB_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)load("glMaxShaderCompilerThreadsARB");
+}
+static void load_GL_ARB_clip_control(GLADloadproc load) {
+	if(!GLAD_GL_ARB_clip_control) return;
+	glad_glClipControl = (PFNGLCLIPCONTROLPROC)load("glClipControl");
+}
+/*
+ * Lazy loading: every pointer starts out as a trampoline that resolves the real function through
+ * the loader on its first call and patches itself in, so a context only pays for the lookups of
+ * the functions it actually calls. The loader is kept and must stay valid; proc addresses are the
+ * same for every context of a driver, which GLX and EGL guarantee. Two threads racing through a
+ * trampoline both store the same address.
+ */
+static GLADloadproc glad_lazy_load = NULL;
+static int glad_lazy_reset = 0;
+
+#define GLAD_LAZY(ret, name, pfn, params, args) \
+static ret APIENTRY glad_lazy_##name params { \
+    glad_##name = (pfn)glad_lazy_load(#name); \
+    return glad_##name args; \
+}
+#define GLAD_LAZY_VOID(name, pfn, params, args) \
+static void APIENTRY glad_lazy_##name params { \
+    glad_##name = (pfn)glad_lazy_load(#name); \
+    glad_##name args; \
+}
+/* pointers resolved through the same loader by an earlier load are kept */
+#define GLAD_LAZY_SET(name) \
+    if(glad_##name == NULL || glad_lazy_reset) glad_##name = glad_lazy_##name
+
+GLAD_LAZY_VOID(glCullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glFrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glHint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode))
+GLAD_LAZY_VOID(glLineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width))
+GLAD_LAZY_VOID(glPointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size))
+GLAD_LAZY_VOID(glPolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_LAZY_VOID(glScissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(glTexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_LAZY_VOID(glTexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_LAZY_VOID(glTexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+GLAD_LAZY_VOID(glTexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_LAZY_VOID(glDrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf))
+GLAD_LAZY_VOID(glClear, PFNGLCLEARPROC, (GLbitfield mask), (mask))
+GLAD_LAZY_VOID(glClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s))
+GLAD_LAZY_VOID(glClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth))
+GLAD_LAZY_VOID(glStencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask))
+GLAD_LAZY_VOID(glColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glDepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag))
+GLAD_LAZY_VOID(glDisable, PFNGLDISABLEPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glEnable, PFNGLENABLEPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glFinish, PFNGLFINISHPROC, (void), ())
+GLAD_LAZY_VOID(glFlush, PFNGLFLUSHPROC, (void), ())
+GLAD_LAZY_VOID(glBlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GLAD_LAZY_VOID(glLogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode))
+GLAD_LAZY_VOID(glStencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GLAD_LAZY_VOID(glStencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GLAD_LAZY_VOID(glDepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func))
+GLAD_LAZY_VOID(glPixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src))
+GLAD_LAZY_VOID(glReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glGetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data))
+GLAD_LAZY_VOID(glGetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble *data), (pname, data))
+GLAD_LAZY(GLenum, glGetError, PFNGLGETERRORPROC, (void), ())
+GLAD_LAZY_VOID(glGetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data))
+GLAD_LAZY_VOID(glGetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data))
+GLAD_LAZY(const GLubyte *, glGetString, PFNGLGETSTRINGPROC, (GLenum name), (name))
+GLAD_LAZY_VOID(glGetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+GLAD_LAZY_VOID(glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GLAD_LAZY_VOID(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GLAD_LAZY(GLboolean, glIsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glDepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f))
+GLAD_LAZY_VOID(glViewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(glNewList, PFNGLNEWLISTPROC, (GLuint list, GLenum mode), (list, mode))
+GLAD_LAZY_VOID(glEndList, PFNGLENDLISTPROC, (void), ())
+GLAD_LAZY_VOID(glCallList, PFNGLCALLLISTPROC, (GLuint list), (list))
+GLAD_LAZY_VOID(glCallLists, PFNGLCALLLISTSPROC, (GLsizei n, GLenum type, const void *lists), (n, type, lists))
+GLAD_LAZY_VOID(glDeleteLists, PFNGLDELETELISTSPROC, (GLuint list, GLsizei range), (list, range))
+GLAD_LAZY(GLuint, glGenLists, PFNGLGENLISTSPROC, (GLsizei range), (range))
+GLAD_LAZY_VOID(glListBase, PFNGLLISTBASEPROC, (GLuint base), (base))
+GLAD_LAZY_VOID(glBegin, PFNGLBEGINPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glBitmap, PFNGLBITMAPPROC, (GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap), (width, height, xorig, yorig, xmove, ymove, bitmap))
+GLAD_LAZY_VOID(glColor3b, PFNGLCOLOR3BPROC, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3bv, PFNGLCOLOR3BVPROC, (const GLbyte *v), (v))
+GLAD_LAZY_VOID(glColor3d, PFNGLCOLOR3DPROC, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3dv, PFNGLCOLOR3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glColor3f, PFNGLCOLOR3FPROC, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3fv, PFNGLCOLOR3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glColor3i, PFNGLCOLOR3IPROC, (GLint red, GLint green, GLint blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3iv, PFNGLCOLOR3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glColor3s, PFNGLCOLOR3SPROC, (GLshort red, GLshort green, GLshort blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3sv, PFNGLCOLOR3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glColor3ub, PFNGLCOLOR3UBPROC, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3ubv, PFNGLCOLOR3UBVPROC, (const GLubyte *v), (v))
+GLAD_LAZY_VOID(glColor3ui, PFNGLCOLOR3UIPROC, (GLuint red, GLuint green, GLuint blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3uiv, PFNGLCOLOR3UIVPROC, (const GLuint *v), (v))
+GLAD_LAZY_VOID(glColor3us, PFNGLCOLOR3USPROC, (GLushort red, GLushort green, GLushort blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3usv, PFNGLCOLOR3USVPROC, (const GLushort *v), (v))
+GLAD_LAZY_VOID(glColor4b, PFNGLCOLOR4BPROC, (GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4bv, PFNGLCOLOR4BVPROC, (const GLbyte *v), (v))
+GLAD_LAZY_VOID(glColor4d, PFNGLCOLOR4DPROC, (GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4dv, PFNGLCOLOR4DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glColor4f, PFNGLCOLOR4FPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4fv, PFNGLCOLOR4FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glColor4i, PFNGLCOLOR4IPROC, (GLint red, GLint green, GLint blue, GLint alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4iv, PFNGLCOLOR4IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glColor4s, PFNGLCOLOR4SPROC, (GLshort red, GLshort green, GLshort blue, GLshort alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4sv, PFNGLCOLOR4SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glColor4ub, PFNGLCOLOR4UBPROC, (GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4ubv, PFNGLCOLOR4UBVPROC, (const GLubyte *v), (v))
+GLAD_LAZY_VOID(glColor4ui, PFNGLCOLOR4UIPROC, (GLuint red, GLuint green, GLuint blue, GLuint alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4uiv, PFNGLCOLOR4UIVPROC, (const GLuint *v), (v))
+GLAD_LAZY_VOID(glColor4us, PFNGLCOLOR4USPROC, (GLushort red, GLushort green, GLushort blue, GLushort alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4usv, PFNGLCOLOR4USVPROC, (const GLushort *v), (v))
+GLAD_LAZY_VOID(glEdgeFlag, PFNGLEDGEFLAGPROC, (GLboolean flag), (flag))
+GLAD_LAZY_VOID(glEdgeFlagv, PFNGLEDGEFLAGVPROC, (const GLboolean *flag), (flag))
+GLAD_LAZY_VOID(glEnd, PFNGLENDPROC, (void), ())
+GLAD_LAZY_VOID(glIndexd, PFNGLINDEXDPROC, (GLdouble c), (c))
+GLAD_LAZY_VOID(glIndexdv, PFNGLINDEXDVPROC, (const GLdouble *c), (c))
+GLAD_LAZY_VOID(glIndexf, PFNGLINDEXFPROC, (GLfloat c), (c))
+GLAD_LAZY_VOID(glIndexfv, PFNGLINDEXFVPROC, (const GLfloat *c), (c))
+GLAD_LAZY_VOID(glIndexi, PFNGLINDEXIPROC, (GLint c), (c))
+GLAD_LAZY_VOID(glIndexiv, PFNGLINDEXIVPROC, (const GLint *c), (c))
+GLAD_LAZY_VOID(glIndexs, PFNGLINDEXSPROC, (GLshort c), (c))
+GLAD_LAZY_VOID(glIndexsv, PFNGLINDEXSVPROC, (const GLshort *c), (c))
+GLAD_LAZY_VOID(glNormal3b, PFNGLNORMAL3BPROC, (GLbyte nx, GLbyte ny, GLbyte nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3bv, PFNGLNORMAL3BVPROC, (const GLbyte *v), (v))
+GLAD_LAZY_VOID(glNormal3d, PFNGLNORMAL3DPROC, (GLdouble nx, GLdouble ny, GLdouble nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3dv, PFNGLNORMAL3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glNormal3f, PFNGLNORMAL3FPROC, (GLfloat nx, GLfloat ny, GLfloat nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3fv, PFNGLNORMAL3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glNormal3i, PFNGLNORMAL3IPROC, (GLint nx, GLint ny, GLint nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3iv, PFNGLNORMAL3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glNormal3s, PFNGLNORMAL3SPROC, (GLshort nx, GLshort ny, GLshort nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3sv, PFNGLNORMAL3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glRasterPos2d, PFNGLRASTERPOS2DPROC, (GLdouble x, GLdouble y), (x, y))
+GLAD_LAZY_VOID(glRasterPos2dv, PFNGLRASTERPOS2DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glRasterPos2f, PFNGLRASTERPOS2FPROC, (GLfloat x, GLfloat y), (x, y))
+GLAD_LAZY_VOID(glRasterPos2fv, PFNGLRASTERPOS2FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glRasterPos2i, PFNGLRASTERPOS2IPROC, (GLint x, GLint y), (x, y))
+GLAD_LAZY_VOID(glRasterPos2iv, PFNGLRASTERPOS2IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glRasterPos2s, PFNGLRASTERPOS2SPROC, (GLshort x, GLshort y), (x, y))
+GLAD_LAZY_VOID(glRasterPos2sv, PFNGLRASTERPOS2SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glRasterPos3d, PFNGLRASTERPOS3DPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glRasterPos3dv, PFNGLRASTERPOS3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glRasterPos3f, PFNGLRASTERPOS3FPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glRasterPos3fv, PFNGLRASTERPOS3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glRasterPos3i, PFNGLRASTERPOS3IPROC, (GLint x, GLint y, GLint z), (x, y, z))
+GLAD_LAZY_VOID(glRasterPos3iv, PFNGLRASTERPOS3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glRasterPos3s, PFNGLRASTERPOS3SPROC, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GLAD_LAZY_VOID(glRasterPos3sv, PFNGLRASTERPOS3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glRasterPos4d, PFNGLRASTERPOS4DPROC, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w))
+GLAD_LAZY_VOID(glRasterPos4dv, PFNGLRASTERPOS4DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glRasterPos4f, PFNGLRASTERPOS4FPROC, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w))
+GLAD_LAZY_VOID(glRasterPos4fv, PFNGLRASTERPOS4FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glRasterPos4i, PFNGLRASTERPOS4IPROC, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w))
+GLAD_LAZY_VOID(glRasterPos4iv, PFNGLRASTERPOS4IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glRasterPos4s, PFNGLRASTERPOS4SPROC, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w))
+GLAD_LAZY_VOID(glRasterPos4sv, PFNGLRASTERPOS4SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glRectd, PFNGLRECTDPROC, (GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2), (x1, y1, x2, y2))
+GLAD_LAZY_VOID(glRectdv, PFNGLRECTDVPROC, (const GLdouble *v1, const GLdouble *v2), (v1, v2))
+GLAD_LAZY_VOID(glRectf, PFNGLRECTFPROC, (GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2), (x1, y1, x2, y2))
+GLAD_LAZY_VOID(glRectfv, PFNGLRECTFVPROC, (const GLfloat *v1, const GLfloat *v2), (v1, v2))
+GLAD_LAZY_VOID(glRecti, PFNGLRECTIPROC, (GLint x1, GLint y1, GLint x2, GLint y2), (x1, y1, x2, y2))
+GLAD_LAZY_VOID(glRectiv, PFNGLRECTIVPROC, (const GLint *v1, const GLint *v2), (v1, v2))
+GLAD_LAZY_VOID(glRects, PFNGLRECTSPROC, (GLshort x1, GLshort y1, GLshort x2, GLshort y2), (x1, y1, x2, y2))
+GLAD_LAZY_VOID(glRectsv, PFNGLRECTSVPROC, (const GLshort *v1, const GLshort *v2), (v1, v2))
+GLAD_LAZY_VOID(glTexCoord1d, PFNGLTEXCOORD1DPROC, (GLdouble s), (s))
+GLAD_LAZY_VOID(glTexCoord1dv, PFNGLTEXCOORD1DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glTexCoord1f, PFNGLTEXCOORD1FPROC, (GLfloat s), (s))
+GLAD_LAZY_VOID(glTexCoord1fv, PFNGLTEXCOORD1FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glTexCoord1i, PFNGLTEXCOORD1IPROC, (GLint s), (s))
+GLAD_LAZY_VOID(glTexCoord1iv, PFNGLTEXCOORD1IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glTexCoord1s, PFNGLTEXCOORD1SPROC, (GLshort s), (s))
+GLAD_LAZY_VOID(glTexCoord1sv, PFNGLTEXCOORD1SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glTexCoord2d, PFNGLTEXCOORD2DPROC, (GLdouble s, GLdouble t), (s, t))
+GLAD_LAZY_VOID(glTexCoord2dv, PFNGLTEXCOORD2DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glTexCoord2f, PFNGLTEXCOORD2FPROC, (GLfloat s, GLfloat t), (s, t))
+GLAD_LAZY_VOID(glTexCoord2fv, PFNGLTEXCOORD2FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glTexCoord2i, PFNGLTEXCOORD2IPROC, (GLint s, GLint t), (s, t))
+GLAD_LAZY_VOID(glTexCoord2iv, PFNGLTEXCOORD2IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glTexCoord2s, PFNGLTEXCOORD2SPROC, (GLshort s, GLshort t), (s, t))
+GLAD_LAZY_VOID(glTexCoord2sv, PFNGLTEXCOORD2SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glTexCoord3d, PFNGLTEXCOORD3DPROC, (GLdouble s, GLdouble t, GLdouble r), (s, t, r))
+GLAD_LAZY_VOID(glTexCoord3dv, PFNGLTEXCOORD3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glTexCoord3f, PFNGLTEXCOORD3FPROC, (GLfloat s, GLfloat t, GLfloat r), (s, t, r))
+GLAD_LAZY_VOID(glTexCoord3fv, PFNGLTEXCOORD3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glTexCoord3i, PFNGLTEXCOORD3IPROC, (GLint s, GLint t, GLint r), (s, t, r))
+GLAD_LAZY_VOID(glTexCoord3iv, PFNGLTEXCOORD3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glTexCoord3s, PFNGLTEXCOORD3SPROC, (GLshort s, GLshort t, GLshort r), (s, t, r))
+GLAD_LAZY_VOID(glTexCoord3sv, PFNGLTEXCOORD3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glTexCoord4d, PFNGLTEXCOORD4DPROC, (GLdouble s, GLdouble t, GLdouble r, GLdouble q), (s, t, r, q))
+GLAD_LAZY_VOID(glTexCoord4dv, PFNGLTEXCOORD4DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glTexCoord4f, PFNGLTEXCOORD4FPROC, (GLfloat s, GLfloat t, GLfloat r, GLfloat q), (s, t, r, q))
+GLAD_LAZY_VOID(glTexCoord4fv, PFNGLTEXCOORD4FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glTexCoord4i, PFNGLTEXCOORD4IPROC, (GLint s, GLint t, GLint r, GLint q), (s, t, r, q))
+GLAD_LAZY_VOID(glTexCoord4iv, PFNGLTEXCOORD4IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glTexCoord4s, PFNGLTEXCOORD4SPROC, (GLshort s, GLshort t, GLshort r, GLshort q), (s, t, r, q))
+GLAD_LAZY_VOID(glTexCoord4sv, PFNGLTEXCOORD4SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glVertex2d, PFNGLVERTEX2DPROC, (GLdouble x, GLdouble y), (x, y))
+GLAD_LAZY_VOID(glVertex2dv, PFNGLVERTEX2DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glVertex2f, PFNGLVERTEX2FPROC, (GLfloat x, GLfloat y), (x, y))
+GLAD_LAZY_VOID(glVertex2fv, PFNGLVERTEX2FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glVertex2i, PFNGLVERTEX2IPROC, (GLint x, GLint y), (x, y))
+GLAD_LAZY_VOID(glVertex2iv, PFNGLVERTEX2IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glVertex2s, PFNGLVERTEX2SPROC, (GLshort x, GLshort y), (x, y))
+GLAD_LAZY_VOID(glVertex2sv, PFNGLVERTEX2SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glVertex3d, PFNGLVERTEX3DPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glVertex3dv, PFNGLVERTEX3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glVertex3f, PFNGLVERTEX3FPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glVertex3fv, PFNGLVERTEX3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glVertex3i, PFNGLVERTEX3IPROC, (GLint x, GLint y, GLint z), (x, y, z))
+GLAD_LAZY_VOID(glVertex3iv, PFNGLVERTEX3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glVertex3s, PFNGLVERTEX3SPROC, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GLAD_LAZY_VOID(glVertex3sv, PFNGLVERTEX3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glVertex4d, PFNGLVERTEX4DPROC, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w))
+GLAD_LAZY_VOID(glVertex4dv, PFNGLVERTEX4DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glVertex4f, PFNGLVERTEX4FPROC, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w))
+GLAD_LAZY_VOID(glVertex4fv, PFNGLVERTEX4FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glVertex4i, PFNGLVERTEX4IPROC, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w))
+GLAD_LAZY_VOID(glVertex4iv, PFNGLVERTEX4IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glVertex4s, PFNGLVERTEX4SPROC, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w))
+GLAD_LAZY_VOID(glVertex4sv, PFNGLVERTEX4SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glClipPlane, PFNGLCLIPPLANEPROC, (GLenum plane, const GLdouble *equation), (plane, equation))
+GLAD_LAZY_VOID(glColorMaterial, PFNGLCOLORMATERIALPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_LAZY_VOID(glFogf, PFNGLFOGFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glFogfv, PFNGLFOGFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(glFogi, PFNGLFOGIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glFogiv, PFNGLFOGIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_LAZY_VOID(glLightf, PFNGLLIGHTFPROC, (GLenum light, GLenum pname, GLfloat param), (light, pname, param))
+GLAD_LAZY_VOID(glLightfv, PFNGLLIGHTFVPROC, (GLenum light, GLenum pname, const GLfloat *params), (light, pname, params))
+GLAD_LAZY_VOID(glLighti, PFNGLLIGHTIPROC, (GLenum light, GLenum pname, GLint param), (light, pname, param))
+GLAD_LAZY_VOID(glLightiv, PFNGLLIGHTIVPROC, (GLenum light, GLenum pname, const GLint *params), (light, pname, params))
+GLAD_LAZY_VOID(glLightModelf, PFNGLLIGHTMODELFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glLightModelfv, PFNGLLIGHTMODELFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(glLightModeli, PFNGLLIGHTMODELIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glLightModeliv, PFNGLLIGHTMODELIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_LAZY_VOID(glLineStipple, PFNGLLINESTIPPLEPROC, (GLint factor, GLushort pattern), (factor, pattern))
+GLAD_LAZY_VOID(glMaterialf, PFNGLMATERIALFPROC, (GLenum face, GLenum pname, GLfloat param), (face, pname, param))
+GLAD_LAZY_VOID(glMaterialfv, PFNGLMATERIALFVPROC, (GLenum face, GLenum pname, const GLfloat *params), (face, pname, params))
+GLAD_LAZY_VOID(glMateriali, PFNGLMATERIALIPROC, (GLenum face, GLenum pname, GLint param), (face, pname, param))
+GLAD_LAZY_VOID(glMaterialiv, PFNGLMATERIALIVPROC, (GLenum face, GLenum pname, const GLint *params), (face, pname, params))
+GLAD_LAZY_VOID(glPolygonStipple, PFNGLPOLYGONSTIPPLEPROC, (const GLubyte *mask), (mask))
+GLAD_LAZY_VOID(glShadeModel, PFNGLSHADEMODELPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glTexEnvf, PFNGLTEXENVFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_LAZY_VOID(glTexEnvfv, PFNGLTEXENVFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexEnvi, PFNGLTEXENVIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_LAZY_VOID(glTexEnviv, PFNGLTEXENVIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexGend, PFNGLTEXGENDPROC, (GLenum coord, GLenum pname, GLdouble param), (coord, pname, param))
+GLAD_LAZY_VOID(glTexGendv, PFNGLTEXGENDVPROC, (GLenum coord, GLenum pname, const GLdouble *params), (coord, pname, params))
+GLAD_LAZY_VOID(glTexGenf, PFNGLTEXGENFPROC, (GLenum coord, GLenum pname, GLfloat param), (coord, pname, param))
+GLAD_LAZY_VOID(glTexGenfv, PFNGLTEXGENFVPROC, (GLenum coord, GLenum pname, const GLfloat *params), (coord, pname, params))
+GLAD_LAZY_VOID(glTexGeni, PFNGLTEXGENIPROC, (GLenum coord, GLenum pname, GLint param), (coord, pname, param))
+GLAD_LAZY_VOID(glTexGeniv, PFNGLTEXGENIVPROC, (GLenum coord, GLenum pname, const GLint *params), (coord, pname, params))
+GLAD_LAZY_VOID(glFeedbackBuffer, PFNGLFEEDBACKBUFFERPROC, (GLsizei size, GLenum type, GLfloat *buffer), (size, type, buffer))
+GLAD_LAZY_VOID(glSelectBuffer, PFNGLSELECTBUFFERPROC, (GLsizei size, GLuint *buffer), (size, buffer))
+GLAD_LAZY(GLint, glRenderMode, PFNGLRENDERMODEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glInitNames, PFNGLINITNAMESPROC, (void), ())
+GLAD_LAZY_VOID(glLoadName, PFNGLLOADNAMEPROC, (GLuint name), (name))
+GLAD_LAZY_VOID(glPassThrough, PFNGLPASSTHROUGHPROC, (GLfloat token), (token))
+GLAD_LAZY_VOID(glPopName, PFNGLPOPNAMEPROC, (void), ())
+GLAD_LAZY_VOID(glPushName, PFNGLPUSHNAMEPROC, (GLuint name), (name))
+GLAD_LAZY_VOID(glClearAccum, PFNGLCLEARACCUMPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glClearIndex, PFNGLCLEARINDEXPROC, (GLfloat c), (c))
+GLAD_LAZY_VOID(glIndexMask, PFNGLINDEXMASKPROC, (GLuint mask), (mask))
+GLAD_LAZY_VOID(glAccum, PFNGLACCUMPROC, (GLenum op, GLfloat value), (op, value))
+GLAD_LAZY_VOID(glPopAttrib, PFNGLPOPATTRIBPROC, (void), ())
+GLAD_LAZY_VOID(glPushAttrib, PFNGLPUSHATTRIBPROC, (GLbitfield mask), (mask))
+GLAD_LAZY_VOID(glMap1d, PFNGLMAP1DPROC, (GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points), (target, u1, u2, stride, order, points))
+GLAD_LAZY_VOID(glMap1f, PFNGLMAP1FPROC, (GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points), (target, u1, u2, stride, order, points))
+GLAD_LAZY_VOID(glMap2d, PFNGLMAP2DPROC, (GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GLAD_LAZY_VOID(glMap2f, PFNGLMAP2FPROC, (GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GLAD_LAZY_VOID(glMapGrid1d, PFNGLMAPGRID1DPROC, (GLint un, GLdouble u1, GLdouble u2), (un, u1, u2))
+GLAD_LAZY_VOID(glMapGrid1f, PFNGLMAPGRID1FPROC, (GLint un, GLfloat u1, GLfloat u2), (un, u1, u2))
+GLAD_LAZY_VOID(glMapGrid2d, PFNGLMAPGRID2DPROC, (GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2), (un, u1, u2, vn, v1, v2))
+GLAD_LAZY_VOID(glMapGrid2f, PFNGLMAPGRID2FPROC, (GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2), (un, u1, u2, vn, v1, v2))
+GLAD_LAZY_VOID(glEvalCoord1d, PFNGLEVALCOORD1DPROC, (GLdouble u), (u))
+GLAD_LAZY_VOID(glEvalCoord1dv, PFNGLEVALCOORD1DVPROC, (const GLdouble *u), (u))
+GLAD_LAZY_VOID(glEvalCoord1f, PFNGLEVALCOORD1FPROC, (GLfloat u), (u))
+GLAD_LAZY_VOID(glEvalCoord1fv, PFNGLEVALCOORD1FVPROC, (const GLfloat *u), (u))
+GLAD_LAZY_VOID(glEvalCoord2d, PFNGLEVALCOORD2DPROC, (GLdouble u, GLdouble v), (u, v))
+GLAD_LAZY_VOID(glEvalCoord2dv, PFNGLEVALCOORD2DVPROC, (const GLdouble *u), (u))
+GLAD_LAZY_VOID(glEvalCoord2f, PFNGLEVALCOORD2FPROC, (GLfloat u, GLfloat v), (u, v))
+GLAD_LAZY_VOID(glEvalCoord2fv, PFNGLEVALCOORD2FVPROC, (const GLfloat *u), (u))
+GLAD_LAZY_VOID(glEvalMesh1, PFNGLEVALMESH1PROC, (GLenum mode, GLint i1, GLint i2), (mode, i1, i2))
+GLAD_LAZY_VOID(glEvalPoint1, PFNGLEVALPOINT1PROC, (GLint i), (i))
+GLAD_LAZY_VOID(glEvalMesh2, PFNGLEVALMESH2PROC, (GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2), (mode, i1, i2, j1, j2))
+GLAD_LAZY_VOID(glEvalPoint2, PFNGLEVALPOINT2PROC, (GLint i, GLint j), (i, j))
+GLAD_LAZY_VOID(glAlphaFunc, PFNGLALPHAFUNCPROC, (GLenum func, GLfloat ref), (func, ref))
+GLAD_LAZY_VOID(glPixelZoom, PFNGLPIXELZOOMPROC, (GLfloat xfactor, GLfloat yfactor), (xfactor, yfactor))
+GLAD_LAZY_VOID(glPixelTransferf, PFNGLPIXELTRANSFERFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPixelTransferi, PFNGLPIXELTRANSFERIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glPixelMapfv, PFNGLPIXELMAPFVPROC, (GLenum map, GLsizei mapsize, const GLfloat *values), (map, mapsize, values))
+GLAD_LAZY_VOID(glPixelMapuiv, PFNGLPIXELMAPUIVPROC, (GLenum map, GLsizei mapsize, const GLuint *values), (map, mapsize, values))
+GLAD_LAZY_VOID(glPixelMapusv, PFNGLPIXELMAPUSVPROC, (GLenum map, GLsizei mapsize, const GLushort *values), (map, mapsize, values))
+GLAD_LAZY_VOID(glCopyPixels, PFNGLCOPYPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum type), (x, y, width, height, type))
+GLAD_LAZY_VOID(glDrawPixels, PFNGLDRAWPIXELSPROC, (GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (width, height, format, type, pixels))
+GLAD_LAZY_VOID(glGetClipPlane, PFNGLGETCLIPPLANEPROC, (GLenum plane, GLdouble *equation), (plane, equation))
+GLAD_LAZY_VOID(glGetLightfv, PFNGLGETLIGHTFVPROC, (GLenum light, GLenum pname, GLfloat *params), (light, pname, params))
+GLAD_LAZY_VOID(glGetLightiv, PFNGLGETLIGHTIVPROC, (GLenum light, GLenum pname, GLint *params), (light, pname, params))
+GLAD_LAZY_VOID(glGetMapdv, PFNGLGETMAPDVPROC, (GLenum target, GLenum query, GLdouble *v), (target, query, v))
+GLAD_LAZY_VOID(glGetMapfv, PFNGLGETMAPFVPROC, (GLenum target, GLenum query, GLfloat *v), (target, query, v))
+GLAD_LAZY_VOID(glGetMapiv, PFNGLGETMAPIVPROC, (GLenum target, GLenum query, GLint *v), (target, query, v))
+GLAD_LAZY_VOID(glGetMaterialfv, PFNGLGETMATERIALFVPROC, (GLenum face, GLenum pname, GLfloat *params), (face, pname, params))
+GLAD_LAZY_VOID(glGetMaterialiv, PFNGLGETMATERIALIVPROC, (GLenum face, GLenum pname, GLint *params), (face, pname, params))
+GLAD_LAZY_VOID(glGetPixelMapfv, PFNGLGETPIXELMAPFVPROC, (GLenum map, GLfloat *values), (map, values))
+GLAD_LAZY_VOID(glGetPixelMapuiv, PFNGLGETPIXELMAPUIVPROC, (GLenum map, GLuint *values), (map, values))
+GLAD_LAZY_VOID(glGetPixelMapusv, PFNGLGETPIXELMAPUSVPROC, (GLenum map, GLushort *values), (map, values))
+GLAD_LAZY_VOID(glGetPolygonStipple, PFNGLGETPOLYGONSTIPPLEPROC, (GLubyte *mask), (mask))
+GLAD_LAZY_VOID(glGetTexEnvfv, PFNGLGETTEXENVFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexEnviv, PFNGLGETTEXENVIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexGendv, PFNGLGETTEXGENDVPROC, (GLenum coord, GLenum pname, GLdouble *params), (coord, pname, params))
+GLAD_LAZY_VOID(glGetTexGenfv, PFNGLGETTEXGENFVPROC, (GLenum coord, GLenum pname, GLfloat *params), (coord, pname, params))
+GLAD_LAZY_VOID(glGetTexGeniv, PFNGLGETTEXGENIVPROC, (GLenum coord, GLenum pname, GLint *params), (coord, pname, params))
+GLAD_LAZY(GLboolean, glIsList, PFNGLISLISTPROC, (GLuint list), (list))
+GLAD_LAZY_VOID(glFrustum, PFNGLFRUSTUMPROC, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (left, right, bottom, top, zNear, zFar))
+GLAD_LAZY_VOID(glLoadIdentity, PFNGLLOADIDENTITYPROC, (void), ())
+GLAD_LAZY_VOID(glLoadMatrixf, PFNGLLOADMATRIXFPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glLoadMatrixd, PFNGLLOADMATRIXDPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glMatrixMode, PFNGLMATRIXMODEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glMultMatrixf, PFNGLMULTMATRIXFPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glMultMatrixd, PFNGLMULTMATRIXDPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glOrtho, PFNGLORTHOPROC, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (left, right, bottom, top, zNear, zFar))
+GLAD_LAZY_VOID(glPopMatrix, PFNGLPOPMATRIXPROC, (void), ())
+GLAD_LAZY_VOID(glPushMatrix, PFNGLPUSHMATRIXPROC, (void), ())
+GLAD_LAZY_VOID(glRotated, PFNGLROTATEDPROC, (GLdouble angle, GLdouble x, GLdouble y, GLdouble z), (angle, x, y, z))
+GLAD_LAZY_VOID(glRotatef, PFNGLROTATEFPROC, (GLfloat angle, GLfloat x, GLfloat y, GLfloat z), (angle, x, y, z))
+GLAD_LAZY_VOID(glScaled, PFNGLSCALEDPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glScalef, PFNGLSCALEFPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glTranslated, PFNGLTRANSLATEDPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glTranslatef, PFNGLTRANSLATEFPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glDrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_LAZY_VOID(glDrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GLAD_LAZY_VOID(glGetPointerv, PFNGLGETPOINTERVPROC, (GLenum pname, void **params), (pname, params))
+GLAD_LAZY_VOID(glPolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units))
+GLAD_LAZY_VOID(glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GLAD_LAZY_VOID(glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GLAD_LAZY_VOID(glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GLAD_LAZY_VOID(glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GLAD_LAZY_VOID(glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GLAD_LAZY_VOID(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glBindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture))
+GLAD_LAZY_VOID(glDeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures))
+GLAD_LAZY_VOID(glGenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures))
+GLAD_LAZY(GLboolean, glIsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture))
+GLAD_LAZY_VOID(glArrayElement, PFNGLARRAYELEMENTPROC, (GLint i), (i))
+GLAD_LAZY_VOID(glColorPointer, PFNGLCOLORPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY_VOID(glDisableClientState, PFNGLDISABLECLIENTSTATEPROC, (GLenum array), (array))
+GLAD_LAZY_VOID(glEdgeFlagPointer, PFNGLEDGEFLAGPOINTERPROC, (GLsizei stride, const void *pointer), (stride, pointer))
+GLAD_LAZY_VOID(glEnableClientState, PFNGLENABLECLIENTSTATEPROC, (GLenum array), (array))
+GLAD_LAZY_VOID(glIndexPointer, PFNGLINDEXPOINTERPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GLAD_LAZY_VOID(glInterleavedArrays, PFNGLINTERLEAVEDARRAYSPROC, (GLenum format, GLsizei stride, const void *pointer), (format, stride, pointer))
+GLAD_LAZY_VOID(glNormalPointer, PFNGLNORMALPOINTERPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GLAD_LAZY_VOID(glTexCoordPointer, PFNGLTEXCOORDPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY_VOID(glVertexPointer, PFNGLVERTEXPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY(GLboolean, glAreTexturesResident, PFNGLARETEXTURESRESIDENTPROC, (GLsizei n, const GLuint *textures, GLboolean *residences), (n, textures, residences))
+GLAD_LAZY_VOID(glPrioritizeTextures, PFNGLPRIORITIZETEXTURESPROC, (GLsizei n, const GLuint *textures, const GLfloat *priorities), (n, textures, priorities))
+GLAD_LAZY_VOID(glIndexub, PFNGLINDEXUBPROC, (GLubyte c), (c))
+GLAD_LAZY_VOID(glIndexubv, PFNGLINDEXUBVPROC, (const GLubyte *c), (c))
+GLAD_LAZY_VOID(glPopClientAttrib, PFNGLPOPCLIENTATTRIBPROC, (void), ())
+GLAD_LAZY_VOID(glPushClientAttrib, PFNGLPUSHCLIENTATTRIBPROC, (GLbitfield mask), (mask))
+GLAD_LAZY_VOID(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GLAD_LAZY_VOID(glTexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_LAZY_VOID(glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_LAZY_VOID(glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_LAZY_VOID(glActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture))
+GLAD_LAZY_VOID(glSampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_LAZY_VOID(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_LAZY_VOID(glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_LAZY_VOID(glClientActiveTexture, PFNGLCLIENTACTIVETEXTUREPROC, (GLenum texture), (texture))
+GLAD_LAZY_VOID(glMultiTexCoord1d, PFNGLMULTITEXCOORD1DPROC, (GLenum target, GLdouble s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1dv, PFNGLMULTITEXCOORD1DVPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord1f, PFNGLMULTITEXCOORD1FPROC, (GLenum target, GLfloat s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1fv, PFNGLMULTITEXCOORD1FVPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord1i, PFNGLMULTITEXCOORD1IPROC, (GLenum target, GLint s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1iv, PFNGLMULTITEXCOORD1IVPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord1s, PFNGLMULTITEXCOORD1SPROC, (GLenum target, GLshort s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1sv, PFNGLMULTITEXCOORD1SVPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2d, PFNGLMULTITEXCOORD2DPROC, (GLenum target, GLdouble s, GLdouble t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2dv, PFNGLMULTITEXCOORD2DVPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2f, PFNGLMULTITEXCOORD2FPROC, (GLenum target, GLfloat s, GLfloat t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2fv, PFNGLMULTITEXCOORD2FVPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2i, PFNGLMULTITEXCOORD2IPROC, (GLenum target, GLint s, GLint t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2iv, PFNGLMULTITEXCOORD2IVPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2s, PFNGLMULTITEXCOORD2SPROC, (GLenum target, GLshort s, GLshort t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2sv, PFNGLMULTITEXCOORD2SVPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3d, PFNGLMULTITEXCOORD3DPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3dv, PFNGLMULTITEXCOORD3DVPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3f, PFNGLMULTITEXCOORD3FPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3fv, PFNGLMULTITEXCOORD3FVPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3i, PFNGLMULTITEXCOORD3IPROC, (GLenum target, GLint s, GLint t, GLint r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3iv, PFNGLMULTITEXCOORD3IVPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3s, PFNGLMULTITEXCOORD3SPROC, (GLenum target, GLshort s, GLshort t, GLshort r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3sv, PFNGLMULTITEXCOORD3SVPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4d, PFNGLMULTITEXCOORD4DPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4dv, PFNGLMULTITEXCOORD4DVPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4f, PFNGLMULTITEXCOORD4FPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4fv, PFNGLMULTITEXCOORD4FVPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4i, PFNGLMULTITEXCOORD4IPROC, (GLenum target, GLint s, GLint t, GLint r, GLint q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4iv, PFNGLMULTITEXCOORD4IVPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4s, PFNGLMULTITEXCOORD4SPROC, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4sv, PFNGLMULTITEXCOORD4SVPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glLoadTransposeMatrixf, PFNGLLOADTRANSPOSEMATRIXFPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glLoadTransposeMatrixd, PFNGLLOADTRANSPOSEMATRIXDPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glMultTransposeMatrixf, PFNGLMULTTRANSPOSEMATRIXFPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glMultTransposeMatrixd, PFNGLMULTTRANSPOSEMATRIXDPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_LAZY_VOID(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GLAD_LAZY_VOID(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GLAD_LAZY_VOID(glPointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(glPointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glPointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_LAZY_VOID(glFogCoordf, PFNGLFOGCOORDFPROC, (GLfloat coord), (coord))
+GLAD_LAZY_VOID(glFogCoordfv, PFNGLFOGCOORDFVPROC, (const GLfloat *coord), (coord))
+GLAD_LAZY_VOID(glFogCoordd, PFNGLFOGCOORDDPROC, (GLdouble coord), (coord))
+GLAD_LAZY_VOID(glFogCoorddv, PFNGLFOGCOORDDVPROC, (const GLdouble *coord), (coord))
+GLAD_LAZY_VOID(glFogCoordPointer, PFNGLFOGCOORDPOINTERPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GLAD_LAZY_VOID(glSecondaryColor3b, PFNGLSECONDARYCOLOR3BPROC, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3bv, PFNGLSECONDARYCOLOR3BVPROC, (const GLbyte *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3d, PFNGLSECONDARYCOLOR3DPROC, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3dv, PFNGLSECONDARYCOLOR3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3f, PFNGLSECONDARYCOLOR3FPROC, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3fv, PFNGLSECONDARYCOLOR3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3i, PFNGLSECONDARYCOLOR3IPROC, (GLint red, GLint green, GLint blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3iv, PFNGLSECONDARYCOLOR3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3s, PFNGLSECONDARYCOLOR3SPROC, (GLshort red, GLshort green, GLshort blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3sv, PFNGLSECONDARYCOLOR3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3ub, PFNGLSECONDARYCOLOR3UBPROC, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3ubv, PFNGLSECONDARYCOLOR3UBVPROC, (const GLubyte *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3ui, PFNGLSECONDARYCOLOR3UIPROC, (GLuint red, GLuint green, GLuint blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3uiv, PFNGLSECONDARYCOLOR3UIVPROC, (const GLuint *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3us, PFNGLSECONDARYCOLOR3USPROC, (GLushort red, GLushort green, GLushort blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3usv, PFNGLSECONDARYCOLOR3USVPROC, (const GLushort *v), (v))
+GLAD_LAZY_VOID(glSecondaryColorPointer, PFNGLSECONDARYCOLORPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY_VOID(glWindowPos2d, PFNGLWINDOWPOS2DPROC, (GLdouble x, GLdouble y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2dv, PFNGLWINDOWPOS2DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glWindowPos2f, PFNGLWINDOWPOS2FPROC, (GLfloat x, GLfloat y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2fv, PFNGLWINDOWPOS2FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glWindowPos2i, PFNGLWINDOWPOS2IPROC, (GLint x, GLint y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2iv, PFNGLWINDOWPOS2IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glWindowPos2s, PFNGLWINDOWPOS2SPROC, (GLshort x, GLshort y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2sv, PFNGLWINDOWPOS2SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glWindowPos3d, PFNGLWINDOWPOS3DPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3dv, PFNGLWINDOWPOS3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glWindowPos3f, PFNGLWINDOWPOS3FPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3fv, PFNGLWINDOWPOS3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glWindowPos3i, PFNGLWINDOWPOS3IPROC, (GLint x, GLint y, GLint z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3iv, PFNGLWINDOWPOS3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glWindowPos3s, PFNGLWINDOWPOS3SPROC, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3sv, PFNGLWINDOWPOS3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glBlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glBlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glGenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glDeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_LAZY(GLboolean, glIsQuery, PFNGLISQUERYPROC, (GLuint id), (id))
+GLAD_LAZY_VOID(glBeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id))
+GLAD_LAZY_VOID(glEndQuery, PFNGLENDQUERYPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glGetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_LAZY_VOID(glBindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_LAZY_VOID(glDeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_LAZY_VOID(glGenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_LAZY(GLboolean, glIsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer))
+GLAD_LAZY_VOID(glBufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_LAZY_VOID(glBufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GLAD_LAZY_VOID(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GLAD_LAZY(void *, glMapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access))
+GLAD_LAZY(GLboolean, glUnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_LAZY_VOID(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GLAD_LAZY_VOID(glDrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_LAZY_VOID(glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GLAD_LAZY_VOID(glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GLAD_LAZY_VOID(glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask))
+GLAD_LAZY_VOID(glAttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GLAD_LAZY_VOID(glCompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY(GLuint, glCreateProgram, PFNGLCREATEPROGRAMPROC, (void), ())
+GLAD_LAZY(GLuint, glCreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type))
+GLAD_LAZY_VOID(glDeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glDeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_VOID(glDetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GLAD_LAZY(GLint, glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GLAD_LAZY_VOID(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glGetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GLAD_LAZY_VOID(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glGetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GLAD_LAZY(GLint, glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GLAD_LAZY_VOID(glGetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint *params), (program, location, params))
+GLAD_LAZY_VOID(glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_LAZY(GLboolean, glIsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY(GLboolean, glIsShader, PFNGLISSHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_VOID(glLinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GLAD_LAZY_VOID(glUseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glUniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_LAZY_VOID(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GLAD_LAZY_VOID(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GLAD_LAZY_VOID(glGetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GLAD_LAZY_VOID(glEnablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glDisablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY(GLboolean, glIsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode))
+GLAD_LAZY_VOID(glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), ())
+GLAD_LAZY_VOID(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_LAZY_VOID(glBindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_LAZY_VOID(glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GLAD_LAZY_VOID(glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_LAZY_VOID(glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode))
+GLAD_LAZY_VOID(glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (void), ())
+GLAD_LAZY_VOID(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_LAZY_VOID(glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GLAD_LAZY_VOID(glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glGetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GLAD_LAZY_VOID(glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GLAD_LAZY(GLint, glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glUniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(glClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GLAD_LAZY(const GLubyte *, glGetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index))
+GLAD_LAZY(GLboolean, glIsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer))
+GLAD_LAZY_VOID(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_LAZY_VOID(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GLAD_LAZY_VOID(glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY(GLboolean, glIsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer))
+GLAD_LAZY_VOID(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GLAD_LAZY_VOID(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY_VOID(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY(GLenum, glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GLAD_LAZY_VOID(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GLAD_LAZY_VOID(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GLAD_LAZY_VOID(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_LAZY_VOID(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GLAD_LAZY_VOID(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_LAZY(void *, glMapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GLAD_LAZY_VOID(glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GLAD_LAZY_VOID(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_LAZY_VOID(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays))
+GLAD_LAZY_VOID(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_LAZY(GLboolean, glIsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_LAZY_VOID(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GLAD_LAZY_VOID(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GLAD_LAZY_VOID(glTexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_LAZY_VOID(glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GLAD_LAZY_VOID(glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GLAD_LAZY_VOID(glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GLAD_LAZY_VOID(glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GLAD_LAZY(GLuint, glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GLAD_LAZY_VOID(glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GLAD_LAZY_VOID(glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GLAD_LAZY_VOID(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GLAD_LAZY_VOID(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GLAD_LAZY_VOID(glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GLAD_LAZY_VOID(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GLAD_LAZY_VOID(glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GLAD_LAZY_VOID(glProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode))
+GLAD_LAZY(GLsync, glFenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags))
+GLAD_LAZY(GLboolean, glIsSync, PFNGLISSYNCPROC, (GLsync sync), (sync))
+GLAD_LAZY_VOID(glDeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync))
+GLAD_LAZY(GLenum, glClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(glWaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(glGetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data))
+GLAD_LAZY_VOID(glGetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+GLAD_LAZY_VOID(glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GLAD_LAZY_VOID(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GLAD_LAZY_VOID(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_LAZY_VOID(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_LAZY_VOID(glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_LAZY_VOID(glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GLAD_LAZY_VOID(glSampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GLAD_LAZY_VOID(glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GLAD_LAZY(GLint, glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers))
+GLAD_LAZY_VOID(glDeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers))
+GLAD_LAZY(GLboolean, glIsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler))
+GLAD_LAZY_VOID(glBindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler))
+GLAD_LAZY_VOID(glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glQueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target))
+GLAD_LAZY_VOID(glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_LAZY_VOID(glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexP2ui, PFNGLVERTEXP2UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP2uiv, PFNGLVERTEXP2UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glVertexP3ui, PFNGLVERTEXP3UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP3uiv, PFNGLVERTEXP3UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glVertexP4ui, PFNGLVERTEXP4UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP4uiv, PFNGLVERTEXP4UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glNormalP3ui, PFNGLNORMALP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glNormalP3uiv, PFNGLNORMALP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glColorP3ui, PFNGLCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glColorP3uiv, PFNGLCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glColorP4ui, PFNGLCOLORP4UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glColorP4uiv, PFNGLCOLORP4UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glBufferStorage, PFNGLBUFFERSTORAGEPROC, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags))
+GLAD_LAZY_VOID(glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GLAD_LAZY_VOID(glProgramBinary, PFNGLPROGRAMBINARYPROC, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GLAD_LAZY_VOID(glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_LAZY_VOID(glMaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, (GLuint count), (count))
+GLAD_LAZY_VOID(glMaxShaderCompilerThreadsARB, PFNGLMAXSHADERCOMPILERTHREADSARBPROC, (GLuint count), (count))
+GLAD_LAZY_VOID(glClipControl, PFNGLCLIPCONTROLPROC, (GLenum origin, GLenum depth), (origin, depth))
+
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	GLAD_LAZY_SET(glCullFace);
+	GLAD_LAZY_SET(glFrontFace);
+	GLAD_LAZY_SET(glHint);
+	GLAD_LAZY_SET(glLineWidth);
+	GLAD_LAZY_SET(glPointSize);
+	GLAD_LAZY_SET(glPolygonMode);
+	GLAD_LAZY_SET(glScissor);
+	GLAD_LAZY_SET(glTexParameterf);
+	GLAD_LAZY_SET(glTexParameterfv);
+	GLAD_LAZY_SET(glTexParameteri);
+	GLAD_LAZY_SET(glTexParameteriv);
+	GLAD_LAZY_SET(glTexImage1D);
+	GLAD_LAZY_SET(glTexImage2D);
+	GLAD_LAZY_SET(glDrawBuffer);
+	GLAD_LAZY_SET(glClear);
+	GLAD_LAZY_SET(glClearColor);
+	GLAD_LAZY_SET(glClearStencil);
+	GLAD_LAZY_SET(glClearDepth);
+	GLAD_LAZY_SET(glStencilMask);
+	GLAD_LAZY_SET(glColorMask);
+	GLAD_LAZY_SET(glDepthMask);
+	GLAD_LAZY_SET(glDisable);
+	GLAD_LAZY_SET(glEnable);
+	GLAD_LAZY_SET(glFinish);
+	GLAD_LAZY_SET(glFlush);
+	GLAD_LAZY_SET(glBlendFunc);
+	GLAD_LAZY_SET(glLogicOp);
+	GLAD_LAZY_SET(glStencilFunc);
+	GLAD_LAZY_SET(glStencilOp);
+	GLAD_LAZY_SET(glDepthFunc);
+	GLAD_LAZY_SET(glPixelStoref);
+	GLAD_LAZY_SET(glPixelStorei);
+	GLAD_LAZY_SET(glReadBuffer);
+	GLAD_LAZY_SET(glReadPixels);
+	GLAD_LAZY_SET(glGetBooleanv);
+	GLAD_LAZY_SET(glGetDoublev);
+	GLAD_LAZY_SET(glGetError);
+	GLAD_LAZY_SET(glGetFloatv);
+	GLAD_LAZY_SET(glGetIntegerv);
+	GLAD_LAZY_SET(glGetString);
+	GLAD_LAZY_SET(glGetTexImage);
+	GLAD_LAZY_SET(glGetTexParameterfv);
+	GLAD_LAZY_SET(glGetTexParameteriv);
+	GLAD_LAZY_SET(glGetTexLevelParameterfv);
+	GLAD_LAZY_SET(glGetTexLevelParameteriv);
+	GLAD_LAZY_SET(glIsEnabled);
+	GLAD_LAZY_SET(glDepthRange);
+	GLAD_LAZY_SET(glViewport);
+	GLAD_LAZY_SET(glNewList);
+	GLAD_LAZY_SET(glEndList);
+	GLAD_LAZY_SET(glCallList);
+	GLAD_LAZY_SET(glCallLists);
+	GLAD_LAZY_SET(glDeleteLists);
+	GLAD_LAZY_SET(glGenLists);
+	GLAD_LAZY_SET(glListBase);
+	GLAD_LAZY_SET(glBegin);
+	GLAD_LAZY_SET(glBitmap);
+	GLAD_LAZY_SET(glColor3b);
+	GLAD_LAZY_SET(glColor3bv);
+	GLAD_LAZY_SET(glColor3d);
+	GLAD_LAZY_SET(glColor3dv);
+	GLAD_LAZY_SET(glColor3f);
+	GLAD_LAZY_SET(glColor3fv);
+	GLAD_LAZY_SET(glColor3i);
+	GLAD_LAZY_SET(glColor3iv);
+	GLAD_LAZY_SET(glColor3s);
+	GLAD_LAZY_SET(glColor3sv);
+	GLAD_LAZY_SET(glColor3ub);
+	GLAD_LAZY_SET(glColor3ubv);
+	GLAD_LAZY_SET(glColor3ui);
+	GLAD_LAZY_SET(glColor3uiv);
+	GLAD_LAZY_SET(glColor3us);
+	GLAD_LAZY_SET(glColor3usv);
+	GLAD_LAZY_SET(glColor4b);
+	GLAD_LAZY_SET(glColor4bv);
+	GLAD_LAZY_SET(glColor4d);
+	GLAD_LAZY_SET(glColor4dv);
+	GLAD_LAZY_SET(glColor4f);
+	GLAD_LAZY_SET(glColor4fv);
+	GLAD_LAZY_SET(glColor4i);
+	GLAD_LAZY_SET(glColor4iv);
+	GLAD_LAZY_SET(glColor4s);
+	GLAD_LAZY_SET(glColor4sv);
+	GLAD_LAZY_SET(glColor4ub);
+	GLAD_LAZY_SET(glColor4ubv);
+	GLAD_LAZY_SET(glColor4ui);
+	GLAD_LAZY_SET(glColor4uiv);
+	GLAD_LAZY_SET(glColor4us);
+	GLAD_LAZY_SET(glColor4usv);
+	GLAD_LAZY_SET(glEdgeFlag);
+	GLAD_LAZY_SET(glEdgeFlagv);
+	GLAD_LAZY_SET(glEnd);
+	GLAD_LAZY_SET(glIndexd);
+	GLAD_LAZY_SET(glIndexdv);
+	GLAD_LAZY_SET(glIndexf);
+	GLAD_LAZY_SET(glIndexfv);
+	GLAD_LAZY_SET(glIndexi);
+	GLAD_LAZY_SET(glIndexiv);
+	GLAD_LAZY_SET(glIndexs);
+	GLAD_LAZY_SET(glIndexsv);
+	GLAD_LAZY_SET(glNormal3b);
+	GLAD_LAZY_SET(glNormal3bv);
+	GLAD_LAZY_SET(glNormal3d);
+	GLAD_LAZY_SET(glNormal3dv);
+	GLAD_LAZY_SET(glNormal3f);
+	GLAD_LAZY_SET(glNormal3fv);
+	GLAD_LAZY_SET(glNormal3i);
+	GLAD_LAZY_SET(glNormal3iv);
+	GLAD_LAZY_SET(glNormal3s);
+	GLAD_LAZY_SET(glNormal3sv);
+	GLAD_LAZY_SET(glRasterPos2d);
+	GLAD_LAZY_SET(glRasterPos2dv);
+	GLAD_LAZY_SET(glRasterPos2f);
+	GLAD_LAZY_SET(glRasterPos2fv);
+	GLAD_LAZY_SET(glRasterPos2i);
+	GLAD_LAZY_SET(glRasterPos2iv);
+	GLAD_LAZY_SET(glRasterPos2s);
+	GLAD_LAZY_SET(glRasterPos2sv);
+	GLAD_LAZY_SET(glRasterPos3d);
+	GLAD_LAZY_SET(glRasterPos3dv);
+	GLAD_LAZY_SET(glRasterPos3f);
+	GLAD_LAZY_SET(glRasterPos3fv);
+	GLAD_LAZY_SET(glRasterPos3i);
+	GLAD_LAZY_SET(glRasterPos3iv);
+	GLAD_LAZY_SET(glRasterPos3s);
+	GLAD_LAZY_SET(glRasterPos3sv);
+	GLAD_LAZY_SET(glRasterPos4d);
+	GLAD_LAZY_SET(glRasterPos4dv);
+	GLAD_LAZY_SET(glRasterPos4f);
+	GLAD_LAZY_SET(glRasterPos4fv);
+	GLAD_LAZY_SET(glRasterPos4i);
+	GLAD_LAZY_SET(glRasterPos4iv);
+	GLAD_LAZY_SET(glRasterPos4s);
+	GLAD_LAZY_SET(glRasterPos4sv);
+	GLAD_LAZY_SET(glRectd);
+	GLAD_LAZY_SET(glRectdv);
+	GLAD_LAZY_SET(glRectf);
+	GLAD_LAZY_SET(glRectfv);
+	GLAD_LAZY_SET(glRecti);
+	GLAD_LAZY_SET(glRectiv);
+	GLAD_LAZY_SET(glRects);
+	GLAD_LAZY_SET(glRectsv);
+	GLAD_LAZY_SET(glTexCoord1d);
+	GLAD_LAZY_SET(glTexCoord1dv);
+	GLAD_LAZY_SET(glTexCoord1f);
+	GLAD_LAZY_SET(glTexCoord1fv);
+	GLAD_LAZY_SET(glTexCoord1i);
+	GLAD_LAZY_SET(glTexCoord1iv);
+	GLAD_LAZY_SET(glTexCoord1s);
+	GLAD_LAZY_SET(glTexCoord1sv);
+	GLAD_LAZY_SET(glTexCoord2d);
+	GLAD_LAZY_SET(glTexCoord2dv);
+	GLAD_LAZY_SET(glTexCoord2f);
+	GLAD_LAZY_SET(glTexCoord2fv);
+	GLAD_LAZY_SET(glTexCoord2i);
+	GLAD_LAZY_SET(glTexCoord2iv);
+	GLAD_LAZY_SET(glTexCoord2s);
+	GLAD_LAZY_SET(glTexCoord2sv);
+	GLAD_LAZY_SET(glTexCoord3d);
+	GLAD_LAZY_SET(glTexCoord3dv);
+	GLAD_LAZY_SET(glTexCoord3f);
+	GLAD_LAZY_SET(glTexCoord3fv);
+	GLAD_LAZY_SET(glTexCoord3i);
+	GLAD_LAZY_SET(glTexCoord3iv);
+	GLAD_LAZY_SET(glTexCoord3s);
+	GLAD_LAZY_SET(glTexCoord3sv);
+	GLAD_LAZY_SET(glTexCoord4d);
+	GLAD_LAZY_SET(glTexCoord4dv);
+	GLAD_LAZY_SET(glTexCoord4f);
+	GLAD_LAZY_SET(glTexCoord4fv);
+	GLAD_LAZY_SET(glTexCoord4i);
+	GLAD_LAZY_SET(glTexCoord4iv);
+	GLAD_LAZY_SET(glTexCoord4s);
+	GLAD_LAZY_SET(glTexCoord4sv);
+	GLAD_LAZY_SET(glVertex2d);
+	GLAD_LAZY_SET(glVertex2dv);
+	GLAD_LAZY_SET(glVertex2f);
+	GLAD_LAZY_SET(glVertex2fv);
+	GLAD_LAZY_SET(glVertex2i);
+	GLAD_LAZY_SET(glVertex2iv);
+	GLAD_LAZY_SET(glVertex2s);
+	GLAD_LAZY_SET(glVertex2sv);
+	GLAD_LAZY_SET(glVertex3d);
+	GLAD_LAZY_SET(glVertex3dv);
+	GLAD_LAZY_SET(glVertex3f);
+	GLAD_LAZY_SET(glVertex3fv);
+	GLAD_LAZY_SET(glVertex3i);
+	GLAD_LAZY_SET(glVertex3iv);
+	GLAD_LAZY_SET(glVertex3s);
+	GLAD_LAZY_SET(glVertex3sv);
+	GLAD_LAZY_SET(glVertex4d);
+	GLAD_LAZY_SET(glVertex4dv);
+	GLAD_LAZY_SET(glVertex4f);
+	GLAD_LAZY_SET(glVertex4fv);
+	GLAD_LAZY_SET(glVertex4i);
+	GLAD_LAZY_SET(glVertex4iv);
+	GLAD_LAZY_SET(glVertex4s);
+	GLAD_LAZY_SET(glVertex4sv);
+	GLAD_LAZY_SET(glClipPlane);
+	GLAD_LAZY_SET(glColorMaterial);
+	GLAD_LAZY_SET(glFogf);
+	GLAD_LAZY_SET(glFogfv);
+	GLAD_LAZY_SET(glFogi);
+	GLAD_LAZY_SET(glFogiv);
+	GLAD_LAZY_SET(glLightf);
+	GLAD_LAZY_SET(glLightfv);
+	GLAD_LAZY_SET(glLighti);
+	GLAD_LAZY_SET(glLightiv);
+	GLAD_LAZY_SET(glLightModelf);
+	GLAD_LAZY_SET(glLightModelfv);
+	GLAD_LAZY_SET(glLightModeli);
+	GLAD_LAZY_SET(glLightModeliv);
+	GLAD_LAZY_SET(glLineStipple);
+	GLAD_LAZY_SET(glMaterialf);
+	GLAD_LAZY_SET(glMaterialfv);
+	GLAD_LAZY_SET(glMateriali);
+	GLAD_LAZY_SET(glMaterialiv);
+	GLAD_LAZY_SET(glPolygonStipple);
+	GLAD_LAZY_SET(glShadeModel);
+	GLAD_LAZY_SET(glTexEnvf);
+	GLAD_LAZY_SET(glTexEnvfv);
+	GLAD_LAZY_SET(glTexEnvi);
+	GLAD_LAZY_SET(glTexEnviv);
+	GLAD_LAZY_SET(glTexGend);
+	GLAD_LAZY_SET(glTexGendv);
+	GLAD_LAZY_SET(glTexGenf);
+	GLAD_LAZY_SET(glTexGenfv);
+	GLAD_LAZY_SET(glTexGeni);
+	GLAD_LAZY_SET(glTexGeniv);
+	GLAD_LAZY_SET(glFeedbackBuffer);
+	GLAD_LAZY_SET(glSelectBuffer);
+	GLAD_LAZY_SET(glRenderMode);
+	GLAD_LAZY_SET(glInitNames);
+	GLAD_LAZY_SET(glLoadName);
+	GLAD_LAZY_SET(glPassThrough);
+	GLAD_LAZY_SET(glPopName);
+	GLAD_LAZY_SET(glPushName);
+	GLAD_LAZY_SET(glClearAccum);
+	GLAD_LAZY_SET(glClearIndex);
+	GLAD_LAZY_SET(glIndexMask);
+	GLAD_LAZY_SET(glAccum);
+	GLAD_LAZY_SET(glPopAttrib);
+	GLAD_LAZY_SET(glPushAttrib);
+	GLAD_LAZY_SET(glMap1d);
+	GLAD_LAZY_SET(glMap1f);
+	GLAD_LAZY_SET(glMap2d);
+	GLAD_LAZY_SET(glMap2f);
+	GLAD_LAZY_SET(glMapGrid1d);
+	GLAD_LAZY_SET(glMapGrid1f);
+	GLAD_LAZY_SET(glMapGrid2d);
+	GLAD_LAZY_SET(glMapGrid2f);
+	GLAD_LAZY_SET(glEvalCoord1d);
+	GLAD_LAZY_SET(glEvalCoord1dv);
+	GLAD_LAZY_SET(glEvalCoord1f);
+	GLAD_LAZY_SET(glEvalCoord1fv);
+	GLAD_LAZY_SET(glEvalCoord2d);
+	GLAD_LAZY_SET(glEvalCoord2dv);
+	GLAD_LAZY_SET(glEvalCoord2f);
+	GLAD_LAZY_SET(glEvalCoord2fv);
+	GLAD_LAZY_SET(glEvalMesh1);
+	GLAD_LAZY_SET(glEvalPoint1);
+	GLAD_LAZY_SET(glEvalMesh2);
+	GLAD_LAZY_SET(glEvalPoint2);
+	GLAD_LAZY_SET(glAlphaFunc);
+	GLAD_LAZY_SET(glPixelZoom);
+	GLAD_LAZY_SET(glPixelTransferf);
+	GLAD_LAZY_SET(glPixelTransferi);
+	GLAD_LAZY_SET(glPixelMapfv);
+	GLAD_LAZY_SET(glPixelMapuiv);
+	GLAD_LAZY_SET(glPixelMapusv);
+	GLAD_LAZY_SET(glCopyPixels);
+	GLAD_LAZY_SET(glDrawPixels);
+	GLAD_LAZY_SET(glGetClipPlane);
+	GLAD_LAZY_SET(glGetLightfv);
+	GLAD_LAZY_SET(glGetLightiv);
+	GLAD_LAZY_SET(glGetMapdv);
+	GLAD_LAZY_SET(glGetMapfv);
+	GLAD_LAZY_SET(glGetMapiv);
+	GLAD_LAZY_SET(glGetMaterialfv);
+	GLAD_LAZY_SET(glGetMaterialiv);
+	GLAD_LAZY_SET(glGetPixelMapfv);
+	GLAD_LAZY_SET(glGetPixelMapuiv);
+	GLAD_LAZY_SET(glGetPixelMapusv);
+	GLAD_LAZY_SET(glGetPolygonStipple);
+	GLAD_LAZY_SET(glGetTexEnvfv);
+	GLAD_LAZY_SET(glGetTexEnviv);
+	GLAD_LAZY_SET(glGetTexGendv);
+	GLAD_LAZY_SET(glGetTexGenfv);
+	GLAD_LAZY_SET(glGetTexGeniv);
+	GLAD_LAZY_SET(glIsList);
+	GLAD_LAZY_SET(glFrustum);
+	GLAD_LAZY_SET(glLoadIdentity);
+	GLAD_LAZY_SET(glLoadMatrixf);
+	GLAD_LAZY_SET(glLoadMatrixd);
+	GLAD_LAZY_SET(glMatrixMode);
+	GLAD_LAZY_SET(glMultMatrixf);
+	GLAD_LAZY_SET(glMultMatrixd);
+	GLAD_LAZY_SET(glOrtho);
+	GLAD_LAZY_SET(glPopMatrix);
+	GLAD_LAZY_SET(glPushMatrix);
+	GLAD_LAZY_SET(glRotated);
+	GLAD_LAZY_SET(glRotatef);
+	GLAD_LAZY_SET(glScaled);
+	GLAD_LAZY_SET(glScalef);
+	GLAD_LAZY_SET(glTranslated);
+	GLAD_LAZY_SET(glTranslatef);
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	GLAD_LAZY_SET(glDrawArrays);
+	GLAD_LAZY_SET(glDrawElements);
+	GLAD_LAZY_SET(glGetPointerv);
+	GLAD_LAZY_SET(glPolygonOffset);
+	GLAD_LAZY_SET(glCopyTexImage1D);
+	GLAD_LAZY_SET(glCopyTexImage2D);
+	GLAD_LAZY_SET(glCopyTexSubImage1D);
+	GLAD_LAZY_SET(glCopyTexSubImage2D);
+	GLAD_LAZY_SET(glTexSubImage1D);
+	GLAD_LAZY_SET(glTexSubImage2D);
+	GLAD_LAZY_SET(glBindTexture);
+	GLAD_LAZY_SET(glDeleteTextures);
+	GLAD_LAZY_SET(glGenTextures);
+	GLAD_LAZY_SET(glIsTexture);
+	GLAD_LAZY_SET(glArrayElement);
+	GLAD_LAZY_SET(glColorPointer);
+	GLAD_LAZY_SET(glDisableClientState);
+	GLAD_LAZY_SET(glEdgeFlagPointer);
+	GLAD_LAZY_SET(glEnableClientState);
+	GLAD_LAZY_SET(glIndexPointer);
+	GLAD_LAZY_SET(glInterleavedArrays);
+	GLAD_LAZY_SET(glNormalPointer);
+	GLAD_LAZY_SET(glTexCoordPointer);
+	GLAD_LAZY_SET(glVertexPointer);
+	GLAD_LAZY_SET(glAreTexturesResident);
+	GLAD_LAZY_SET(glPrioritizeTextures);
+	GLAD_LAZY_SET(glIndexub);
+	GLAD_LAZY_SET(glIndexubv);
+	GLAD_LAZY_SET(glPopClientAttrib);
+	GLAD_LAZY_SET(glPushClientAttrib);
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	GLAD_LAZY_SET(glDrawRangeElements);
+	GLAD_LAZY_SET(glTexImage3D);
+	GLAD_LAZY_SET(glTexSubImage3D);
+	GLAD_LAZY_SET(glCopyTexSubImage3D);
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	GLAD_LAZY_SET(glActiveTexture);
+	GLAD_LAZY_SET(glSampleCoverage);
+	GLAD_LAZY_SET(glCompressedTexImage3D);
+	GLAD_LAZY_SET(glCompressedTexImage2D);
+	GLAD_LAZY_SET(glCompressedTexImage1D);
+	GLAD_LAZY_SET(glCompressedTexSubImage3D);
+	GLAD_LAZY_SET(glCompressedTexSubImage2D);
+	GLAD_LAZY_SET(glCompressedTexSubImage1D);
+	GLAD_LAZY_SET(glGetCompressedTexImage);
+	GLAD_LAZY_SET(glClientActiveTexture);
+	GLAD_LAZY_SET(glMultiTexCoord1d);
+	GLAD_LAZY_SET(glMultiTexCoord1dv);
+	GLAD_LAZY_SET(glMultiTexCoord1f);
+	GLAD_LAZY_SET(glMultiTexCoord1fv);
+	GLAD_LAZY_SET(glMultiTexCoord1i);
+	GLAD_LAZY_SET(glMultiTexCoord1iv);
+	GLAD_LAZY_SET(glMultiTexCoord1s);
+	GLAD_LAZY_SET(glMultiTexCoord1sv);
+	GLAD_LAZY_SET(glMultiTexCoord2d);
+	GLAD_LAZY_SET(glMultiTexCoord2dv);
+	GLAD_LAZY_SET(glMultiTexCoord2f);
+	GLAD_LAZY_SET(glMultiTexCoord2fv);
+	GLAD_LAZY_SET(glMultiTexCoord2i);
+	GLAD_LAZY_SET(glMultiTexCoord2iv);
+	GLAD_LAZY_SET(glMultiTexCoord2s);
+	GLAD_LAZY_SET(glMultiTexCoord2sv);
+	GLAD_LAZY_SET(glMultiTexCoord3d);
+	GLAD_LAZY_SET(glMultiTexCoord3dv);
+	GLAD_LAZY_SET(glMultiTexCoord3f);
+	GLAD_LAZY_SET(glMultiTexCoord3fv);
+	GLAD_LAZY_SET(glMultiTexCoord3i);
+	GLAD_LAZY_SET(glMultiTexCoord3iv);
+	GLAD_LAZY_SET(glMultiTexCoord3s);
+	GLAD_LAZY_SET(glMultiTexCoord3sv);
+	GLAD_LAZY_SET(glMultiTexCoord4d);
+	GLAD_LAZY_SET(glMultiTexCoord4dv);
+	GLAD_LAZY_SET(glMultiTexCoord4f);
+	GLAD_LAZY_SET(glMultiTexCoord4fv);
+	GLAD_LAZY_SET(glMultiTexCoord4i);
+	GLAD_LAZY_SET(glMultiTexCoord4iv);
+	GLAD_LAZY_SET(glMultiTexCoord4s);
+	GLAD_LAZY_SET(glMultiTexCoord4sv);
+	GLAD_LAZY_SET(glLoadTransposeMatrixf);
+	GLAD_LAZY_SET(glLoadTransposeMatrixd);
+	GLAD_LAZY_SET(glMultTransposeMatrixf);
+	GLAD_LAZY_SET(glMultTransposeMatrixd);
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	GLAD_LAZY_SET(glBlendFuncSeparate);
+	GLAD_LAZY_SET(glMultiDrawArrays);
+	GLAD_LAZY_SET(glMultiDrawElements);
+	GLAD_LAZY_SET(glPointParameterf);
+	GLAD_LAZY_SET(glPointParameterfv);
+	GLAD_LAZY_SET(glPointParameteri);
+	GLAD_LAZY_SET(glPointParameteriv);
+	GLAD_LAZY_SET(glFogCoordf);
+	GLAD_LAZY_SET(glFogCoordfv);
+	GLAD_LAZY_SET(glFogCoordd);
+	GLAD_LAZY_SET(glFogCoorddv);
+	GLAD_LAZY_SET(glFogCoordPointer);
+	GLAD_LAZY_SET(glSecondaryColor3b);
+	GLAD_LAZY_SET(glSecondaryColor3bv);
+	GLAD_LAZY_SET(glSecondaryColor3d);
+	GLAD_LAZY_SET(glSecondaryColor3dv);
+	GLAD_LAZY_SET(glSecondaryColor3f);
+	GLAD_LAZY_SET(glSecondaryColor3fv);
+	GLAD_LAZY_SET(glSecondaryColor3i);
+	GLAD_LAZY_SET(glSecondaryColor3iv);
+	GLAD_LAZY_SET(glSecondaryColor3s);
+	GLAD_LAZY_SET(glSecondaryColor3sv);
+	GLAD_LAZY_SET(glSecondaryColor3ub);
+	GLAD_LAZY_SET(glSecondaryColor3ubv);
+	GLAD_LAZY_SET(glSecondaryColor3ui);
+	GLAD_LAZY_SET(glSecondaryColor3uiv);
+	GLAD_LAZY_SET(glSecondaryColor3us);
+	GLAD_LAZY_SET(glSecondaryColor3usv);
+	GLAD_LAZY_SET(glSecondaryColorPointer);
+	GLAD_LAZY_SET(glWindowPos2d);
+	GLAD_LAZY_SET(glWindowPos2dv);
+	GLAD_LAZY_SET(glWindowPos2f);
+	GLAD_LAZY_SET(glWindowPos2fv);
+	GLAD_LAZY_SET(glWindowPos2i);
+	GLAD_LAZY_SET(glWindowPos2iv);
+	GLAD_LAZY_SET(glWindowPos2s);
+	GLAD_LAZY_SET(glWindowPos2sv);
+	GLAD_LAZY_SET(glWindowPos3d);
+	GLAD_LAZY_SET(glWindowPos3dv);
+	GLAD_LAZY_SET(glWindowPos3f);
+	GLAD_LAZY_SET(glWindowPos3fv);
+	GLAD_LAZY_SET(glWindowPos3i);
+	GLAD_LAZY_SET(glWindowPos3iv);
+	GLAD_LAZY_SET(glWindowPos3s);
+	GLAD_LAZY_SET(glWindowPos3sv);
+	GLAD_LAZY_SET(glBlendColor);
+	GLAD_LAZY_SET(glBlendEquation);
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	GLAD_LAZY_SET(glGenQueries);
+	GLAD_LAZY_SET(glDeleteQueries);
+	GLAD_LAZY_SET(glIsQuery);
+	GLAD_LAZY_SET(glBeginQuery);
+	GLAD_LAZY_SET(glEndQuery);
+	GLAD_LAZY_SET(glGetQueryiv);
+	GLAD_LAZY_SET(glGetQueryObjectiv);
+	GLAD_LAZY_SET(glGetQueryObjectuiv);
+	GLAD_LAZY_SET(glBindBuffer);
+	GLAD_LAZY_SET(glDeleteBuffers);
+	GLAD_LAZY_SET(glGenBuffers);
+	GLAD_LAZY_SET(glIsBuffer);
+	GLAD_LAZY_SET(glBufferData);
+	GLAD_LAZY_SET(glBufferSubData);
+	GLAD_LAZY_SET(glGetBufferSubData);
+	GLAD_LAZY_SET(glMapBuffer);
+	GLAD_LAZY_SET(glUnmapBuffer);
+	GLAD_LAZY_SET(glGetBufferParameteriv);
+	GLAD_LAZY_SET(glGetBufferPointerv);
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	GLAD_LAZY_SET(glBlendEquationSeparate);
+	GLAD_LAZY_SET(glDrawBuffers);
+	GLAD_LAZY_SET(glStencilOpSeparate);
+	GLAD_LAZY_SET(glStencilFuncSeparate);
+	GLAD_LAZY_SET(glStencilMaskSeparate);
+	GLAD_LAZY_SET(glAttachShader);
+	GLAD_LAZY_SET(glBindAttribLocation);
+	GLAD_LAZY_SET(glCompileShader);
+	GLAD_LAZY_SET(glCreateProgram);
+	GLAD_LAZY_SET(glCreateShader);
+	GLAD_LAZY_SET(glDeleteProgram);
+	GLAD_LAZY_SET(glDeleteShader);
+	GLAD_LAZY_SET(glDetachShader);
+	GLAD_LAZY_SET(glDisableVertexAttribArray);
+	GLAD_LAZY_SET(glEnableVertexAttribArray);
+	GLAD_LAZY_SET(glGetActiveAttrib);
+	GLAD_LAZY_SET(glGetActiveUniform);
+	GLAD_LAZY_SET(glGetAttachedShaders);
+	GLAD_LAZY_SET(glGetAttribLocation);
+	GLAD_LAZY_SET(glGetProgramiv);
+	GLAD_LAZY_SET(glGetProgramInfoLog);
+	GLAD_LAZY_SET(glGetShaderiv);
+	GLAD_LAZY_SET(glGetShaderInfoLog);
+	GLAD_LAZY_SET(glGetShaderSource);
+	GLAD_LAZY_SET(glGetUniformLocation);
+	GLAD_LAZY_SET(glGetUniformfv);
+	GLAD_LAZY_SET(glGetUniformiv);
+	GLAD_LAZY_SET(glGetVertexAttribdv);
+	GLAD_LAZY_SET(glGetVertexAttribfv);
+	GLAD_LAZY_SET(glGetVertexAttribiv);
+	GLAD_LAZY_SET(glGetVertexAttribPointerv);
+	GLAD_LAZY_SET(glIsProgram);
+	GLAD_LAZY_SET(glIsShader);
+	GLAD_LAZY_SET(glLinkProgram);
+	GLAD_LAZY_SET(glShaderSource);
+	GLAD_LAZY_SET(glUseProgram);
+	GLAD_LAZY_SET(glUniform1f);
+	GLAD_LAZY_SET(glUniform2f);
+	GLAD_LAZY_SET(glUniform3f);
+	GLAD_LAZY_SET(glUniform4f);
+	GLAD_LAZY_SET(glUniform1i);
+	GLAD_LAZY_SET(glUniform2i);
+	GLAD_LAZY_SET(glUniform3i);
+	GLAD_LAZY_SET(glUniform4i);
+	GLAD_LAZY_SET(glUniform1fv);
+	GLAD_LAZY_SET(glUniform2fv);
+	GLAD_LAZY_SET(glUniform3fv);
+	GLAD_LAZY_SET(glUniform4fv);
+	GLAD_LAZY_SET(glUniform1iv);
+	GLAD_LAZY_SET(glUniform2iv);
+	GLAD_LAZY_SET(glUniform3iv);
+	GLAD_LAZY_SET(glUniform4iv);
+	GLAD_LAZY_SET(glUniformMatrix2fv);
+	GLAD_LAZY_SET(glUniformMatrix3fv);
+	GLAD_LAZY_SET(glUniformMatrix4fv);
+	GLAD_LAZY_SET(glValidateProgram);
+	GLAD_LAZY_SET(glVertexAttrib1d);
+	GLAD_LAZY_SET(glVertexAttrib1dv);
+	GLAD_LAZY_SET(glVertexAttrib1f);
+	GLAD_LAZY_SET(glVertexAttrib1fv);
+	GLAD_LAZY_SET(glVertexAttrib1s);
+	GLAD_LAZY_SET(glVertexAttrib1sv);
+	GLAD_LAZY_SET(glVertexAttrib2d);
+	GLAD_LAZY_SET(glVertexAttrib2dv);
+	GLAD_LAZY_SET(glVertexAttrib2f);
+	GLAD_LAZY_SET(glVertexAttrib2fv);
+	GLAD_LAZY_SET(glVertexAttrib2s);
+	GLAD_LAZY_SET(glVertexAttrib2sv);
+	GLAD_LAZY_SET(glVertexAttrib3d);
+	GLAD_LAZY_SET(glVertexAttrib3dv);
+	GLAD_LAZY_SET(glVertexAttrib3f);
+	GLAD_LAZY_SET(glVertexAttrib3fv);
+	GLAD_LAZY_SET(glVertexAttrib3s);
+	GLAD_LAZY_SET(glVertexAttrib3sv);
+	GLAD_LAZY_SET(glVertexAttrib4Nbv);
+	GLAD_LAZY_SET(glVertexAttrib4Niv);
+	GLAD_LAZY_SET(glVertexAttrib4Nsv);
+	GLAD_LAZY_SET(glVertexAttrib4Nub);
+	GLAD_LAZY_SET(glVertexAttrib4Nubv);
+	GLAD_LAZY_SET(glVertexAttrib4Nuiv);
+	GLAD_LAZY_SET(glVertexAttrib4Nusv);
+	GLAD_LAZY_SET(glVertexAttrib4bv);
+	GLAD_LAZY_SET(glVertexAttrib4d);
+	GLAD_LAZY_SET(glVertexAttrib4dv);
+	GLAD_LAZY_SET(glVertexAttrib4f);
+	GLAD_LAZY_SET(glVertexAttrib4fv);
+	GLAD_LAZY_SET(glVertexAttrib4iv);
+	GLAD_LAZY_SET(glVertexAttrib4s);
+	GLAD_LAZY_SET(glVertexAttrib4sv);
+	GLAD_LAZY_SET(glVertexAttrib4ubv);
+	GLAD_LAZY_SET(glVertexAttrib4uiv);
+	GLAD_LAZY_SET(glVertexAttrib4usv);
+	GLAD_LAZY_SET(glVertexAttribPointer);
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	GLAD_LAZY_SET(glUniformMatrix2x3fv);
+	GLAD_LAZY_SET(glUniformMatrix3x2fv);
+	GLAD_LAZY_SET(glUniformMatrix2x4fv);
+	GLAD_LAZY_SET(glUniformMatrix4x2fv);
+	GLAD_LAZY_SET(glUniformMatrix3x4fv);
+	GLAD_LAZY_SET(glUniformMatrix4x3fv);
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	GLAD_LAZY_SET(glColorMaski);
+	GLAD_LAZY_SET(glGetBooleani_v);
+	GLAD_LAZY_SET(glGetIntegeri_v);
+	GLAD_LAZY_SET(glEnablei);
+	GLAD_LAZY_SET(glDisablei);
+	GLAD_LAZY_SET(glIsEnabledi);
+	GLAD_LAZY_SET(glBeginTransformFeedback);
+	GLAD_LAZY_SET(glEndTransformFeedback);
+	GLAD_LAZY_SET(glBindBufferRange);
+	GLAD_LAZY_SET(glBindBufferBase);
+	GLAD_LAZY_SET(glTransformFeedbackVaryings);
+	GLAD_LAZY_SET(glGetTransformFeedbackVarying);
+	GLAD_LAZY_SET(glClampColor);
+	GLAD_LAZY_SET(glBeginConditionalRender);
+	GLAD_LAZY_SET(glEndConditionalRender);
+	GLAD_LAZY_SET(glVertexAttribIPointer);
+	GLAD_LAZY_SET(glGetVertexAttribIiv);
+	GLAD_LAZY_SET(glGetVertexAttribIuiv);
+	GLAD_LAZY_SET(glVertexAttribI1i);
+	GLAD_LAZY_SET(glVertexAttribI2i);
+	GLAD_LAZY_SET(glVertexAttribI3i);
+	GLAD_LAZY_SET(glVertexAttribI4i);
+	GLAD_LAZY_SET(glVertexAttribI1ui);
+	GLAD_LAZY_SET(glVertexAttribI2ui);
+	GLAD_LAZY_SET(glVertexAttribI3ui);
+	GLAD_LAZY_SET(glVertexAttribI4ui);
+	GLAD_LAZY_SET(glVertexAttribI1iv);
+	GLAD_LAZY_SET(glVertexAttribI2iv);
+	GLAD_LAZY_SET(glVertexAttribI3iv);
+	GLAD_LAZY_SET(glVertexAttribI4iv);
+	GLAD_LAZY_SET(glVertexAttribI1uiv);
+	GLAD_LAZY_SET(glVertexAttribI2uiv);
+	GLAD_LAZY_SET(glVertexAttribI3uiv);
+	GLAD_LAZY_SET(glVertexAttribI4uiv);
+	GLAD_LAZY_SET(glVertexAttribI4bv);
+	GLAD_LAZY_SET(glVertexAttribI4sv);
+	GLAD_LAZY_SET(glVertexAttribI4ubv);
+	GLAD_LAZY_SET(glVertexAttribI4usv);
+	GLAD_LAZY_SET(glGetUniformuiv);
+	GLAD_LAZY_SET(glBindFragDataLocation);
+	GLAD_LAZY_SET(glGetFragDataLocation);
+	GLAD_LAZY_SET(glUniform1ui);
+	GLAD_LAZY_SET(glUniform2ui);
+	GLAD_LAZY_SET(glUniform3ui);
+	GLAD_LAZY_SET(glUniform4ui);
+	GLAD_LAZY_SET(glUniform1uiv);
+	GLAD_LAZY_SET(glUniform2uiv);
+	GLAD_LAZY_SET(glUniform3uiv);
+	GLAD_LAZY_SET(glUniform4uiv);
+	GLAD_LAZY_SET(glTexParameterIiv);
+	GLAD_LAZY_SET(glTexParameterIuiv);
+	GLAD_LAZY_SET(glGetTexParameterIiv);
+	GLAD_LAZY_SET(glGetTexParameterIuiv);
+	GLAD_LAZY_SET(glClearBufferiv);
+	GLAD_LAZY_SET(glClearBufferuiv);
+	GLAD_LAZY_SET(glClearBufferfv);
+	GLAD_LAZY_SET(glClearBufferfi);
+	GLAD_LAZY_SET(glGetStringi);
+	GLAD_LAZY_SET(glIsRenderbuffer);
+	GLAD_LAZY_SET(glBindRenderbuffer);
+	GLAD_LAZY_SET(glDeleteRenderbuffers);
+	GLAD_LAZY_SET(glGenRenderbuffers);
+	GLAD_LAZY_SET(glRenderbufferStorage);
+	GLAD_LAZY_SET(glGetRenderbufferParameteriv);
+	GLAD_LAZY_SET(glIsFramebuffer);
+	GLAD_LAZY_SET(glBindFramebuffer);
+	GLAD_LAZY_SET(glDeleteFramebuffers);
+	GLAD_LAZY_SET(glGenFramebuffers);
+	GLAD_LAZY_SET(glCheckFramebufferStatus);
+	GLAD_LAZY_SET(glFramebufferTexture1D);
+	GLAD_LAZY_SET(glFramebufferTexture2D);
+	GLAD_LAZY_SET(glFramebufferTexture3D);
+	GLAD_LAZY_SET(glFramebufferRenderbuffer);
+	GLAD_LAZY_SET(glGetFramebufferAttachmentParameteriv);
+	GLAD_LAZY_SET(glGenerateMipmap);
+	GLAD_LAZY_SET(glBlitFramebuffer);
+	GLAD_LAZY_SET(glRenderbufferStorageMultisample);
+	GLAD_LAZY_SET(glFramebufferTextureLayer);
+	GLAD_LAZY_SET(glMapBufferRange);
+	GLAD_LAZY_SET(glFlushMappedBufferRange);
+	GLAD_LAZY_SET(glBindVertexArray);
+	GLAD_LAZY_SET(glDeleteVertexArrays);
+	GLAD_LAZY_SET(glGenVertexArrays);
+	GLAD_LAZY_SET(glIsVertexArray);
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	GLAD_LAZY_SET(glDrawArraysInstanced);
+	GLAD_LAZY_SET(glDrawElementsInstanced);
+	GLAD_LAZY_SET(glTexBuffer);
+	GLAD_LAZY_SET(glPrimitiveRestartIndex);
+	GLAD_LAZY_SET(glCopyBufferSubData);
+	GLAD_LAZY_SET(glGetUniformIndices);
+	GLAD_LAZY_SET(glGetActiveUniformsiv);
+	GLAD_LAZY_SET(glGetActiveUniformName);
+	GLAD_LAZY_SET(glGetUniformBlockIndex);
+	GLAD_LAZY_SET(glGetActiveUniformBlockiv);
+	GLAD_LAZY_SET(glGetActiveUniformBlockName);
+	GLAD_LAZY_SET(glUniformBlockBinding);
+	GLAD_LAZY_SET(glBindBufferRange);
+	GLAD_LAZY_SET(glBindBufferBase);
+	GLAD_LAZY_SET(glGetIntegeri_v);
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	GLAD_LAZY_SET(glDrawElementsBaseVertex);
+	GLAD_LAZY_SET(glDrawRangeElementsBaseVertex);
+	GLAD_LAZY_SET(glDrawElementsInstancedBaseVertex);
+	GLAD_LAZY_SET(glMultiDrawElementsBaseVertex);
+	GLAD_LAZY_SET(glProvokingVertex);
+	GLAD_LAZY_SET(glFenceSync);
+	GLAD_LAZY_SET(glIsSync);
+	GLAD_LAZY_SET(glDeleteSync);
+	GLAD_LAZY_SET(glClientWaitSync);
+	GLAD_LAZY_SET(glWaitSync);
+	GLAD_LAZY_SET(glGetInteger64v);
+	GLAD_LAZY_SET(glGetSynciv);
+	GLAD_LAZY_SET(glGetInteger64i_v);
+	GLAD_LAZY_SET(glGetBufferParameteri64v);
+	GLAD_LAZY_SET(glFramebufferTexture);
+	GLAD_LAZY_SET(glTexImage2DMultisample);
+	GLAD_LAZY_SET(glTexImage3DMultisample);
+	GLAD_LAZY_SET(glGetMultisamplefv);
+	GLAD_LAZY_SET(glSampleMaski);
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	GLAD_LAZY_SET(glBindFragDataLocationIndexed);
+	GLAD_LAZY_SET(glGetFragDataIndex);
+	GLAD_LAZY_SET(glGenSamplers);
+	GLAD_LAZY_SET(glDeleteSamplers);
+	GLAD_LAZY_SET(glIsSampler);
+	GLAD_LAZY_SET(glBindSampler);
+	GLAD_LAZY_SET(glSamplerParameteri);
+	GLAD_LAZY_SET(glSamplerParameteriv);
+	GLAD_LAZY_SET(glSamplerParameterf);
+	GLAD_LAZY_SET(glSamplerParameterfv);
+	GLAD_LAZY_SET(glSamplerParameterIiv);
+	GLAD_LAZY_SET(glSamplerParameterIuiv);
+	GLAD_LAZY_SET(glGetSamplerParameteriv);
+	GLAD_LAZY_SET(glGetSamplerParameterIiv);
+	GLAD_LAZY_SET(glGetSamplerParameterfv);
+	GLAD_LAZY_SET(glGetSamplerParameterIuiv);
+	GLAD_LAZY_SET(glQueryCounter);
+	GLAD_LAZY_SET(glGetQueryObjecti64v);
+	GLAD_LAZY_SET(glGetQueryObjectui64v);
+	GLAD_LAZY_SET(glVertexAttribDivisor);
+	GLAD_LAZY_SET(glVertexAttribP1ui);
+	GLAD_LAZY_SET(glVertexAttribP1uiv);
+	GLAD_LAZY_SET(glVertexAttribP2ui);
+	GLAD_LAZY_SET(glVertexAttribP2uiv);
+	GLAD_LAZY_SET(glVertexAttribP3ui);
+	GLAD_LAZY_SET(glVertexAttribP3uiv);
+	GLAD_LAZY_SET(glVertexAttribP4ui);
+	GLAD_LAZY_SET(glVertexAttribP4uiv);
+	GLAD_LAZY_SET(glVertexP2ui);
+	GLAD_LAZY_SET(glVertexP2uiv);
+	GLAD_LAZY_SET(glVertexP3ui);
+	GLAD_LAZY_SET(glVertexP3uiv);
+	GLAD_LAZY_SET(glVertexP4ui);
+	GLAD_LAZY_SET(glVertexP4uiv);
+	GLAD_LAZY_SET(glTexCoordP1ui);
+	GLAD_LAZY_SET(glTexCoordP1uiv);
+	GLAD_LAZY_SET(glTexCoordP2ui);
+	GLAD_LAZY_SET(glTexCoordP2uiv);
+	GLAD_LAZY_SET(glTexCoordP3ui);
+	GLAD_LAZY_SET(glTexCoordP3uiv);
+	GLAD_LAZY_SET(glTexCoordP4ui);
+	GLAD_LAZY_SET(glTexCoordP4uiv);
+	GLAD_LAZY_SET(glMultiTexCoordP1ui);
+	GLAD_LAZY_SET(glMultiTexCoordP1uiv);
+	GLAD_LAZY_SET(glMultiTexCoordP2ui);
+	GLAD_LAZY_SET(glMultiTexCoordP2uiv);
+	GLAD_LAZY_SET(glMultiTexCoordP3ui);
+	GLAD_LAZY_SET(glMultiTexCoordP3uiv);
+	GLAD_LAZY_SET(glMultiTexCoordP4ui);
+	GLAD_LAZY_SET(glMultiTexCoordP4uiv);
+	GLAD_LAZY_SET(glNormalP3ui);
+	GLAD_LAZY_SET(glNormalP3uiv);
+	GLAD_LAZY_SET(glColorP3ui);
+	GLAD_LAZY_SET(glColorP3uiv);
+	GLAD_LAZY_SET(glColorP4ui);
+	GLAD_LAZY_SET(glColorP4uiv);
+	GLAD_LAZY_SET(glSecondaryColorP3ui);
+	GLAD_LAZY_SET(glSecondaryColorP3uiv);
+}
+static void lazy_GL_ARB_buffer_storage(void) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	GLAD_LAZY_SET(glBufferStorage);
+}
+static void lazy_GL_ARB_get_program_binary(void) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	GLAD_LAZY_SET(glGetProgramBinary);
+	GLAD_LAZY_SET(glProgramBinary);
+	GLAD_LAZY_SET(glProgramParameteri);
+}
+static void lazy_GL_KHR_parallel_shader_compile(void) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	GLAD_LAZY_SET(glMaxShaderCompilerThreadsKHR);
+}
+static void lazy_GL_ARB_parallel_shader_compile(void) {
+	if(!GLAD_GL_ARB_parallel_shader_compile) return;
+	GLAD_LAZY_SET(glMaxShaderCompilerThreadsARB);
+}
+static void lazy_GL_ARB_clip_control(void) {
+	if(!GLAD_GL_ARB_clip_control) return;
+	GLAD_LAZY_SET(glClipControl);
+}
+/*
+ * The extensions glad knows, sorted by name: each extension the driver reports is looked up with a
+ * binary search instead of being copied and compared against every name. The result is kept as a
+ * bit per entry, keyed by the driver's vendor, renderer and version strings, so loading into
+ * another context of the same driver doesn't enumerate extensions at all. Like the rest of glad,
+ * loads must not run on several threads at once.
+ */
+struct glad_extension {
+    const char *name;
+    int *flag;
+};
+static const struct glad_extension glad_extensions[] = {
+    { "GL_ARB_buffer_storage", &GLAD_GL_ARB_buffer_storage },
+    { "GL_ARB_clip_control", &GLAD_GL_ARB_clip_control },
+    { "GL_ARB_get_program_binary", &GLAD_GL_ARB_get_program_binary },
+    { "GL_ARB_parallel_shader_compile", &GLAD_GL_ARB_parallel_shader_compile },
+    { "GL_ARB_texture_compression_bptc", &GLAD_GL_ARB_texture_compression_bptc },
+    { "GL_EXT_texture_compression_s3tc", &GLAD_GL_EXT_texture_compression_s3tc },
+    { "GL_EXT_texture_sRGB", &GLAD_GL_EXT_texture_sRGB },
+    { "GL_KHR_parallel_shader_compile", &GLAD_GL_KHR_parallel_shader_compile }
+};
+#define GLAD_EXTENSION_COUNT (sizeof(glad_extensions) / sizeof(glad_extensions[0]))
+
+static int glad_ext_cached = 0;
+static unsigned long long glad_ext_key;
+static unsigned int glad_ext_bits;
+
+static int find_ext(const char *ext) {
+    int low = 0, high = (int)GLAD_EXTENSION_COUNT - 1;
+
+    while(low <= high) {
+        int middle = (low + high) / 2;
+        int order = strcmp(ext, glad_extensions[middle].name);
+
+        if(order == 0) {
+            return middle;
+        }
+        if(order < 0) {
+            high = middle - 1;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return -1;
+}
+
+/* a space separated list, as GL_EXTENSIONS is before 3.0 */
+static int has_ext_in(const char *extensions, const char *ext) {
+    const char *loc;
+    const char *terminator;
+
+    if(extensions == NULL) {
+        return 0;
+    }
+    while(1) {
+        loc = strstr(extensions, ext);
+        if(loc == NULL) {
+            return 0;
+        }
+
+        terminator = loc + strlen(ext);
+        if((loc == extensions || *(loc - 1) == ' ') &&
+            (*terminator == ' ' || *terminator == '\0')) {
+            return 1;
+        }
+        extensions = terminator;
+    }
+}
+
+static unsigned int get_ext_bits(void) {
+    unsigned int bits = 0, i;
+
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major >= 3) {
+        GLint count = 0, index;
+
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for(index = 0; index < count; index++) {
+            const char *ext = (const char *)glGetStringi(GL_EXTENSIONS, (GLuint)index);
+            int found = ext != NULL ? find_ext(ext) : -1;
+
+            if(found >= 0) {
+                bits |= 1u << found;
+            }
+        }
+        return bits;
+    }
+#endif
+    {
+        const char *extensions = (const char *)glGetString(GL_EXTENSIONS);
+
+        for(i = 0; i < GLAD_EXTENSION_COUNT; i++) {
+            if(has_ext_in(extensions, glad_extensions[i].name)) {
+                bits |= 1u << i;
+            }
+        }
+    }
+    return bits;
+}
+
+/* FNV-1a over a string and its terminator */
+static unsigned long long hash_gl_string(unsigned long long hash, GLenum name) {
+    const char *s = (const char *)glGetString(name);
+
+    if(s != NULL) {
+        for(; *s; s++) {
+            hash = (hash ^ (unsigned char)*s) * 0x100000001b3ULL;
+        }
+    }
+    return hash * 0x100000001b3ULL;
+}
+
 static int find_extensionsGL(void) {
-	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	unsigned long long key = 0xcbf29ce484222325ULL;
+	unsigned int i;
+	key = hash_gl_string(key, GL_VENDOR);
+	key = hash_gl_string(key, GL_RENDERER);
+	key = hash_gl_string(key, GL_VERSION);
+	if (!glad_ext_cached || key != glad_ext_key) {
+		glad_ext_bits = get_ext_bits();
+		glad_ext_key = key;
+		glad_ext_cached = 1;
+	}
+	for (i = 0; i < GLAD_EXTENSION_COUNT; i++)
+		*glad_extensions[i].flag = (glad_ext_bits >> i) & 1;
 	return 1;
 }
 
@@ -1835,6 +3451,41 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_buffer_storage(load);
+	load_GL_ARB_get_program_binary(load);
+	load_GL_KHR_parallel_shader_compile(load);
+	load_GL_ARB_parallel_shader_compile(load);
+	load_GL_ARB_clip_control(load);
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_reset = load != glad_lazy_load;
+	glad_lazy_load = load;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+
+	if (!find_extensionsGL()) return 0;
+	lazy_GL_ARB_buffer_storage();
+	lazy_GL_ARB_get_program_binary();
+	lazy_GL_KHR_parallel_shader_compile();
+	lazy_GL_ARB_parallel_shader_compile();
+	lazy_GL_ARB_clip_control();
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
@@ -0,0 +1,32 @@
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include <mip.h>
+
+// where one packed image ended up: sample the array at
+// vec3(uv_rect.xy + uv * uv_rect.zw, layer)
+struct atlas_region
+{
+    float uv_rect[4];           // offset.xy, scale.xy in normalized layer coordinates
+    float layer;
+};
+
+// many small images packed into the layers of one GL_TEXTURE_2D_ARRAY, so draws that only differ
+// by which of them they sample can share a texture binding
+struct atlas
+{
+    unsigned int texture;
+    int size;                   // width and height of every layer
+    unsigned int layer_count;
+    unsigned int level_count;
+};
+
+// packs images (skyline, bottom-left) into as many size x size layers as they need and uploads them
+// with level_count mips each. every image gets a gutter of repeated edge texels and a position
+// aligned to its coarsest mip, so filtering and mipmapping never bleed between neighbours. fills
+// regions[i] for images[i]. returns 0 if an image is larger than a layer or out of memory.
+int atlas_build(struct atlas *atlas, const struct mip_level *images, unsigned int count, int size,
+    unsigned int level_count, int srgb, struct atlas_region *regions);
+void atlas_destroy(struct atlas *atlas);
+
+#endif
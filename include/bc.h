@@ -0,0 +1,41 @@
+#ifndef BC_H
+#define BC_H
+
+#include <mip.h>
+#include <thread_pool.h>
+
+#include <stddef.h>
+
+// block compressed formats, each covering 4x4 texels
+enum bc_format
+{
+    BC_FORMAT_BC1,      // RGB, 8 bytes per block (DXT1)
+    BC_FORMAT_BC3,      // RGBA, BC1 color plus a BC4 alpha block (DXT5)
+    BC_FORMAT_BC4,      // R, 8 bytes (RGTC1)
+    BC_FORMAT_BC5,      // RG, two BC4 blocks (RGTC2), for normal maps
+    BC_FORMAT_BC7       // RGBA, 16 bytes (BPTC); written as mode 6
+};
+
+enum bc_quality
+{
+    BC_QUALITY_FAST,    // principal axis endpoints, one index pass: for iterating on assets
+    BC_QUALITY_HIGH     // least squares endpoint refinement and wider searches: for shipping
+};
+
+size_t bc_block_size(enum bc_format format);
+// bytes of one width x height image, partial blocks at the edges included
+size_t bc_image_size(enum bc_format format, int width, int height);
+
+// rgba is 4x4 RGBA8 texels, row by row
+void bc_encode_block(enum bc_format format, enum bc_quality quality, const unsigned char *rgba, unsigned char *block);
+// the inverse, for checking quality. BC7 blocks in modes other than 6 decode to magenta.
+void bc_decode_block(enum bc_format format, const unsigned char *block, unsigned char *rgba);
+
+// encodes a whole RGBA8 image into out (bc_image_size bytes); rows of blocks are split across the
+// pool when one is given. edge blocks repeat the last row and column.
+void bc_encode(const struct mip_level *image, enum bc_format format, enum bc_quality quality,
+    struct thread_pool *pool, unsigned char *out);
+// decodes to RGBA8 (width * height * 4 bytes)
+void bc_decode(enum bc_format format, const unsigned char *data, int width, int height, unsigned char *rgba);
+
+#endif
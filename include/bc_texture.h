@@ -0,0 +1,35 @@
+#ifndef BC_TEXTURE_H
+#define BC_TEXTURE_H
+
+#include <bc.h>
+#include <mip.h>
+#include <thread_pool.h>
+
+// extension of block compressed texture files
+#define BC_TEXTURE_EXTENSION ".bct"
+
+// a block compressed mip chain as stored on disk. levels[i].pixels holds the blocks of level i and
+// levels[i].size their byte count, ready for glCompressedTexImage2D.
+struct bc_texture
+{
+    enum bc_format format;
+    int srgb;
+    unsigned int level_count;
+    struct mip_level levels[MIP_MAX_LEVELS];
+};
+
+// compresses every level of an RGBA8 chain. returns 0 if out of memory.
+int bc_texture_build(struct bc_texture *texture, const struct mip_level *levels, unsigned int level_count,
+    enum bc_format format, int srgb, enum bc_quality quality, struct thread_pool *pool);
+int bc_texture_save(const struct bc_texture *texture, const char *path);
+int bc_texture_load(const char *path, struct bc_texture *texture);
+// parses a file already in memory
+int bc_texture_decode(const unsigned char *data, size_t size, struct bc_texture *texture);
+void bc_texture_free(struct bc_texture *texture);
+
+// GL internal format for glCompressedTexImage2D
+unsigned int bc_texture_gl_format(enum bc_format format, int srgb);
+// whether the current context can sample the format; others have to be decoded on the CPU
+int bc_texture_supported(enum bc_format format, int srgb);
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <frustum.h>
+#include <uniforms.h>
+
+// a free-flying perspective camera. it renders reversed-Z with the far plane at infinity: depth is
+// 1 at the near plane and falls towards 0 with distance, so depth is cleared to 0 and tested with
+// GL_GREATER (see camera_setup_depth).
+struct camera
+{
+    float position[3];
+    float yaw;                  // radians around +y; 0 looks down -z
+    float pitch;                // radians, positive looks up
+    float fov_y;                // vertical field of view in radians
+    float aspect;               // width / height
+    float near;
+    int zero_to_one;            // clip depth range is [0, 1] (clip control) rather than [-1, 1]
+    // derived by camera_update
+    float view[16];
+    float projection[16];
+    float view_projection[16];
+    struct frustum frustum;     // planes of view_projection, what the CPU culls with
+};
+
+void camera_init(struct camera *camera, float fov_y, float aspect, float near, int zero_to_one);
+
+// rebuilds the matrices and the frustum after the members above changed
+void camera_update(struct camera *camera);
+
+// unit vectors the camera looks along and to its right, from yaw and pitch
+void camera_axes(const struct camera *camera, float *forward, float *right);
+
+// copies the matrices and position into the Frame block
+void camera_fill_uniforms(const struct camera *camera, struct frame_uniforms *frame);
+
+// sets the GL depth state for reversed-Z. with clip control the clip depth range becomes [0, 1],
+// which keeps the float precision that [-1, 1] loses when mapping to window depth. returns whether
+// it did, for camera_init.
+int camera_setup_depth(void);
+
+#endif
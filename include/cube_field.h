@@ -0,0 +1,18 @@
+#ifndef CUBE_FIELD_H
+#define CUBE_FIELD_H
+
+#include <mesh.h>
+
+// the demo's scene: unit cubes in a grid below the camera, rolling gently in height. main renders
+// it, and the benchmarks and golden images draw the same layout, so they measure what the demo does.
+#define CUBE_FIELD_SIZE 32      // cubes on a side
+#define CUBE_FIELD_COUNT (CUBE_FIELD_SIZE * CUBE_FIELD_SIZE)
+#define CUBE_FIELD_SPACING 3.0f // from one cube's center to the next
+
+// a unit cube around the origin with a normal per face. returns 0 if out of memory.
+int cube_mesh_create(struct mesh_data *mesh);
+
+// the center of cube index, in [0, CUBE_FIELD_COUNT); rows run along x
+void cube_field_position(unsigned int index, float *position);
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+// axis aligned bounding box
+struct aabb
+{
+    float min[3];
+    float max[3];
+};
+
+// the planes of a view volume, normals pointing in: a point p is inside when
+// dot(plane.xyz, p) + plane.w >= 0 for every plane. planes the projection pushes to infinity (the
+// far plane of an infinite projection) are left out.
+struct frustum
+{
+    float planes[6][4];
+    unsigned int plane_count;
+};
+
+// extracts the planes from the very matrix the shaders transform with, so the CPU culls against
+// exactly what the GPU clips. zero_to_one is the clip depth range the projection was built for.
+void frustum_from_matrix(struct frustum *frustum, const float *view_projection, int zero_to_one);
+
+// 0 when the box is certainly outside; boxes straddling a corner may pass
+int frustum_test_aabb(const struct frustum *frustum, const struct aabb *box);
+
+// writes the indices of the boxes that pass to visible and returns their number
+unsigned int frustum_cull(const struct frustum *frustum, const struct aabb *boxes, unsigned int count,
+    unsigned int *visible);
+
+// world bounds of a box moved by a column-major model matrix
+void aabb_transform(struct aabb *out, const struct aabb *box, const float *model);
+
+#endif
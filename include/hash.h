@@ -0,0 +1,36 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HASH_SEED 0xcbf29ce484222325ULL
+
+// 64-bit FNV-1a. chain calls by passing the previous result as the seed.
+static inline uint64_t hash_bytes(uint64_t seed, const void *data, size_t size)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    uint64_t h = seed;
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        h ^= p[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+// hashes a NUL-terminated string including its terminator, so "ab"+"c" and "a"+"bc" differ
+static inline uint64_t hash_string(uint64_t seed, const char *str)
+{
+    size_t len = 0;
+
+    if (str == NULL)
+        return hash_bytes(seed, "", 1);
+    while (str[len])
+        len++;
+    return hash_bytes(seed, str, len + 1);
+}
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include <stddef.h>
+
+// 8-bit RGBA pixels, rows stored bottom to top as glTexImage2D expects
+struct image
+{
+    int width;
+    int height;
+    unsigned char *pixels;
+};
+
+// decodes a PNG (not interlaced), an uncompressed or RLE truecolor TGA, or a binary PPM (P6).
+// returns 0 on failure.
+int image_load(const char *path, struct image *image);
+int image_decode(const unsigned char *data, size_t size, struct image *image);
+void image_free(struct image *image);
+
+#endif
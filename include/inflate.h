@@ -0,0 +1,10 @@
+#ifndef INFLATE_H
+#define INFLATE_H
+
+#include <stddef.h>
+
+// decompresses a zlib stream (RFC 1950/1951) into dst, which must have room for all of it. the
+// Adler-32 trailer is checked. returns the decompressed size, or 0 on malformed input or overflow.
+size_t inflate_zlib(const unsigned char *src, size_t size, unsigned char *dst, size_t capacity);
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef LIGHT_CLUSTERS_H
+#define LIGHT_CLUSTERS_H
+
+#include <camera.h>
+#include <ring_buffer.h>
+#include <thread_pool.h>
+
+#include <stdint.h>
+
+// the view frustum is cut into LIGHT_CLUSTERS_X x LIGHT_CLUSTERS_Y screen tiles and
+// LIGHT_CLUSTERS_Z depth slices; shaders/lighting.glsl mirrors these
+#define LIGHT_CLUSTERS_X 16
+#define LIGHT_CLUSTERS_Y 9
+#define LIGHT_CLUSTERS_Z 24
+#define LIGHT_CLUSTER_COUNT (LIGHT_CLUSTERS_X * LIGHT_CLUSTERS_Y * LIGHT_CLUSTERS_Z)
+// depth slices are spaced exponentially from the near plane to this view distance; the last one
+// reaches on to infinity
+#define LIGHT_CLUSTERS_FAR 200.0f
+
+// RGBA32F texels one light takes up in the light buffer
+#define LIGHT_TEXELS 3
+
+// a point or spot light in world space, as the shaders read it; mirrors fetchLight in
+// shaders/lighting.glsl. every member is a vec4 so the buffer can be read as RGBA32F texels.
+struct light
+{
+    float position[3];
+    float radius;               // the light falls off to nothing here
+    float color[3];             // premultiplied by intensity
+    float spot_inner;           // cosine of the half angle the cone starts to fade at
+    float direction[3];         // spot lights only
+    float spot_outer;           // cosine of the half angle it is gone at; below -1 for point lights
+};
+
+void light_point(struct light *light, const float *position, float radius, const float *color);
+// angles are half angles in radians
+void light_spot(struct light *light, const float *position, const float *direction, float radius,
+    const float *color, float inner_angle, float outer_angle);
+
+// view-space bounding spheres of some lights, SoA and padded to a multiple of 4 for SIMD tests
+struct light_candidates
+{
+    uint32_t *lights;           // indices into the light array
+    float *x;
+    float *y;
+    float *depth;
+    float *radius_sq;
+    unsigned int count;
+    unsigned int capacity;
+};
+
+// lights binned into the clusters of one depth slice
+struct light_slice
+{
+    float depth[2];             // view distance the slice spans
+    struct light_candidates candidates;     // lights reaching into the slice
+    struct light_candidates row;            // of those, the ones reaching the row being binned
+    uint32_t *indices;          // light indices, grouped by cluster in grid order
+    unsigned int index_count;
+    unsigned int index_capacity;
+    int failed;                 // out of memory; the slice is left without lights
+};
+
+// clustered forward lighting. every frame the lights are assigned to the clusters their bounding
+// spheres touch: one task per depth slice on the thread pool. a slice narrows the lights down to
+// those reaching its depth range, then to those reaching each row of tiles, and tests what is left
+// four at a time against the view-space box of every cluster in the row. the shaders then only
+// loop over the lights of the fragment's own cluster, so shading cost follows the lights per
+// cluster rather than the total.
+//
+// on the GPU the lights, the per-cluster (offset, count) grid and the light index list are texture
+// buffers; the cluster lookup constants are the Lighting uniform block. GL objects are made on the
+// first bind, so binning alone runs without a context (tools/bench).
+struct light_clusters
+{
+    struct thread_pool *pool;
+    const struct light *lights; // of the last build
+    unsigned int light_count;
+    unsigned int view_capacity;
+    float *view_x;              // the lights' view-space spheres, depth positive away from the eye
+    float *view_y;
+    float *view_depth;
+    float *view_radius;
+    float tile_scale[2];        // view x, y per unit depth at the NDC edge: 1 / projection[0], 1 / projection[5]
+    struct light_slice slices[LIGHT_CLUSTERS_Z];
+    uint32_t grid[LIGHT_CLUSTER_COUNT * 2];  // offset, count into indices
+    uint32_t *indices;
+    unsigned int index_count;
+    unsigned int index_capacity;
+    float cluster_scale[4];     // contents of the Lighting block
+    int simd;                   // 0 forces the scalar tests, for comparison
+    unsigned int light_buffer, light_texture;
+    unsigned int grid_buffer, grid_texture;
+    unsigned int index_buffer, index_texture;
+};
+
+void light_clusters_init(struct light_clusters *clusters, struct thread_pool *pool);
+void light_clusters_shutdown(struct light_clusters *clusters);
+
+// bins lights for the camera's view of a width x height framebuffer. lights must stay alive until
+// light_clusters_bind. returns 0 if out of memory.
+int light_clusters_build(struct light_clusters *clusters, const struct camera *camera, const struct light *lights,
+    unsigned int light_count, int width, int height);
+
+// uploads the last build, binds the texture buffers to their units and pushes the Lighting block
+void light_clusters_bind(struct light_clusters *clusters, struct ring_buffer *stream);
+
+#endif
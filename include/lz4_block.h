@@ -0,0 +1,16 @@
+#ifndef LZ4_BLOCK_H
+#define LZ4_BLOCK_H
+
+#include <stddef.h>
+
+// the LZ4 block format (no frame): greedy single-hash matching, so it trades some ratio for a
+// compressor small enough to live in the tree. output decodes with any LZ4 block decompressor.
+
+// worst-case compressed size of size bytes
+size_t lz4_block_bound(size_t size);
+// returns the compressed size, or 0 if it does not fit in capacity
+size_t lz4_block_compress(const unsigned char *src, size_t size, unsigned char *dst, size_t capacity);
+// returns 0 unless src decodes to exactly size bytes
+int lz4_block_decompress(const unsigned char *src, size_t src_size, unsigned char *dst, size_t size);
+
+#endif
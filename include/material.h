@@ -0,0 +1,41 @@
+#ifndef MATERIAL_H
+#define MATERIAL_H
+
+// vec4 texels one material takes up in the table
+#define MATERIAL_TEXELS 3
+
+// one entry of the material table; mirrors fetchMaterial in shaders/material.glsl. every member is
+// a vec4 so the buffer can be read as RGBA32F texels.
+struct material
+{
+    float color[4];             // multiplied with the texture
+    float uv_rect[4];           // atlas region: offset.xy, scale.xy
+    float layer[4];             // x = texture array layer
+};
+
+// every material's parameters in one buffer texture, so draws only carry a material index and
+// switching materials no longer breaks an instanced batch. shaders index it with the per-instance
+// material attribute; edits are uploaded in one go before drawing.
+struct material_table
+{
+    unsigned int buffer;
+    unsigned int texture;       // GL_TEXTURE_BUFFER over buffer
+    struct material *materials;
+    unsigned int count;
+    unsigned int capacity;
+    unsigned int uploaded_capacity;  // materials the GL buffer has room for
+    unsigned int dirty_begin;   // range changed since the last upload
+    unsigned int dirty_end;
+};
+
+void material_table_init(struct material_table *table);
+void material_table_shutdown(struct material_table *table);
+
+// returns the new material's index, or -1 if out of memory
+int material_table_add(struct material_table *table, const struct material *material);
+void material_table_set(struct material_table *table, unsigned int index, const struct material *material);
+
+// uploads pending changes and binds the table to TEXTURE_UNIT_MATERIALS
+void material_table_bind(struct material_table *table);
+
+#endif
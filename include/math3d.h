@@ -0,0 +1,113 @@
+#ifndef MATH3D_H
+#define MATH3D_H
+
+#include <math.h>
+#include <string.h>
+
+// matrices are column-major float[16], the layout GL and std140 expect
+
+static inline void mat4_identity(float *m)
+{
+    memset(m, 0, 16 * sizeof(float));
+    m[0] = m[5] = m[10] = m[15] = 1.0f;
+}
+
+// out = a * b, out may alias a or b
+static inline void mat4_multiply(float *out, const float *a, const float *b)
+{
+    float r[16];
+    int col, row;
+
+    for (col = 0; col < 4; col++)
+    {
+        for (row = 0; row < 4; row++)
+        {
+            r[col * 4 + row] = a[0 * 4 + row] * b[col * 4 + 0] +
+                               a[1 * 4 + row] * b[col * 4 + 1] +
+                               a[2 * 4 + row] * b[col * 4 + 2] +
+                               a[3 * 4 + row] * b[col * 4 + 3];
+        }
+    }
+    memcpy(out, r, sizeof(r));
+}
+
+static inline void mat4_translation(float *m, float x, float y, float z)
+{
+    mat4_identity(m);
+    m[12] = x;
+    m[13] = y;
+    m[14] = z;
+}
+
+static inline void mat4_scale(float *m, float x, float y, float z)
+{
+    mat4_identity(m);
+    m[0] = x;
+    m[5] = y;
+    m[10] = z;
+}
+
+static inline float vec3_dot(const float *a, const float *b)
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void vec3_cross(float *out, const float *a, const float *b)
+{
+    float r[3] = { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+    memcpy(out, r, sizeof(r));
+}
+
+static inline void vec3_normalize(float *v)
+{
+    float length = sqrtf(vec3_dot(v, v));
+
+    if (length > 0.0f)
+    {
+        v[0] /= length;
+        v[1] /= length;
+        v[2] /= length;
+    }
+}
+
+// view matrix of an eye at eye looking along forward (unit length), with up roughly up
+static inline void mat4_look_to(float *m, const float *eye, const float *forward, const float *up)
+{
+    float right[3], true_up[3];
+
+    vec3_cross(right, forward, up);
+    vec3_normalize(right);
+    vec3_cross(true_up, right, forward);
+    mat4_identity(m);
+    m[0] = right[0];
+    m[4] = right[1];
+    m[8] = right[2];
+    m[1] = true_up[0];
+    m[5] = true_up[1];
+    m[9] = true_up[2];
+    m[2] = -forward[0];
+    m[6] = -forward[1];
+    m[10] = -forward[2];
+    m[12] = -vec3_dot(right, eye);
+    m[13] = -vec3_dot(true_up, eye);
+    m[14] = vec3_dot(forward, eye);
+}
+
+// reversed-Z perspective with the far plane at infinity: the near plane lands on depth 1 and
+// infinity on 0, which spreads float depth evenly over distance. zero_to_one is the clip depth
+// range, [0, 1] with glClipControl or GL's default [-1, 1] without it.
+static inline void mat4_perspective_reversed_infinite(float *m, float fov_y, float aspect, float near,
+    int zero_to_one)
+{
+    float f = 1.0f / tanf(fov_y * 0.5f);
+
+    memset(m, 0, 16 * sizeof(float));
+    m[0] = f / aspect;
+    m[5] = f;
+    m[11] = -1.0f;
+    // clip z = near (or z + 2 near), w = -z: depth near / -z falls from 1 at the near plane to 0
+    m[10] = zero_to_one ? 0.0f : 1.0f;
+    m[14] = zero_to_one ? near : 2.0f * near;
+}
+
+#endif
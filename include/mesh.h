@@ -0,0 +1,38 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// extension of cooked mesh files
+#define MESH_EXTENSION ".mesh"
+
+// interleaved vertex, the same in mesh files and vertex buffers
+struct mesh_vertex
+{
+    float position[3];
+    float normal[3];
+    float uv[2];
+};
+
+// an indexed triangle list
+struct mesh_data
+{
+    struct mesh_vertex *vertices;
+    uint32_t vertex_count;
+    uint32_t *indices;
+    uint32_t index_count;
+    float bounds_min[3];
+    float bounds_max[3];
+};
+
+int mesh_save(const struct mesh_data *mesh, const char *path);
+int mesh_load(const char *path, struct mesh_data *mesh);
+// parses a file already in memory
+int mesh_decode(const unsigned char *data, size_t size, struct mesh_data *mesh);
+void mesh_free(struct mesh_data *mesh);
+
+// recomputes bounds_min/bounds_max from the vertices
+void mesh_compute_bounds(struct mesh_data *mesh);
+
+#endif
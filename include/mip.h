@@ -0,0 +1,64 @@
+#ifndef MIP_H
+#define MIP_H
+
+#include <thread_pool.h>
+
+#include <stddef.h>
+
+#define MIP_MAX_LEVELS 16
+
+// one RGBA8 image of a chain, rows tightly packed
+struct mip_level
+{
+    int width;
+    int height;
+    size_t size;
+    unsigned char *pixels;
+};
+
+enum mip_filter
+{
+    MIP_FILTER_BOX,     // 2x2 average, cheapest
+    MIP_FILTER_KAISER   // 8 tap Kaiser windowed sinc, keeps fine detail sharper without ringing much
+};
+
+enum mip_simd
+{
+    MIP_SIMD_NONE,
+    MIP_SIMD_SSE,
+    MIP_SIMD_AVX2
+};
+
+// one chain for mip_generate_batch: levels[0] is filled in by the caller, count is set on return
+struct mip_chain
+{
+    struct mip_level *levels;
+    unsigned int max_levels;
+    unsigned int count;
+    int srgb;
+};
+
+// the best instruction set this CPU supports, or the one forced by mip_set_simd
+enum mip_simd mip_simd(void);
+// forces a slower code path (for comparisons); requests above what the CPU has are lowered
+void mip_set_simd(enum mip_simd simd);
+
+// filters src into dst, which must already be half its size (rounded down, at least 1) with pixels
+// allocated. srgb color channels are filtered in linear light, alpha always is linear. returns 0 if
+// out of memory for the filter's scratch rows, leaving dst partly written.
+int mip_downsample(const struct mip_level *src, struct mip_level *dst, enum mip_filter filter, int srgb);
+
+// allocates and fills levels[1..] from levels[0] down to 1x1 or max_levels and returns the number of
+// levels in the chain, which stops early at a level memory ran out for. with a pool, the rows of each level are split across its workers; it is fine
+// to call from a pool task.
+unsigned int mip_generate(struct mip_level *levels, unsigned int max_levels, enum mip_filter filter, int srgb,
+    struct thread_pool *pool);
+
+// builds many chains at once: one task per chain when there are enough of them to keep the pool
+// busy, otherwise each chain's levels are split across the pool in turn
+void mip_generate_batch(struct mip_chain *chains, unsigned int count, enum mip_filter filter, struct thread_pool *pool);
+
+// frees levels[1..count); levels[0] stays with the caller
+void mip_free(struct mip_level *levels, unsigned int count);
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef OBJ_H
+#define OBJ_H
+
+#include <mesh.h>
+
+// parses Wavefront OBJ text (NUL-terminated) into an indexed mesh. understands v, vt, vn and f
+// with any index form, negative indices included; polygons are fanned into triangles and corners
+// that share all three indices become one vertex. corners without a normal get a smooth one
+// averaged over the faces using that position. everything else is ignored. returns 0 on malformed
+// input or out of memory.
+int obj_parse(const char *text, struct mesh_data *mesh);
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef OVERDRAW_H
+#define OVERDRAW_H
+
+#include <render_queue.h>
+#include <render_target.h>
+
+#include <stddef.h>
+
+// debug measurement of overdraw. the opaque queue's last flush is replayed into an R32F counter
+// target where every fragment that passes the depth test adds 1, with the same depth setup the
+// flush used (Z-prepass and GL_EQUAL when the queue has one). reading the counts back stalls the
+// pipeline, so this is for debug runs only.
+struct overdraw_counter
+{
+    struct render_target target;
+    float *counts;              // readback of the counter target
+    size_t count_capacity;
+    double fragments;           // results of the last measurement
+    unsigned int covered_pixels;
+    unsigned int pixels;
+};
+
+int overdraw_counter_init(struct overdraw_counter *counter, int width, int height);
+void overdraw_counter_destroy(struct overdraw_counter *counter);
+
+// count_program is depth.vert/depth.frag built with COUNT_FRAGMENTS. call after
+// render_queue_flush, in the same frame. leaves the counter target bound; returns 0 on failure.
+int overdraw_counter_measure(struct overdraw_counter *counter, struct render_queue *queue,
+    unsigned int count_program, int width, int height);
+
+// shaded fragments per pixel that was shaded at all: 1 means no overdraw
+float overdraw_counter_ratio(const struct overdraw_counter *counter);
+
+#endif
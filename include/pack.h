@@ -0,0 +1,99 @@
+#ifndef PACK_H
+#define PACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <thread_pool.h>
+
+#define PACK_MAGIC 0x4b434150u  // "PACK"
+#define PACK_VERSION 1
+// blobs start on page boundaries so a mapped blob never shares a page with its neighbours
+#define PACK_ALIGNMENT 4096
+#define PACK_EXTENSION ".pack"
+
+enum pack_compression
+{
+    PACK_COMPRESSION_NONE,
+    PACK_COMPRESSION_LZ4
+};
+
+// file layout: header, blobs at PACK_ALIGNMENT, then the directory sorted by name hash and the
+// NUL-terminated names it points into. everything is little endian.
+struct pack_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t names_size;
+    uint64_t directory_offset;  // entry_count entries, names right after
+};
+
+struct pack_entry
+{
+    uint64_t hash;              // hash_string of the name
+    uint64_t offset;            // of the blob from the start of the file
+    uint64_t stored_size;       // bytes in the file
+    uint64_t size;              // bytes once decompressed
+    uint32_t compression;       // enum pack_compression
+    uint32_t name;              // offset into the names
+};
+
+// a read-only archive mapped into memory. lookups binary search the directory and need no locks,
+// so any thread may read from an open pack.
+struct pack
+{
+    const unsigned char *data;
+    size_t size;
+    const struct pack_entry *entries;
+    uint32_t entry_count;
+    const char *names;
+    uint32_t names_size;
+};
+
+int pack_open(struct pack *pack, const char *path);
+void pack_close(struct pack *pack);
+
+// NULL if name is not in the pack
+const struct pack_entry *pack_find(const struct pack *pack, const char *name);
+const char *pack_entry_name(const struct pack *pack, const struct pack_entry *entry);
+// the stored bytes, straight from the mapping. only the data itself for uncompressed entries.
+const unsigned char *pack_entry_data(const struct pack *pack, const struct pack_entry *entry);
+
+// decompresses an entry into a malloc'ed buffer with a NUL after the last byte. NULL on failure.
+unsigned char *pack_read(const struct pack *pack, const struct pack_entry *entry, size_t *size);
+
+struct pack_read
+{
+    const struct pack_entry *entry;
+    unsigned char *data;        // out: as from pack_read, NULL on failure
+    size_t size;
+};
+
+// reads a batch of entries. the queue is ordered by file offset and paged in front to back, so the
+// disk sees one forward sweep however the caller ordered it; decompression is spread over pool.
+void pack_read_batch(const struct pack *pack, struct pack_read *reads, unsigned int count, struct thread_pool *pool);
+
+// builds a pack. entries are written as they are added; the directory goes out on close.
+struct pack_writer
+{
+    FILE *file;
+    struct pack_entry *entries;
+    unsigned int count;
+    unsigned int capacity;
+    char *names;
+    size_t names_size;
+    size_t names_capacity;
+    uint64_t position;
+    int failed;
+};
+
+int pack_writer_open(struct pack_writer *writer, const char *path);
+// compression is a request: entries that do not shrink are stored as they are. returns 0 on failure.
+int pack_writer_add(struct pack_writer *writer, const char *name, const void *data, size_t size,
+    enum pack_compression compression);
+// writes the directory and header; returns 0 if anything since open failed
+int pack_writer_close(struct pack_writer *writer);
+
+#endif
@@ -0,0 +1,235 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <mesh.h>
+#include <thread_pool.h>
+
+#include <stdint.h>
+
+// pixels on a side of a tile: the unit of hierarchical depth and of coverage tests
+#define RASTER_TILE_SIZE 8
+// pixels on a side of a bin: the unit of work one thread takes during a flush
+#define RASTER_BIN_SIZE 64
+// fractional bits of the fixed-point window coordinates triangles are set up in
+#define RASTER_SUBPIXEL_BITS 4
+// pixels triangles may reach beyond the target before they are clipped; keeps the fixed-point
+// edge functions in range
+#define RASTER_GUARD_BAND 4096
+// vertex attribute locations, the same as the GL renderer's (RENDER_MESH_*_LOCATION)
+#define RASTER_MAX_ATTRIBUTES 8
+#define RASTER_POSITION_LOCATION 0
+#define RASTER_NORMAL_LOCATION 2
+// vertices the vertex stage transforms at once, one per AVX2 lane
+#define RASTER_VERTEX_BATCH 8
+// a draw is only split across threads into ranges of at least this many triangles
+#define RASTER_MIN_RANGE 2048
+// samples per pixel of a multisampled target
+#define RASTER_MSAA_SAMPLES 4
+
+// the fragment stages the CPU backend has; both match a GL program of the engine
+enum raster_shader
+{
+    RASTER_SHADER_FLAT,         // the draw's color, like shaders/basic.frag
+    RASTER_SHADER_LIT           // color times ambient plus one directional light, per vertex
+};
+
+// how fragments are combined with the target
+enum raster_blend
+{
+    RASTER_BLEND_NONE,          // replace color and depth
+    RASTER_BLEND_ALPHA          // source alpha over the color; depth is tested but not written
+};
+
+// everything about a draw that changes how its pixels are processed. each combination has a pixel
+// loop of its own, compiled from one template with the branches on these folded away.
+struct raster_pipeline
+{
+    enum raster_shader shader;
+    enum raster_blend blend;
+};
+
+// a float vertex attribute, described the way glVertexAttribPointer describes one
+struct raster_attribute
+{
+    const void *buffer;         // NULL when the attribute is disabled: it reads as (0, 0, 0, 1)
+    int size;                   // components, 1 to 4; missing ones read as in GL
+    size_t stride;              // bytes from one vertex to the next; 0 when tightly packed
+    size_t offset;              // bytes from buffer to the first vertex
+};
+
+// what a VAO holds, for the CPU: the attributes by location and the element buffer
+struct raster_vertex_array
+{
+    struct raster_attribute attributes[RASTER_MAX_ATTRIBUTES];
+    uint32_t vertex_count;
+    const uint32_t *indices;
+    uint32_t index_count;
+};
+
+// counters of one frame, reset by raster_clear
+struct raster_stats
+{
+    unsigned int vertices;          // transformed: each index a range uses once
+    unsigned int triangles;         // set up and binned, after clipping
+    unsigned int triangles_culled;  // outside the view or without area
+    unsigned int tiles_tested;      // tiles a triangle's edges overlap
+    unsigned int tiles_rejected;    // ... dropped whole by the hierarchical depth test
+    unsigned int tiles_accepted;    // ... that passed whole, so no depth was read
+    uint64_t pixels_tested;         // covered pixels depth tested one at a time
+    uint64_t pixels_rejected;       // ... that failed (every covered sample), before being shaded
+    uint64_t fragments;             // shaded and written: the overdraw counter
+};
+
+// a triangle after setup: fixed-point edge functions, planes for depth and shading
+struct raster_triangle
+{
+    int32_t edge_a[3];          // E(x, y) = a x + b y + c in subpixels, >= 0 inside
+    int32_t edge_b[3];
+    int64_t edge_c[3];          // includes the fill rule bias
+    float depth[3];             // depth = [0] + [1] x + [2] y at pixel centers
+    float depth_min, depth_max;
+    float inv_w[3];             // 1/w and intensity/w, for perspective-correct intensity
+    float intensity[3];
+    int min_x, min_y, max_x, max_y; // pixel bounds, inclusive
+    uint32_t color;             // RGBA8
+    float rgba[4];
+    struct raster_pipeline pipeline;
+};
+
+// triangles overlapping one bin, in submission order
+struct raster_bin
+{
+    uint32_t *triangles;
+    unsigned int count;
+    unsigned int capacity;
+    struct raster_stats stats;  // this bin's share of the last flush
+};
+
+// vertex stage output, SoA so RASTER_VERTEX_BATCH vertices are processed at once
+struct raster_vertices
+{
+    float *clip[4];             // clip space position
+    float *intensity;           // lit shader only
+    int32_t *window_x;          // projected; only meaningful for vertices that need no clipping
+    int32_t *window_y;
+    float *window_z;
+    float *inv_w;
+    float *intensity_w;         // intensity / w
+    uint32_t *outcode;          // view volume and guard band sides the vertex is outside of
+    uint32_t capacity;
+};
+
+// one slice of a draw's triangles in the vertex stage. every range has a post-transform cache of
+// its own, so the ranges of a draw run on different threads without sharing anything, and each
+// vertex a range uses is transformed once however many of its triangles share it
+struct raster_vertex_range
+{
+    uint32_t *cache_stamp;      // per vertex index: the draw this range last transformed it for
+    uint32_t *cache_slot;       // ... and where in vertices it went
+    uint32_t cache_capacity;
+    uint32_t stamp;
+    uint32_t *sources;          // per slot: the vertex index transformed into it
+    struct raster_vertices vertices;
+    struct raster_triangle *triangles;  // set up, waiting to be binned in draw order
+    unsigned int triangle_count;
+    unsigned int triangle_capacity;
+    unsigned int vertex_count;  // transformed for the last draw
+    unsigned int culled;
+    int failed;
+};
+
+// a CPU render target and the triangles waiting to be drawn into it. draws are transformed, set
+// up and binned as they come; raster_flush rasterizes the bins in parallel, each one's triangles
+// in the order they were drawn.
+//
+// the vertex stage fetches attributes through a raster_vertex_array and transforms, classifies
+// against the view volume and guard band, and projects RASTER_VERTEX_BATCH vertices at a time with
+// AVX2 when the CPU has it. the scalar path does the same operations in the same order, so both
+// produce the same bits. big draws are cut into index ranges that run on the pool.
+//
+// color and depth are stored tile by tile (64 contiguous pixels per tile) and every tile keeps the
+// nearest and farthest depth in it. a triangle whose nearest depth over a tile is behind the tile's
+// farthest is dropped without looking at a pixel, and one whose farthest is in front of the tile's
+// nearest is written without reading depth. the rest are depth tested pixel by pixel before they
+// are shaded (early-Z), which is valid because neither shader writes depth.
+//
+// depth follows the GL renderer: reversed, cleared to 0, GL_GREATER passes. triangles are not
+// culled by winding, since the GL renderer doesn't either.
+//
+// a multisampled target keeps RASTER_MSAA_SAMPLES samples per pixel in a rotated grid but stores
+// them compressed: a pixel whose samples all match holds one color and one depth (taken at its
+// center), and only pixels a triangle edge has passed through (edge pixels, a bit per pixel in
+// tile_edges) spread out into per-sample storage. coverage masks come out of the edge functions
+// for a row of pixels at once; each pixel is still shaded once. resolving averages edge pixels
+// only, so a frame costs little more than without multisampling.
+//
+// the output is a function of the draws and the sample count alone, bit for bit: not of the pool's
+// thread count, the order bins are flushed in, or the simd, hierarchical_z and specialized knobs.
+// the rule is fixed: vertices snap to 1/16 pixel, a sample is covered when every edge function is
+// >= 0 after the top-left bias, and pixel centers are at half pixels. bins own disjoint pixels and
+// rasterize their triangles in draw order, so blending always happens in draw order. the build
+// keeps the compiler from fusing multiplies and adds in raster.c, which would make the scalar and
+// AVX2 paths differ. tools/golden.c holds the reference scenes this is checked against.
+struct raster_target
+{
+    int width;
+    int height;
+    int tiles_x;                // the storage is padded to whole tiles
+    int tiles_y;
+    int bins_x;
+    int bins_y;
+    int samples;                // 1, or RASTER_MSAA_SAMPLES
+    int zero_to_one;            // clip depth range the projection uses, as in struct camera
+    struct thread_pool *pool;   // may be NULL
+    int simd;                   // on by default when the CPU has AVX2; off for comparisons
+    int hierarchical_z;         // on by default; off for comparisons
+    int specialized;            // on by default; off shades through one generic loop, for comparisons
+    int reverse_bins;           // off by default; on flushes bins last to first, for comparisons
+    float light[3];             // direction towards the light, for RASTER_SHADER_LIT
+    uint32_t *color;            // RGBA8
+    float *depth;
+    float *tile_near;           // per tile: largest depth in it
+    float *tile_far;            // per tile: smallest depth in it
+    uint64_t *tile_edges;       // multisampled: per tile, the pixels that have samples of their own
+    uint32_t *sample_color;     // ... and their samples, RASTER_MSAA_SAMPLES per pixel
+    float *sample_depth;
+    struct raster_triangle *triangles;
+    unsigned int triangle_count;
+    unsigned int triangle_capacity;
+    struct raster_bin *bins;
+    struct raster_vertex_range *ranges; // one per thread that may run the vertex stage
+    unsigned int range_count;
+    struct raster_stats stats;
+};
+
+// samples is 1 or RASTER_MSAA_SAMPLES. with a pool, big draws and flushes are spread across its
+// workers.
+int raster_target_init(struct raster_target *target, int width, int height, int samples, int zero_to_one,
+    struct thread_pool *pool);
+void raster_target_destroy(struct raster_target *target);
+
+// clears color to an RGBA color in [0, 1] and depth to 0, drops pending triangles and resets stats
+void raster_clear(struct raster_target *target, const float *color);
+
+// an array with no attributes enabled yet, drawing count indices (three per triangle)
+void raster_vertex_array_init(struct raster_vertex_array *array, uint32_t vertex_count, const uint32_t *indices,
+    uint32_t count);
+// like glVertexAttribPointer with buffer bound to GL_ARRAY_BUFFER, for GL_FLOAT components
+void raster_vertex_attrib_pointer(struct raster_vertex_array *array, unsigned int location, int size, size_t stride,
+    const void *buffer, size_t offset);
+// the layout render_mesh_create gives a mesh's VAO
+void raster_vertex_array_from_mesh(struct raster_vertex_array *array, const struct mesh_data *mesh);
+
+// transforms the triangles of array by view_projection * model (column-major, like math3d.h) and
+// bins them. color is RGBA in [0, 1]. returns 0 if out of memory.
+int raster_draw(struct raster_target *target, const float *view_projection, const float *model,
+    const struct raster_vertex_array *array, const float *color, const struct raster_pipeline *pipeline);
+
+// rasterizes everything drawn since the last flush and adds the bins' counters to target->stats
+void raster_flush(struct raster_target *target);
+
+// copies color out as tightly packed RGBA8 rows, bottom row first like glReadPixels, resolving
+// multisampled edge pixels on the way
+void raster_read_pixels(const struct raster_target *target, unsigned char *rgba);
+
+#endif
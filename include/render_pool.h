@@ -0,0 +1,77 @@
+#ifndef RENDER_POOL_H
+#define RENDER_POOL_H
+
+#include <pthread.h>
+
+struct render_pool;
+struct render_worker;
+
+// a job: index is the job's number in render_pool_run, or the worker's in render_pool_each
+typedef void (*render_pool_fn)(struct render_worker *worker, void *arg, unsigned int index);
+
+// one thread and the headless context it keeps current for its whole life. objects created in the
+// pool's shared context (buffers, textures, programs) are visible here; container objects (vertex
+// arrays, framebuffers) are not, so every worker has a framebuffer of its own, bound while its jobs
+// run, and makes its own vertex arrays, typically in render_pool_each. uniforms set with glUniform*
+// are part of a shared program and race between workers; per-job values go in uniform buffers the
+// worker owns.
+struct render_worker
+{
+    struct render_pool *pool;
+    unsigned int index;
+    pthread_t thread;
+    void *context;              // EGLContext
+    unsigned int framebuffer;   // width x height: RGBA8 color, 32-bit float depth
+    unsigned int color;
+    unsigned int depth;
+    void *user;                 // whatever per-context state the jobs keep; the pool doesn't touch it
+    int started;                // 1 once the context is current and the framebuffer complete, -1 if that failed
+};
+
+// N headless GL 3.3 core contexts on EGL (surfaceless, so llvmpipe works without a display), each
+// driven by its own thread, for batch rendering: jobs are independent frames handed out to
+// whichever worker is free. all contexts share objects with one more context that no thread keeps
+// current, where read-only meshes, textures and programs are created once between
+// render_pool_begin_shared and render_pool_end_shared.
+//
+// EGL is opened at run time, like glad opens libGL, so nothing links against it. glad is loaded
+// lazily through eglGetProcAddress, whose addresses hold for every context; the pool isn't meant
+// to share a process with a GLFW window whose context loaded glad some other way.
+struct render_pool
+{
+    struct render_worker *workers;
+    unsigned int worker_count;
+    int width;
+    int height;
+    void *display;              // EGLDisplay
+    void *shared_context;       // EGLContext
+    pthread_mutex_t lock;
+    pthread_cond_t wake;        // signaled when a batch is posted or on shutdown
+    pthread_cond_t finished;    // signaled when a worker starts or the last job of a batch finishes
+    render_pool_fn fn;
+    void *arg;
+    unsigned int count;         // jobs in the batch
+    unsigned int next;          // next job to hand out
+    unsigned int done;
+    unsigned int batch;         // bumped for every batch, so workers see each exactly once
+    int each;                   // the batch runs once on every worker instead
+    int quit;
+};
+
+// worker_count 0 picks one worker per online core. returns 0 if EGL or a context is unavailable.
+int render_pool_init(struct render_pool *pool, unsigned int worker_count, int width, int height);
+// waits for the workers to go idle, then destroys every context
+void render_pool_shutdown(struct render_pool *pool);
+
+// makes the shared context current on the calling thread, to create data every worker reads. end
+// waits for the GPU to finish with it, so the workers see complete objects, and releases the
+// context again.
+int render_pool_begin_shared(struct render_pool *pool);
+void render_pool_end_shared(struct render_pool *pool);
+
+// runs fn(worker, arg, i) for i in [0, count) spread over the workers, returning when all are done
+void render_pool_run(struct render_pool *pool, unsigned int count, render_pool_fn fn, void *arg);
+// runs fn(worker, arg, worker->index) once on every worker: per-context setup and teardown
+void render_pool_each(struct render_pool *pool, render_pool_fn fn, void *arg);
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <mesh.h>
+#include <ring_buffer.h>
+
+// first vertex attribute location of the per-instance data; meshes keep below it
+#define RENDER_INSTANCE_LOCATION 4
+
+// vertex attribute locations of struct mesh_vertex in meshes made by render_mesh_create
+#define RENDER_MESH_POSITION_LOCATION 0
+#define RENDER_MESH_UV_LOCATION 1
+#define RENDER_MESH_NORMAL_LOCATION 2
+
+// geometry the queue can draw: an indexed VAO (GL_UNSIGNED_INT indices, GL_TRIANGLES)
+struct render_mesh
+{
+    unsigned int vao;
+    unsigned int index_count;
+    unsigned int vertex_buffer; // owned buffers of render_mesh_create, 0 otherwise
+    unsigned int index_buffer;
+};
+
+// uploads mesh data into a VAO laid out as struct mesh_vertex at the locations above
+void render_mesh_create(struct render_mesh *mesh, const struct mesh_data *data);
+void render_mesh_destroy(struct render_mesh *mesh);
+
+// per-instance vertex attributes, streamed through the ring buffer. mirrors the instance inputs of
+// shaders/sprite.vert: model at RENDER_INSTANCE_LOCATION (four columns), then the material index.
+// everything else about the look of an instance lives in the material table.
+struct render_instance
+{
+    float model[16];
+    unsigned int material;      // index into the material table
+    unsigned int padding[3];
+};
+
+struct render_item
+{
+    unsigned int program;
+    unsigned int texture;       // GL_TEXTURE_2D_ARRAY bound to unit 0
+    float distance;             // squared distance of the model origin from the eye
+    const struct render_mesh *mesh;
+    struct render_instance instance;
+};
+
+// one instanced draw of the last flush
+struct render_run
+{
+    unsigned int program;
+    const struct render_mesh *mesh;
+    unsigned int texture;
+    size_t offset;              // of its instances in the stream buffer
+    unsigned int instance_count;
+};
+
+// collects the frame's opaque draws and submits them sorted by program, mesh and texture. every
+// run of items that shares all three becomes one glDrawElementsInstanced; materials are looked up
+// per instance, so neither they nor the atlas region they sample split a run. inside a run the
+// instances go front to back from the eye, so the depth test rejects hidden fragments before they
+// are shaded.
+struct render_queue
+{
+    struct ring_buffer *stream;
+    struct render_item *items;
+    unsigned int count;
+    unsigned int capacity;
+    struct render_run *runs;    // of the last flush, for render_queue_replay
+    unsigned int run_count;
+    unsigned int run_capacity;
+    float eye[3];
+    // depth-only program for a Z-prepass, 0 for none. with one, flush first lays down depth
+    // with color writes off, then shades with GL_EQUAL so every pixel is shaded once.
+    unsigned int prepass_program;
+    unsigned int draw_calls;    // statistics of the last flush
+    unsigned int texture_binds;
+};
+
+void render_queue_init(struct render_queue *queue, struct ring_buffer *stream);
+void render_queue_shutdown(struct render_queue *queue);
+
+// where submissions are measured from for front-to-back ordering
+void render_queue_set_eye(struct render_queue *queue, const float *eye);
+
+// returns 0 if out of memory. program 0 (not built yet) is skipped.
+int render_queue_submit(struct render_queue *queue, unsigned int program, const struct render_mesh *mesh,
+    unsigned int texture, const struct render_instance *instance);
+
+// draws everything submitted since the last flush and empties the queue
+void render_queue_flush(struct render_queue *queue);
+
+// draws the runs of the last flush again with program in place of their own, without textures
+// (depth and debug passes). the instances live in the stream buffer, so only until the frame ends.
+void render_queue_replay(struct render_queue *queue, unsigned int program);
+
+#endif
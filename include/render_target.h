@@ -0,0 +1,30 @@
+#ifndef RENDER_TARGET_H
+#define RENDER_TARGET_H
+
+// an offscreen framebuffer the scene renders into: a color texture and a 32-bit float depth
+// texture. the default framebuffer's depth is usually 24-bit fixed point, which would throw
+// away what reversed-Z gains; the float buffer keeps it.
+struct render_target
+{
+    unsigned int framebuffer;
+    unsigned int color;
+    unsigned int depth;
+    unsigned int color_format;  // internal format of color, GL_RGBA8 for the scene
+    int width;
+    int height;
+};
+
+// returns 0 if the framebuffer is incomplete
+int render_target_init(struct render_target *target, int width, int height, unsigned int color_format);
+void render_target_destroy(struct render_target *target);
+
+// reallocates the attachments when the size changed; returns 0 on failure
+int render_target_resize(struct render_target *target, int width, int height);
+
+// binds the framebuffer and sets the viewport to it
+void render_target_bind(const struct render_target *target);
+
+// copies the color attachment to the default framebuffer and binds that again
+void render_target_present(const struct render_target *target, int width, int height);
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <glad/glad.h>
+
+#include <stddef.h>
+
+// number of frames that can be in flight at once; each one owns a partition
+#define RING_BUFFER_PARTITIONS 3
+
+// streaming buffer for data that changes every frame (instance data, uniforms, debug lines).
+// the buffer is split into RING_BUFFER_PARTITIONS partitions, the CPU writes into one while the
+// GPU may still be reading the others, and a fence per partition tells us when it can be reused.
+struct ring_buffer
+{
+    unsigned int buffer;
+    size_t partition_size;
+    unsigned int partition;     // partition being written this frame
+    size_t head;                // write offset inside the current partition
+    int persistent;             // ARB_buffer_storage: mapped once for the lifetime of the buffer
+    unsigned char *persistent_ptr;
+    int mapped;                 // 3.3 path: a range is currently mapped
+    GLsync fences[RING_BUFFER_PARTITIONS];
+};
+
+int ring_buffer_create(struct ring_buffer *ring, size_t partition_size);
+void ring_buffer_destroy(struct ring_buffer *ring);
+
+// waits until the GPU is done with the partition we are about to overwrite
+void ring_buffer_begin_frame(struct ring_buffer *ring);
+// fences the partition written this frame and moves on to the next one
+void ring_buffer_end_frame(struct ring_buffer *ring);
+
+// reserves size bytes aligned to alignment and returns a write pointer, or NULL if the partition
+// is full or the map failed (nothing is reserved then). offset receives the position inside
+// ring->buffer to bind/draw from.
+// the pointer is valid until ring_buffer_unmap, which must be called before the data is used by GL.
+void *ring_buffer_map(struct ring_buffer *ring, size_t size, size_t alignment, size_t *offset);
+void ring_buffer_unmap(struct ring_buffer *ring);
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <stddef.h>
+
+// compiles and links a vertex + fragment program from source. returns the program name, or 0 on
+// failure with the compile/link log written to info_log. retrievable asks the driver to keep the
+// linked binary around so it can be read back with glGetProgramBinary.
+unsigned int shader_build_program(const char *vertex_source, const char *fragment_source,
+    int retrievable, char *info_log, size_t log_size);
+
+// the same in two halves: begin issues compile and link without querying any status, so a driver
+// with KHR_parallel_shader_compile can work on it in the background; end checks the result,
+// releases the shader objects and returns the program (0 on failure, log in info_log).
+unsigned int shader_begin_program(const char *vertex_source, const char *fragment_source, int retrievable);
+unsigned int shader_end_program(unsigned int program, char *info_log, size_t log_size);
+
+#endif
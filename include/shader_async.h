@@ -0,0 +1,82 @@
+#ifndef SHADER_ASYNC_H
+#define SHADER_ASYNC_H
+
+#include <glad/glad.h>
+#include <shader_cache.h>
+
+#include <pthread.h>
+#include <stdint.h>
+
+enum shader_job_state
+{
+    SHADER_JOB_PENDING,
+    SHADER_JOB_READY,
+    SHADER_JOB_FAILED
+};
+
+// handle for one program being built in the background; owned by the compiler
+struct shader_job
+{
+    char *vertex_source;
+    char *fragment_source;
+    char *defines;
+    uint64_t key;
+    unsigned int program;
+    enum shader_job_state state;
+    int worker_done;            // worker path: set under the lock once program and fence are valid
+    GLsync fence;               // worker path: signaled when the shared context finished linking
+    unsigned int cache_hits;    // worker path: cache lookups of this job, counted off the render thread
+    unsigned int cache_misses;
+    char info_log[512];
+    struct shader_job *next;    // submission order
+    struct shader_job *queue_next;
+};
+
+// makes the worker's shared context current on the calling thread
+typedef void (*shader_context_fn)(void *context);
+
+// builds programs without stalling the render thread. with KHR/ARB_parallel_shader_compile the
+// driver compiles in the background and we only poll completion; otherwise a worker thread that
+// owns a context shared with the render context does the work. with neither, jobs are built
+// synchronously on submit.
+struct shader_compiler
+{
+    struct shader_cache *cache;
+    void (*on_ready)(unsigned int program);
+    int parallel;               // driver-side parallel compile available
+    int threaded;               // worker thread running
+    void *worker_context;
+    shader_context_fn make_current;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    int quit;
+    struct shader_job *jobs;
+    struct shader_job *queue_head;
+    struct shader_job *queue_tail;
+    unsigned int pending;
+};
+
+// call on the render thread with its context current. worker_context/make_current may be NULL, in
+// which case only the driver-parallel or synchronous paths are used. on_ready runs on the render
+// thread for every program that finishes (e.g. to set uniform block bindings); it may be NULL.
+void shader_compiler_init(struct shader_compiler *compiler, struct shader_cache *cache,
+    void *worker_context, shader_context_fn make_current, void (*on_ready)(unsigned int program));
+void shader_compiler_shutdown(struct shader_compiler *compiler);
+
+struct shader_job *shader_compiler_submit(struct shader_compiler *compiler, const char *vertex_source,
+    const char *fragment_source, const char *defines);
+
+// render thread, once per frame: retires finished jobs. returns the number still pending.
+unsigned int shader_compiler_poll(struct shader_compiler *compiler);
+
+// deletes a finished (ready or failed) job and its program; pending jobs cannot be released
+void shader_compiler_release(struct shader_compiler *compiler, struct shader_job *job);
+
+// the job's program if it is ready, fallback otherwise
+static inline unsigned int shader_job_program(const struct shader_job *job, unsigned int fallback)
+{
+    return job->state == SHADER_JOB_READY ? job->program : fallback;
+}
+
+#endif
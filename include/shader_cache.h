@@ -0,0 +1,34 @@
+#ifndef SHADER_CACHE_H
+#define SHADER_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// on-disk cache of linked program binaries (ARB_get_program_binary). entries are keyed by a hash
+// of the shader sources, the defines they were built with and the driver vendor/renderer/version,
+// so a driver update simply misses instead of feeding the driver a stale binary.
+struct shader_cache
+{
+    char directory[256];
+    uint64_t driver_hash;
+    int enabled;                // 0 when the driver offers no binary formats
+    unsigned int hits;          // both only counted while enabled
+    unsigned int misses;
+};
+
+// needs a current GL context. directory is created if it does not exist.
+void shader_cache_init(struct shader_cache *cache, const char *directory);
+
+// returns a linked program, loaded from the cache when possible and compiled from source (then
+// stored) otherwise. 0 on failure with the log in info_log.
+unsigned int shader_cache_program(struct shader_cache *cache, const char *vertex_source,
+    const char *fragment_source, const char *defines, char *info_log, size_t log_size);
+
+// the lookup and store steps on their own, for callers that link programs themselves
+// (e.g. asynchronously). load returns 0 on a miss; store expects a program linked as retrievable.
+uint64_t shader_cache_key(const struct shader_cache *cache, const char *vertex_source,
+    const char *fragment_source, const char *defines);
+unsigned int shader_cache_load(struct shader_cache *cache, uint64_t key);
+void shader_cache_store(struct shader_cache *cache, uint64_t key, unsigned int program);
+
+#endif
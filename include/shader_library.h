@@ -0,0 +1,67 @@
+#ifndef SHADER_LIBRARY_H
+#define SHADER_LIBRARY_H
+
+#include <shader_async.h>
+
+#include <stdint.h>
+
+// a program as the driver sees it: fully preprocessed sources. variants whose preprocessed sources
+// hash the same share one of these, so they are compiled once.
+struct shader_source_set
+{
+    uint64_t hash;
+    struct shader_job *job;
+    char **files;               // every file that went into the sources, includes too
+    unsigned int file_count;
+    int stale;                  // one of the files changed on disk since the last update
+};
+
+// one permutation of a named shader: <name>.vert + <name>.frag built with a set of defines
+struct shader_variant
+{
+    char *name;
+    char *defines;              // normalized: sorted, space separated NAME or NAME=VALUE
+    uint64_t key;
+    struct shader_source_set *sources;  // NULL until first use
+    struct shader_source_set *pending;  // rebuilt after an edit; replaces sources once it links
+    int load_failed;
+    int reported;               // a failed build of sources has been logged
+};
+
+// shaders loaded from files in one directory. "#include "file"" is resolved relative to that
+// directory and defines are injected after the #version line, so permutations are specialized at
+// compile time. variants are only preprocessed and compiled the first time they are used.
+struct shader_library
+{
+    char directory[256];
+    struct shader_compiler *compiler;
+    struct shader_variant **variants;
+    unsigned int variant_count;
+    unsigned int variant_capacity;
+    struct shader_source_set **sources;
+    unsigned int source_count;
+    unsigned int source_capacity;
+    int watch_fd;               // inotify descriptor, -1 when not watching
+};
+
+void shader_library_init(struct shader_library *library, const char *directory, struct shader_compiler *compiler);
+void shader_library_shutdown(struct shader_library *library);
+
+// looks up (or registers) a variant. cheap: nothing is read or compiled here.
+// defines is a space or comma separated list like "PULSE COUNT=4"; order does not matter.
+struct shader_variant *shader_library_variant(struct shader_library *library, const char *name, const char *defines);
+
+// starts watching the shader directory for edits (inotify, Linux only). returns 0 if unavailable.
+int shader_library_watch(struct shader_library *library);
+
+// call once per frame, after shader_compiler_poll and before drawing. variants whose files (or
+// includes) changed are rebuilt in the background and swapped in here once they link, so a frame
+// never sees a half-updated set of programs. a rebuild that fails is logged with its info log and
+// the last good program stays in use.
+void shader_library_update(struct shader_library *library);
+
+// the variant's program, or fallback while it is compiling or if it failed to build.
+// the first call reads, preprocesses and submits the variant.
+unsigned int shader_variant_program(struct shader_library *library, struct shader_variant *variant, unsigned int fallback);
+
+#endif
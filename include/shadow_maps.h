@@ -0,0 +1,93 @@
+#ifndef SHADOW_MAPS_H
+#define SHADOW_MAPS_H
+
+#include <camera.h>
+#include <frustum.h>
+#include <render_queue.h>
+#include <ring_buffer.h>
+
+#define SHADOW_CASCADES 4
+// dirty rectangles a cascade can queue before it gives up and re-renders everything
+#define SHADOW_MAX_DIRTY 32
+
+// a rectangle of shadow map texels in absolute light-space texel coordinates, [x0, x1) x [y0, y1)
+struct shadow_rect
+{
+    int x0, y0, x1, y1;
+};
+
+struct shadow_caster
+{
+    const struct render_mesh *mesh;
+    struct render_instance instance;
+    struct aabb bounds;         // world space
+};
+
+struct shadow_cascade
+{
+    float split;                // view distance the cascade reaches to
+    float texel_size;           // world units per texel
+    int origin[2];              // absolute texel of the window's lower-left corner
+    int valid;                  // the cached depth matches origin and texel_size
+    struct shadow_rect dirty[SHADOW_MAX_DIRTY];
+    unsigned int dirty_count;
+    struct shadow_rect dynamic[SHADOW_MAX_DIRTY];   // footprints of last update's dynamic casters
+    unsigned int dynamic_count;
+    float matrix[16];           // world -> shadow map (u, v, depth) for sampling
+};
+
+// cascaded shadow maps for one directional light.
+//
+// every cascade is fitted around a bounding sphere of its slice of the view frustum, so its size
+// does not change as the camera turns, and its window is snapped to whole texels, so it only ever
+// moves by whole texels. the maps are addressed toroidally (GL_REPEAT over absolute texel
+// coordinates): when the window moves, the depth already rendered stays where it is and only the
+// strips that came into view are rendered. static casters are cached this way; dynamic casters
+// are drawn on top each update and the static depth under where they were is restored the next.
+// every rectangle that is rendered culls the casters against its own frustum, so the work follows
+// what moved rather than the size of the scene.
+//
+// rendering is reversed-Z like the camera: depth 1 is closest to the light.
+struct shadow_maps
+{
+    unsigned int texture;       // GL_DEPTH_COMPONENT32F GL_TEXTURE_2D_ARRAY, a layer per cascade
+    unsigned int framebuffer;
+    int size;                   // texels on a side
+    int zero_to_one;            // clip depth range of the camera
+    float direction[3];         // the light travels along this
+    float light_view[16];
+    float depth_range[2];       // light view z covered: everything any caster reaches
+    struct shadow_cascade cascades[SHADOW_CASCADES];
+    struct shadow_caster *casters;  // static ones first, then this update's dynamic ones
+    unsigned int static_count;
+    unsigned int caster_count;
+    unsigned int caster_capacity;
+    unsigned int *visible;      // culling scratch, two lists of caster_capacity
+    unsigned int texels_rendered;   // statistics of the last update
+    unsigned int casters_drawn;
+};
+
+int shadow_maps_init(struct shadow_maps *maps, int size, const float *direction, int zero_to_one);
+void shadow_maps_shutdown(struct shadow_maps *maps);
+
+// changes the light; every cascade is rendered again
+void shadow_maps_set_direction(struct shadow_maps *maps, const float *direction);
+
+// static casters stay until shutdown; adding one re-renders only where it lands. returns 0 if out
+// of memory.
+int shadow_maps_add_static(struct shadow_maps *maps, const struct render_mesh *mesh, const struct render_instance *instance,
+    const struct aabb *bounds);
+// dynamic casters are drawn by the next update only
+int shadow_maps_add_dynamic(struct shadow_maps *maps, const struct render_mesh *mesh,
+    const struct render_instance *instance, const struct aabb *bounds);
+
+// fits the cascades to the camera and renders whatever changed with the depth-only program
+// (depth.vert), through queue. pushes its own Frame blocks, so push the camera's afterwards; leaves
+// the default framebuffer bound.
+void shadow_maps_update(struct shadow_maps *maps, const struct camera *camera, struct ring_buffer *stream,
+    struct render_queue *queue, unsigned int depth_program);
+
+// binds the maps to TEXTURE_UNIT_SHADOWS and pushes the Shadows block
+void shadow_maps_bind(const struct shadow_maps *maps, struct ring_buffer *stream);
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef TEXTURE_STREAM_H
+#define TEXTURE_STREAM_H
+
+#include <mip.h>
+#include <ring_buffer.h>
+#include <thread_pool.h>
+
+#include <pthread.h>
+#include <stddef.h>
+
+#define TEXTURE_MAX_MIPS MIP_MAX_LEVELS
+
+enum texture_state
+{
+    TEXTURE_LOADING,
+    TEXTURE_DECODED,
+    TEXTURE_FAILED
+};
+
+struct texture_streamer;
+
+// a streamed texture. the GL name exists from the start but samples as incomplete (black) until
+// the first, coarsest mip arrives; finer levels follow while it keeps being used.
+struct texture
+{
+    unsigned int id;
+    char path[256];
+    int srgb;
+    unsigned int format;        // GL internal format of the mips
+    int compressed;             // mips hold BCn blocks, uploaded with glCompressedTexImage2D
+    enum texture_state state;   // written by the decode worker under the streamer lock
+    int streaming;              // GL thread's copy: decode finished, mips may be uploaded
+    unsigned int mip_count;
+    struct mip_level mips[TEXTURE_MAX_MIPS];  // level 0 finest; pixels are freed once in VRAM
+    unsigned int resident_base; // finest level in VRAM, mip_count while nothing is
+    size_t resident_bytes;
+    unsigned long last_used;    // streamer frame of the last texture_streamer_use
+    unsigned char *file;        // read but not yet decoded
+    size_t file_size;
+    struct texture_streamer *streamer;
+    struct texture *next;
+    struct texture *next_read;  // in the streamer's read queue
+};
+
+// reads files in batches through the vfs, decodes images on a thread pool and uploads them through
+// a fenced pixel unpack buffer, so the GL thread only ever copies already decoded mips and never
+// waits on the driver. VRAM use is held under budget by dropping the finest mips of the least
+// recently used textures. decoded mips are only kept in memory until they are uploaded, so a
+// level that is evicted and wanted again costs a read and decode of the file.
+struct texture_streamer
+{
+    struct thread_pool *pool;
+    struct ring_buffer staging; // bound as GL_PIXEL_UNPACK_BUFFER for uploads
+    pthread_mutex_t lock;
+    struct texture *textures;
+    struct texture *read_queue; // loads not read yet, under lock
+    int reading;                // a read task is scheduled or running
+    size_t budget;
+    size_t resident;
+    unsigned long frame;
+    unsigned int uploads;       // levels uploaded by the last update
+    unsigned int evictions;     // levels evicted by the last update
+    unsigned int reloads;       // files the last update queued for reading again
+};
+
+// upload_per_frame bounds how many bytes of texels one update may upload
+int texture_streamer_init(struct texture_streamer *streamer, struct thread_pool *pool, size_t budget,
+    size_t upload_per_frame);
+// waits for outstanding decodes on the pool, then frees every texture
+void texture_streamer_shutdown(struct texture_streamer *streamer);
+
+// queues path for reading and decoding and returns immediately. loads requested close together
+// are read as one batch, in pack file order. block compressed files (BC_TEXTURE_EXTENSION)
+// are uploaded as they are when the driver supports their format, and decoded on the CPU otherwise;
+// their own sRGB flag replaces srgb.
+struct texture *texture_streamer_load(struct texture_streamer *streamer, const char *path, int srgb);
+
+// marks the texture as needed this frame and returns its GL name for binding. call it when
+// drawing, after this frame's texture_streamer_update.
+unsigned int texture_streamer_use(struct texture_streamer *streamer, struct texture *texture);
+
+// once per frame on the GL thread: uploads the next mips coarse-first and enforces the budget
+void texture_streamer_update(struct texture_streamer *streamer);
+
+#endif
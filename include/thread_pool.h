@@ -0,0 +1,46 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <pthread.h>
+
+typedef void (*thread_pool_fn)(void *arg);
+typedef void (*thread_pool_for_fn)(void *arg, unsigned int index);
+
+struct thread_pool_task
+{
+    thread_pool_fn fn;
+    void *arg;
+    struct thread_pool_task *next;
+};
+
+// fixed set of worker threads pulling tasks from a FIFO queue
+struct thread_pool
+{
+    pthread_t *threads;
+    unsigned int thread_count;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;        // signaled when a task is queued or on shutdown
+    pthread_cond_t idle;        // signaled when the last outstanding task finishes
+    struct thread_pool_task *head;
+    struct thread_pool_task *tail;
+    unsigned int outstanding;   // queued + running
+    int quit;
+};
+
+// thread_count 0 picks one thread per online core
+int thread_pool_init(struct thread_pool *pool, unsigned int thread_count);
+// finishes every queued task, then joins the workers
+void thread_pool_shutdown(struct thread_pool *pool);
+
+int thread_pool_submit(struct thread_pool *pool, thread_pool_fn fn, void *arg);
+// blocks until every task submitted so far has finished
+void thread_pool_wait(struct thread_pool *pool);
+
+// runs fn(arg, i) for i in [0, count) on the pool and the calling thread, returning when all are
+// done. the caller works through indices itself, so this is safe to call from inside a pool task.
+// pool may be NULL to run everything on the caller.
+void thread_pool_parallel_for(struct thread_pool *pool, unsigned int count, thread_pool_for_fn fn, void *arg);
+
+unsigned int thread_pool_cpu_count(void);
+
+#endif
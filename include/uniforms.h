@@ -0,0 +1,61 @@
+#ifndef UNIFORMS_H
+#define UNIFORMS_H
+
+#include <ring_buffer.h>
+
+// CPU mirrors of the std140 uniform blocks declared in the shaders. every member is a vec4 or mat4
+// so the C layout matches std140 without padding rules; keep both sides in sync.
+
+// block "Frame": written once per frame
+struct frame_uniforms
+{
+    float view[16];
+    float projection[16];
+    float view_projection[16];
+    float camera_position[4];
+    float time[4];              // x = seconds since start, y = frame delta
+};
+
+// block "Material": one per material, shared by every draw using it
+struct material_uniforms
+{
+    float color[4];
+};
+
+// block "Draw": one per draw call
+struct draw_uniforms
+{
+    float model[16];
+};
+
+// binding points; programs are pointed at these by uniforms_bind_blocks
+enum uniform_binding
+{
+    UNIFORM_BINDING_FRAME = 0,
+    UNIFORM_BINDING_MATERIAL = 1,
+    UNIFORM_BINDING_DRAW = 2,
+    UNIFORM_BINDING_LIGHTING = 3,   // cluster lookup constants, see include/light_clusters.h
+    UNIFORM_BINDING_SHADOWS = 4     // cascade matrices and splits, see include/shadow_maps.h
+};
+
+// texture units of the samplers shared by every shader, by sampler name
+enum texture_unit
+{
+    TEXTURE_UNIT_ATLAS = 0,     // "atlas": sampler2DArray of material textures
+    TEXTURE_UNIT_MATERIALS = 1, // "materials": samplerBuffer holding the material table
+    TEXTURE_UNIT_LIGHTS = 2,    // "lights": samplerBuffer of struct light
+    TEXTURE_UNIT_LIGHT_GRID = 3,    // "lightGrid": usamplerBuffer, offset and count per cluster
+    TEXTURE_UNIT_LIGHT_INDICES = 4, // "lightIndices": usamplerBuffer of light indices
+    TEXTURE_UNIT_SHADOWS = 5,   // "shadowMap": sampler2DArrayShadow, a layer per cascade
+    TEXTURE_UNIT_ALBEDO = 6     // "albedo": sampler2D, a streamed surface texture
+};
+
+// routes the uniform blocks of a linked program (Frame, Material, Draw, Lighting, Shadows) to their
+// binding points and its samplers to their texture units. anything the program does not declare is skipped.
+void uniforms_bind_blocks(unsigned int program);
+
+// copies a block into the stream buffer and binds that range with glBindBufferRange.
+// returns 0 if this frame's partition is full.
+int uniforms_push(struct ring_buffer *ring, enum uniform_binding binding, const void *data, size_t size);
+
+#endif
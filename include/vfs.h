@@ -0,0 +1,24 @@
+#ifndef VFS_H
+#define VFS_H
+
+#include <pack.h>
+#include <thread_pool.h>
+
+#include <stddef.h>
+
+#define VFS_MAX_MOUNTS 8
+
+// every asset loader reads through here. a path under a mount point is looked up in that pack
+// (most recent mount first) with the mount point stripped off; anything not found in a pack is
+// read from disk. mount and unmount before and after loading, not while loaders run.
+int vfs_mount(const char *pack_path, const char *mount_point);
+void vfs_unmount_all(void);
+
+// malloc'ed contents with a NUL after the last byte, so text can be used as a string. NULL on failure.
+unsigned char *vfs_read(const char *path, size_t *size);
+// reads many files at once: the packed ones go through one offset-ordered pack_read_batch per pack.
+// data[i] and sizes[i] are filled in as by vfs_read.
+void vfs_read_batch(const char *const *paths, unsigned int count, unsigned char **data, size_t *sizes,
+    struct thread_pool *pool);
+
+#endif
@@ -0,0 +1,14 @@
+#version 330 core
+#include "uniforms.glsl"
+
+out vec4 FragColor;
+
+void main()
+{
+    vec4 result = color;
+#ifdef PULSE
+    // compiled in only for the PULSE variant, never branched on at runtime
+    result.rgb *= 0.75 + 0.25 * sin(time.x * 3.0);
+#endif
+    FragColor = result;
+}
@@ -0,0 +1,9 @@
+#version 330 core
+#include "uniforms.glsl"
+
+layout (location = 0) in vec3 aPos;
+
+void main()
+{
+    gl_Position = viewProjection * model * vec4(aPos, 1.0);
+}
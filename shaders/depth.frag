@@ -0,0 +1,16 @@
+#version 330 core
+
+// depth only for the Z-prepass. with COUNT_FRAGMENTS every fragment adds 1 to the overdraw
+// counter target instead (additive blending).
+#ifdef COUNT_FRAGMENTS
+out float fragmentCount;
+
+void main()
+{
+    fragmentCount = 1.0;
+}
+#else
+void main()
+{
+}
+#endif
@@ -0,0 +1,16 @@
+#version 330 core
+#include "uniforms.glsl"
+
+layout (location = 0) in vec3 aPos;
+
+// per instance; mirrors struct render_instance in include/render_queue.h
+layout (location = 4) in mat4 instanceModel;
+
+// the shaded pass tests against this depth with GL_EQUAL, so both must compute the exact same
+// position: same expression, and invariant on either side
+invariant gl_Position;
+
+void main()
+{
+    gl_Position = viewProjection * instanceModel * vec4(aPos, 1.0);
+}
@@ -0,0 +1,59 @@
+// clustered forward lighting; mirrors include/light_clusters.h. the lights touching each cluster
+// of the view frustum are listed on the CPU every frame, so a fragment only loops over its own.
+#define LIGHT_CLUSTERS_X 16
+#define LIGHT_CLUSTERS_Y 9
+#define LIGHT_CLUSTERS_Z 24
+#define LIGHT_TEXELS 3
+
+uniform samplerBuffer lights;
+uniform usamplerBuffer lightGrid;       // per cluster: offset and count into lightIndices
+uniform usamplerBuffer lightIndices;
+
+layout (std140) uniform Lighting
+{
+    vec4 clusterScale;      // xy = clusters per pixel, z/w = depth slice = log(depth) * z + w
+};
+
+struct Light
+{
+    vec3 position;
+    float radius;
+    vec3 color;
+    float spotInner;        // cosines of the cone's half angles; spotOuter below -1 for point lights
+    vec3 direction;
+    float spotOuter;
+};
+
+Light fetchLight(uint index)
+{
+    int base = int(index) * LIGHT_TEXELS;
+    vec4 positionRadius = texelFetch(lights, base);
+    vec4 colorInner = texelFetch(lights, base + 1);
+    vec4 directionOuter = texelFetch(lights, base + 2);
+    return Light(positionRadius.xyz, positionRadius.w, colorInner.rgb, colorInner.w, directionOuter.xyz,
+        directionOuter.w);
+}
+
+// diffuse light at a world position from every light of the fragment's cluster. viewDepth is the
+// distance in front of the camera.
+vec3 clusteredLighting(vec3 position, vec3 normal, float viewDepth)
+{
+    ivec3 cluster = ivec3(gl_FragCoord.xy * clusterScale.xy, log(max(viewDepth, 1e-4)) * clusterScale.z + clusterScale.w);
+    cluster = clamp(cluster, ivec3(0), ivec3(LIGHT_CLUSTERS_X - 1, LIGHT_CLUSTERS_Y - 1, LIGHT_CLUSTERS_Z - 1));
+    uvec2 range = texelFetch(lightGrid, (cluster.z * LIGHT_CLUSTERS_Y + cluster.y) * LIGHT_CLUSTERS_X + cluster.x).xy;
+
+    vec3 result = vec3(0.0);
+    for (uint i = 0u; i < range.y; i++)
+    {
+        Light light = fetchLight(texelFetch(lightIndices, int(range.x + i)).x);
+        vec3 toLight = light.position - position;
+        float distanceSq = dot(toLight, toLight);
+        vec3 direction = toLight * inversesqrt(max(distanceSq, 1e-8));
+        // inverse square, windowed to reach zero at the radius the CPU binned with
+        float window = clamp(1.0 - distanceSq * distanceSq / pow(light.radius, 4.0), 0.0, 1.0);
+        float attenuation = window * window / (distanceSq + 1.0);
+        float spot = light.spotOuter < -1.0 ? 1.0 : smoothstep(light.spotOuter, light.spotInner, dot(-direction, light.direction));
+        result += light.color * max(dot(normal, direction), 0.0) * attenuation * spot;
+    }
+    return result;
+}
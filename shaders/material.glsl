@@ -0,0 +1,22 @@
+// the material table; mirrors struct material in include/material.h. the entry type has its own
+// name because "Material" is taken by the uniform block
+#define MATERIAL_TEXELS 3
+
+uniform samplerBuffer materials;
+
+struct MaterialEntry
+{
+    vec4 color;
+    vec4 uvRect;            // atlas region: offset.xy, scale.xy
+    float layer;            // texture array layer
+};
+
+MaterialEntry fetchMaterial(uint index)
+{
+    int base = int(index) * MATERIAL_TEXELS;
+    MaterialEntry material;
+    material.color = texelFetch(materials, base);
+    material.uvRect = texelFetch(materials, base + 1);
+    material.layer = texelFetch(materials, base + 2).x;
+    return material;
+}
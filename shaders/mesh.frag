@@ -0,0 +1,22 @@
+#version 330 core
+#include "lighting.glsl"
+#include "shadows.glsl"
+
+in vec3 worldPosition;
+in vec3 normal;
+in float viewDepth;
+in vec4 tint;
+
+uniform sampler2D albedo;
+
+out vec4 FragColor;
+
+void main()
+{
+    vec3 n = normalize(normal);
+    float sun = max(dot(n, sunDirection.xyz), 0.0) * sunShadow(worldPosition, n, viewDepth);
+    vec3 light = vec3(0.1 + 0.4 * sun) + clusteredLighting(worldPosition, n, viewDepth);
+    // box mapped from world space, one repeat per unit: a whole image on each face of a unit cube
+    vec2 uv = abs(n.x) > 0.5 ? worldPosition.zy : abs(n.y) > 0.5 ? worldPosition.xz : worldPosition.xy;
+    FragColor = vec4(tint.rgb * texture(albedo, uv).rgb * light, tint.a);
+}
@@ -0,0 +1,29 @@
+#version 330 core
+#include "uniforms.glsl"
+#include "material.glsl"
+
+layout (location = 0) in vec3 aPos;
+layout (location = 2) in vec3 aNormal;
+
+// per instance; mirrors struct render_instance in include/render_queue.h
+layout (location = 4) in mat4 instanceModel;
+layout (location = 8) in uint instanceMaterial;
+
+// matches the Z-prepass in depth.vert bit for bit
+invariant gl_Position;
+
+out vec3 worldPosition;
+out vec3 normal;
+out float viewDepth;
+out vec4 tint;
+
+void main()
+{
+    vec4 world = instanceModel * vec4(aPos, 1.0);
+    worldPosition = world.xyz;
+    viewDepth = -(view * world).z;
+    // the models are rotations, translations and uniform scales, so no inverse transpose
+    normal = mat3(instanceModel) * aNormal;
+    tint = fetchMaterial(instanceMaterial).color;
+    gl_Position = viewProjection * instanceModel * vec4(aPos, 1.0);
+}
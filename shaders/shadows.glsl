@@ -0,0 +1,26 @@
+// cascaded shadows of the sun; mirrors include/shadow_maps.h. the map is addressed with absolute
+// texel coordinates and wraps, so the matrices map straight from world space.
+#define SHADOW_CASCADES 4
+
+uniform sampler2DArrayShadow shadowMap;
+
+layout (std140) uniform Shadows
+{
+    mat4 shadowMatrices[SHADOW_CASCADES];   // world -> (u, v, depth)
+    vec4 shadowSplits;      // view distance each cascade reaches to
+    vec4 shadowTexelSizes;  // world units per texel
+    vec4 sunDirection;      // xyz towards the light
+};
+
+// 1 where the sun reaches, 0 in shadow; hardware 2x2 PCF in between
+float sunShadow(vec3 position, vec3 normal, float viewDepth)
+{
+    int cascade = 0;
+    while (cascade < SHADOW_CASCADES && viewDepth > shadowSplits[cascade])
+        cascade++;
+    if (cascade == SHADOW_CASCADES)
+        return 1.0;
+    // offset along the normal, by the texel size, against acne on surfaces facing away
+    vec4 coord = shadowMatrices[cascade] * vec4(position + normal * shadowTexelSizes[cascade] * 1.5, 1.0);
+    return texture(shadowMap, vec4(coord.xy, float(cascade), coord.z));
+}
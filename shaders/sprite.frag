@@ -0,0 +1,13 @@
+#version 330 core
+
+in vec3 texCoord;
+in vec4 tint;
+
+out vec4 FragColor;
+
+uniform sampler2DArray atlas;
+
+void main()
+{
+    FragColor = texture(atlas, texCoord) * tint;
+}
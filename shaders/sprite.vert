@@ -0,0 +1,24 @@
+#version 330 core
+#include "uniforms.glsl"
+#include "material.glsl"
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTexCoord;
+
+// per instance; mirrors struct render_instance in include/render_queue.h
+layout (location = 4) in mat4 instanceModel;
+layout (location = 8) in uint instanceMaterial;
+
+// matches the Z-prepass in depth.vert bit for bit
+invariant gl_Position;
+
+out vec3 texCoord;
+out vec4 tint;
+
+void main()
+{
+    MaterialEntry material = fetchMaterial(instanceMaterial);
+    texCoord = vec3(material.uvRect.xy + aTexCoord * material.uvRect.zw, material.layer);
+    tint = material.color;
+    gl_Position = viewProjection * instanceModel * vec4(aPos, 1.0);
+}
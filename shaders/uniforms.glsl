@@ -0,0 +1,19 @@
+// std140 blocks shared by every shader; mirrors include/uniforms.h
+layout (std140) uniform Frame
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    vec4 time;              // x = seconds since start, y = frame delta
+};
+
+layout (std140) uniform Material
+{
+    vec4 color;
+};
+
+layout (std140) uniform Draw
+{
+    mat4 model;
+};
@@ -0,0 +1,314 @@
+#include <atlas.h>
+#include <glad/glad.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+// the top edge of the packed area of a layer, as runs of equal height from left to right
+struct skyline_node
+{
+    int x;
+    int y;
+    int width;
+};
+
+struct skyline
+{
+    struct skyline_node *nodes;
+    unsigned int count;
+    int size;
+};
+
+struct placement
+{
+    int x;
+    int y;
+    unsigned int layer;
+    int width;                  // reserved rectangle, gutter and alignment included
+    int height;
+};
+
+static int skyline_init(struct skyline *skyline, int size)
+{
+    // a rectangle splits at most one node into three, so count never exceeds size + 1
+    skyline->nodes = (struct skyline_node *)malloc(sizeof(struct skyline_node) * ((size_t)size + 1));
+    if (skyline->nodes == NULL)
+        return 0;
+    skyline->nodes[0].x = 0;
+    skyline->nodes[0].y = 0;
+    skyline->nodes[0].width = size;
+    skyline->count = 1;
+    skyline->size = size;
+    return 1;
+}
+
+// the height a width x height rectangle rests at when its left edge is at node index, -1 if it
+// does not fit there
+static int skyline_fit(const struct skyline *skyline, unsigned int index, int width, int height)
+{
+    int y = 0, remaining = width;
+
+    if (skyline->nodes[index].x + width > skyline->size)
+        return -1;
+    while (remaining > 0)
+    {
+        if (index >= skyline->count)
+            return -1;
+        if (skyline->nodes[index].y > y)
+            y = skyline->nodes[index].y;
+        if (y + height > skyline->size)
+            return -1;
+        remaining -= skyline->nodes[index].width;
+        index++;
+    }
+    return y;
+}
+
+// bottom-left rule: the lowest position, leftmost among equals. returns 0 if nothing fits.
+static int skyline_insert(struct skyline *skyline, int width, int height, int *x, int *y)
+{
+    int best_y = -1;
+    unsigned int best = 0, i;
+
+    for (i = 0; i < skyline->count; i++)
+    {
+        int fit = skyline_fit(skyline, i, width, height);
+        if (fit >= 0 && (best_y < 0 || fit < best_y))
+        {
+            best_y = fit;
+            best = i;
+        }
+    }
+    if (best_y < 0)
+        return 0;
+
+    *x = skyline->nodes[best].x;
+    *y = best_y;
+
+    // the new node covers [x, x + width); trim or drop the nodes it shadows
+    memmove(&skyline->nodes[best + 1], &skyline->nodes[best], sizeof(struct skyline_node) * (skyline->count - best));
+    skyline->count++;
+    skyline->nodes[best].x = *x;
+    skyline->nodes[best].y = best_y + height;
+    skyline->nodes[best].width = width;
+    for (i = best + 1; i < skyline->count;)
+    {
+        struct skyline_node *node = &skyline->nodes[i];
+        int shadow = *x + width - node->x;
+        if (shadow <= 0)
+            break;
+        if (shadow < node->width)
+        {
+            node->x += shadow;
+            node->width -= shadow;
+            break;
+        }
+        memmove(node, node + 1, sizeof(struct skyline_node) * (skyline->count - i - 1));
+        skyline->count--;
+    }
+    // merge runs that ended up at the same height
+    for (i = 0; i + 1 < skyline->count;)
+    {
+        if (skyline->nodes[i].y == skyline->nodes[i + 1].y)
+        {
+            skyline->nodes[i].width += skyline->nodes[i + 1].width;
+            memmove(&skyline->nodes[i + 1], &skyline->nodes[i + 2],
+                sizeof(struct skyline_node) * (skyline->count - i - 2));
+            skyline->count--;
+        }
+        else
+            i++;
+    }
+    return 1;
+}
+
+// an image's place in the packing order, with the size it is sorted by
+struct image_key
+{
+    int width;
+    int height;
+    unsigned int index;
+};
+
+// tallest first, then widest: the usual order that keeps a skyline flat. ties keep their index
+// order, so the layout doesn't depend on the qsort implementation.
+static int compare_images(const void *a, const void *b)
+{
+    const struct image_key *ka = (const struct image_key *)a, *kb = (const struct image_key *)b;
+
+    if (ka->height != kb->height)
+        return kb->height - ka->height;
+    if (ka->width != kb->width)
+        return kb->width - ka->width;
+    return ka->index < kb->index ? -1 : ka->index > kb->index;
+}
+
+static int align_up(int value, int alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// plans every rectangle; returns the number of layers used, 0 on failure
+static unsigned int pack(const struct mip_level *images, unsigned int count, int size, int padding, int alignment,
+    struct placement *placements)
+{
+    struct skyline *layers = NULL;
+    struct image_key *order = (struct image_key *)malloc(sizeof(struct image_key) * (count ? count : 1));
+    unsigned int layer_count = 0, i, layer;
+    int failed = order == NULL;
+
+    for (i = 0; !failed && i < count; i++)
+    {
+        order[i].width = images[i].width;
+        order[i].height = images[i].height;
+        order[i].index = i;
+    }
+    if (!failed)
+        qsort(order, count, sizeof(struct image_key), compare_images);
+
+    for (i = 0; !failed && i < count; i++)
+    {
+        struct placement *placement = &placements[order[i].index];
+        placement->width = align_up(order[i].width + 2 * padding, alignment);
+        placement->height = align_up(order[i].height + 2 * padding, alignment);
+        if (placement->width > size || placement->height > size)
+        {
+            failed = 1;
+            break;
+        }
+        for (layer = 0; layer < layer_count; layer++)
+        {
+            if (skyline_insert(&layers[layer], placement->width, placement->height, &placement->x, &placement->y))
+                break;
+        }
+        if (layer == layer_count)
+        {
+            struct skyline *grown = (struct skyline *)realloc(layers, sizeof(struct skyline) * (layer_count + 1));
+            if (grown == NULL || !skyline_init(&grown[layer_count], size))
+            {
+                layers = grown != NULL ? grown : layers;
+                failed = 1;
+                break;
+            }
+            layers = grown;
+            layer_count++;
+            skyline_insert(&layers[layer], placement->width, placement->height, &placement->x, &placement->y);
+        }
+        placement->layer = layer;
+    }
+
+    for (layer = 0; layer < layer_count; layer++)
+        free(layers[layer].nodes);
+    free(layers);
+    free(order);
+    return failed ? 0 : layer_count;
+}
+
+// copies image into the middle of a larger one whose border repeats its edge texels
+static int pad_image(const struct mip_level *image, int padding, struct mip_level *padded)
+{
+    int x, y;
+
+    padded->width = image->width + 2 * padding;
+    padded->height = image->height + 2 * padding;
+    padded->size = (size_t)padded->width * padded->height * 4;
+    padded->pixels = (unsigned char *)malloc(padded->size);
+    if (padded->pixels == NULL)
+        return 0;
+    for (y = 0; y < padded->height; y++)
+    {
+        int sy = y - padding < 0 ? 0 : y - padding >= image->height ? image->height - 1 : y - padding;
+        for (x = 0; x < padded->width; x++)
+        {
+            int sx = x - padding < 0 ? 0 : x - padding >= image->width ? image->width - 1 : x - padding;
+            memcpy(padded->pixels + ((size_t)y * padded->width + x) * 4,
+                image->pixels + ((size_t)sy * image->width + sx) * 4, 4);
+        }
+    }
+    return 1;
+}
+
+int atlas_build(struct atlas *atlas, const struct mip_level *images, unsigned int count, int size,
+    unsigned int level_count, int srgb, struct atlas_region *regions)
+{
+    struct placement *placements;
+    struct mip_level levels[MIP_MAX_LEVELS];
+    int alignment, padding, max_layers = 0;
+    unsigned int i, level;
+
+    memset(atlas, 0, sizeof(*atlas));
+    if (level_count < 1)
+        level_count = 1;
+    if (level_count > MIP_MAX_LEVELS)
+        level_count = MIP_MAX_LEVELS;
+    // with rectangles on a 2^(levels-1) grid, every mip of an image lands on whole texels of the
+    // same mip of the layer. the gutter covers bilinear taps at the coarsest level.
+    alignment = 1 << (level_count - 1);
+    padding = alignment;
+
+    placements = (struct placement *)calloc(count ? count : 1, sizeof(struct placement));
+    if (placements == NULL)
+        return 0;
+    atlas->layer_count = pack(images, count, size, padding, alignment, placements);
+    glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &max_layers);
+    if (atlas->layer_count == 0 || atlas->layer_count > (unsigned int)max_layers)
+    {
+        free(placements);
+        return 0;
+    }
+    atlas->size = size;
+    atlas->level_count = level_count;
+
+    glGenTextures(1, &atlas->texture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, atlas->texture);
+    for (level = 0; level < level_count; level++)
+    {
+        int level_size = size >> level > 0 ? size >> level : 1;
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, (GLint)level, srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8, level_size, level_size,
+            (GLsizei)atlas->layer_count, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    }
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, (GLint)level_count - 1);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, level_count > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    for (i = 0; i < count; i++)
+    {
+        const struct placement *placement = &placements[i];
+        unsigned int built;
+
+        if (!pad_image(&images[i], padding, &levels[0]))
+        {
+            atlas_destroy(atlas);
+            free(placements);
+            return 0;
+        }
+        // box filtered, so each level only mixes texels of its own image and gutter
+        built = mip_generate(levels, level_count, MIP_FILTER_BOX, srgb, NULL);
+        for (level = 0; level < built; level++)
+        {
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, (GLint)level, placement->x >> level, placement->y >> level,
+                (GLint)placement->layer, levels[level].width, levels[level].height, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                levels[level].pixels);
+        }
+        mip_free(levels, built);
+        free(levels[0].pixels);
+
+        regions[i].uv_rect[0] = (float)(placement->x + padding) / size;
+        regions[i].uv_rect[1] = (float)(placement->y + padding) / size;
+        regions[i].uv_rect[2] = (float)images[i].width / size;
+        regions[i].uv_rect[3] = (float)images[i].height / size;
+        regions[i].layer = (float)placement->layer;
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    free(placements);
+    return 1;
+}
+
+void atlas_destroy(struct atlas *atlas)
+{
+    if (atlas->texture)
+        glDeleteTextures(1, &atlas->texture);
+    memset(atlas, 0, sizeof(*atlas));
+}
@@ -0,0 +1,741 @@
+#include <bc.h>
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// blocks per parallel task, so narrow images still hand out a few rows at a time
+#define BAND_BLOCKS 4096
+
+// texels split by channel, so four texels of one channel are one SIMD load
+struct block
+{
+    float c[4][16];
+};
+
+static const int bc7_weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+static int clamp_int(int v, int lo, int hi)
+{
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+static float clamp_float(float v)
+{
+    return v < 0.0f ? 0.0f : v > 255.0f ? 255.0f : v;
+}
+
+static void load_block(const unsigned char *rgba, struct block *block)
+{
+    int i, c;
+
+    for (i = 0; i < 16; i++)
+    {
+        for (c = 0; c < 4; c++)
+            block->c[c][i] = rgba[i * 4 + c];
+    }
+}
+
+// picks the nearest palette entry for every texel over channels [first, first + channels) and
+// returns the summed squared error. palette rows hold those channels only.
+static float fit_palette(const struct block *block, int first, int channels, const float (*palette)[4], int levels,
+    unsigned char *indices)
+{
+    float error = 0.0f;
+    int l, c;
+
+#ifdef __SSE2__
+    int g;
+
+    for (g = 0; g < 16; g += 4)
+    {
+        __m128 best = _mm_set1_ps(FLT_MAX);
+        __m128i best_index = _mm_setzero_si128();
+        float lanes[4];
+        int32_t lane_index[4];
+
+        for (l = 0; l < levels; l++)
+        {
+            __m128 distance = _mm_setzero_ps();
+            for (c = 0; c < channels; c++)
+            {
+                __m128 d = _mm_sub_ps(_mm_loadu_ps(&block->c[first + c][g]), _mm_set1_ps(palette[l][c]));
+                distance = _mm_add_ps(distance, _mm_mul_ps(d, d));
+            }
+            __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+            best = _mm_min_ps(distance, best);
+            best_index = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(l)), _mm_andnot_si128(closer, best_index));
+        }
+        _mm_storeu_ps(lanes, best);
+        _mm_storeu_si128((__m128i *)lane_index, best_index);
+        for (c = 0; c < 4; c++)
+        {
+            indices[g + c] = (unsigned char)lane_index[c];
+            error += lanes[c];
+        }
+    }
+#else
+    int i;
+
+    for (i = 0; i < 16; i++)
+    {
+        float best = FLT_MAX;
+        for (l = 0; l < levels; l++)
+        {
+            float distance = 0.0f;
+            for (c = 0; c < channels; c++)
+            {
+                float d = block->c[first + c][i] - palette[l][c];
+                distance += d * d;
+            }
+            if (distance < best)
+            {
+                best = distance;
+                indices[i] = (unsigned char)l;
+            }
+        }
+        error += best;
+    }
+#endif
+    return error;
+}
+
+// endpoints spanning the texels along their principal axis
+static void principal_endpoints(const struct block *block, int first, int channels, float *e0, float *e1)
+{
+    float mean[4] = { 0 }, covariance[4][4] = { { 0 } }, axis[4], lo = FLT_MAX, hi = -FLT_MAX;
+    int i, j, c, iteration;
+
+    for (c = 0; c < channels; c++)
+    {
+        float min = 255.0f, max = 0.0f;
+        for (i = 0; i < 16; i++)
+        {
+            float v = block->c[first + c][i];
+            mean[c] += v;
+            min = v < min ? v : min;
+            max = v > max ? v : max;
+        }
+        mean[c] /= 16.0f;
+        axis[c] = max - min;
+    }
+    for (i = 0; i < 16; i++)
+    {
+        for (c = 0; c < channels; c++)
+        {
+            for (j = 0; j < channels; j++)
+                covariance[c][j] += (block->c[first + c][i] - mean[c]) * (block->c[first + j][i] - mean[j]);
+        }
+    }
+
+    // a few power iterations from the bounding box diagonal are plenty for 16 points
+    for (iteration = 0; iteration < 8; iteration++)
+    {
+        float next[4], scale = 0.0f;
+        for (c = 0; c < channels; c++)
+        {
+            next[c] = 0.0f;
+            for (j = 0; j < channels; j++)
+                next[c] += covariance[c][j] * axis[j];
+            scale = fabsf(next[c]) > scale ? fabsf(next[c]) : scale;
+        }
+        if (scale == 0.0f)
+            break;
+        for (c = 0; c < channels; c++)
+            axis[c] = next[c] / scale;
+    }
+
+    float length = 0.0f;
+    for (c = 0; c < channels; c++)
+        length += axis[c] * axis[c];
+    if (length == 0.0f)
+    {
+        for (c = 0; c < channels; c++)
+            e0[c] = e1[c] = mean[c];
+        return;
+    }
+    for (i = 0; i < 16; i++)
+    {
+        float t = 0.0f;
+        for (c = 0; c < channels; c++)
+            t += (block->c[first + c][i] - mean[c]) * axis[c];
+        lo = t < lo ? t : lo;
+        hi = t > hi ? t : hi;
+    }
+    for (c = 0; c < channels; c++)
+    {
+        e0[c] = clamp_float(mean[c] + axis[c] * lo / length);
+        e1[c] = clamp_float(mean[c] + axis[c] * hi / length);
+    }
+}
+
+// endpoints minimizing the squared error for fixed indices, where index k blends weights[k] of e1.
+// returns 0 when every texel uses the same weight.
+static int least_squares(const struct block *block, int first, int channels, const unsigned char *indices,
+    const float *weights, float *e0, float *e1)
+{
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f, ap[4] = { 0 }, bp[4] = { 0 };
+    int i, c;
+
+    for (i = 0; i < 16; i++)
+    {
+        float b = weights[indices[i]], a = 1.0f - b;
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for (c = 0; c < channels; c++)
+        {
+            ap[c] += a * block->c[first + c][i];
+            bp[c] += b * block->c[first + c][i];
+        }
+    }
+    float det = aa * bb - ab * ab;
+    if (fabsf(det) < 1e-6f)
+        return 0;
+    for (c = 0; c < channels; c++)
+    {
+        e0[c] = clamp_float((bb * ap[c] - ab * bp[c]) / det);
+        e1[c] = clamp_float((aa * bp[c] - ab * ap[c]) / det);
+    }
+    return 1;
+}
+
+// ---------------------------------------------------------------------------------------------
+// BC1
+
+static uint16_t pack_565(const float *color)
+{
+    int r = (int)lrintf(color[0] * 31.0f / 255.0f), g = (int)lrintf(color[1] * 63.0f / 255.0f),
+        b = (int)lrintf(color[2] * 31.0f / 255.0f);
+
+    return (uint16_t)((clamp_int(r, 0, 31) << 11) | (clamp_int(g, 0, 63) << 5) | clamp_int(b, 0, 31));
+}
+
+static void unpack_565(uint16_t packed, int *rgb)
+{
+    int r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// the four-color palette in code order: c0, c1, 2/3 c0 + 1/3 c1, 1/3 c0 + 2/3 c1
+static void bc1_palette(uint16_t c0, uint16_t c1, int palette[4][3])
+{
+    int c;
+
+    unpack_565(c0, palette[0]);
+    unpack_565(c1, palette[1]);
+    for (c = 0; c < 3; c++)
+    {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+}
+
+// encodes with the given endpoints in four-color mode. order receives each texel's palette position
+// from c0 to c1 (0..3), which is what least_squares wants.
+static float bc1_try(const struct block *block, const float *e0, const float *e1, unsigned char *out,
+    unsigned char *order)
+{
+    static const unsigned char codes[4] = { 0, 2, 3, 1 };
+    uint16_t c0 = pack_565(e0), c1 = pack_565(e1);
+    int palette[4][3], i, c;
+    float fit[4][4];
+    uint32_t bits = 0;
+
+    // c0 > c1 selects four-color mode; equal endpoints fit every texel to code 0 anyway
+    if (c0 < c1)
+    {
+        uint16_t swap = c0;
+        c0 = c1;
+        c1 = swap;
+    }
+    bc1_palette(c0, c1, palette);
+    for (c = 0; c < 3; c++)
+    {
+        fit[0][c] = (float)palette[0][c];
+        fit[1][c] = (float)palette[2][c];
+        fit[2][c] = (float)palette[3][c];
+        fit[3][c] = (float)palette[1][c];
+    }
+    float error = fit_palette(block, 0, 3, (const float (*)[4])fit, 4, order);
+
+    for (i = 0; i < 16; i++)
+        bits |= (uint32_t)codes[order[i]] << (i * 2);
+    out[0] = (unsigned char)(c0 & 0xff);
+    out[1] = (unsigned char)(c0 >> 8);
+    out[2] = (unsigned char)(c1 & 0xff);
+    out[3] = (unsigned char)(c1 >> 8);
+    for (i = 0; i < 4; i++)
+        out[4 + i] = (unsigned char)(bits >> (i * 8));
+    return error;
+}
+
+static void encode_bc1(const struct block *block, enum bc_quality quality, unsigned char *out)
+{
+    static const float weights[4] = { 0.0f, 1.0f / 3.0f, 2.0f / 3.0f, 1.0f };
+    unsigned char order[16], candidate[8];
+    float e0[4], e1[4], error;
+    int iteration;
+
+    principal_endpoints(block, 0, 3, e0, e1);
+    error = bc1_try(block, e0, e1, out, order);
+    for (iteration = 0; quality == BC_QUALITY_HIGH && iteration < 4 && error > 0.0f; iteration++)
+    {
+        unsigned char next_order[16];
+        if (!least_squares(block, 0, 3, order, weights, e0, e1))
+            break;
+        float next = bc1_try(block, e0, e1, candidate, next_order);
+        if (next >= error)
+            break;
+        error = next;
+        memcpy(out, candidate, sizeof(candidate));
+        memcpy(order, next_order, sizeof(order));
+    }
+}
+
+static void decode_bc1(const unsigned char *in, unsigned char *rgba, int four_color)
+{
+    uint16_t c0 = (uint16_t)(in[0] | (in[1] << 8)), c1 = (uint16_t)(in[2] | (in[3] << 8));
+    uint32_t bits = (uint32_t)in[4] | ((uint32_t)in[5] << 8) | ((uint32_t)in[6] << 16) | ((uint32_t)in[7] << 24);
+    int palette[4][3], alpha[4] = { 255, 255, 255, 255 }, i, c;
+
+    bc1_palette(c0, c1, palette);
+    if (!four_color && c0 <= c1)
+    {
+        // three colors and transparent black
+        for (c = 0; c < 3; c++)
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+        alpha[3] = 0;
+    }
+    for (i = 0; i < 16; i++)
+    {
+        unsigned int code = (bits >> (i * 2)) & 3;
+        for (c = 0; c < 3; c++)
+            rgba[i * 4 + c] = (unsigned char)palette[code][c];
+        rgba[i * 4 + 3] = (unsigned char)alpha[code];
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// BC4, one channel: two 8-bit endpoints and 3-bit indices
+
+// in code order. a0 > a1 interpolates six values between them, otherwise four plus 0 and 255.
+static void bc4_palette(int a0, int a1, int palette[8])
+{
+    int i;
+
+    palette[0] = a0;
+    palette[1] = a1;
+    if (a0 > a1)
+    {
+        for (i = 1; i < 7; i++)
+            palette[i + 1] = ((7 - i) * a0 + i * a1 + 3) / 7;
+    }
+    else
+    {
+        for (i = 1; i < 5; i++)
+            palette[i + 1] = ((5 - i) * a0 + i * a1 + 2) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+static float bc4_try(const struct block *block, int channel, int a0, int a1, unsigned char *out)
+{
+    unsigned char codes[16];
+    int palette[8], i;
+    float fit[8][4];
+    uint64_t bits = 0;
+
+    bc4_palette(a0, a1, palette);
+    for (i = 0; i < 8; i++)
+        fit[i][0] = (float)palette[i];
+    float error = fit_palette(block, channel, 1, (const float (*)[4])fit, 8, codes);
+
+    for (i = 0; i < 16; i++)
+        bits |= (uint64_t)codes[i] << (i * 3);
+    out[0] = (unsigned char)a0;
+    out[1] = (unsigned char)a1;
+    for (i = 0; i < 6; i++)
+        out[2 + i] = (unsigned char)(bits >> (i * 8));
+    return error;
+}
+
+static void encode_bc4(const struct block *block, int channel, enum bc_quality quality, unsigned char *out)
+{
+    int lo = 255, hi = 0, lo_inner = 255, hi_inner = 0, i, d0, d1;
+
+    for (i = 0; i < 16; i++)
+    {
+        int v = (int)block->c[channel][i];
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+        if (v > 0 && v < 255)
+        {
+            lo_inner = v < lo_inner ? v : lo_inner;
+            hi_inner = v > hi_inner ? v : hi_inner;
+        }
+    }
+    float error = bc4_try(block, channel, hi, lo, out);
+    if (quality != BC_QUALITY_HIGH || error == 0.0f)
+        return;
+
+    // nudge both endpoints around the extremes, then try the mode with explicit 0 and 255 for
+    // blocks that have texels there
+    unsigned char candidate[8];
+    for (d0 = -2; d0 <= 2; d0++)
+    {
+        for (d1 = -2; d1 <= 2; d1++)
+        {
+            int a0 = clamp_int(hi + d0, 0, 255), a1 = clamp_int(lo + d1, 0, 255);
+            if (a0 <= a1 || (d0 == 0 && d1 == 0))
+                continue;
+            float next = bc4_try(block, channel, a0, a1, candidate);
+            if (next < error)
+            {
+                error = next;
+                memcpy(out, candidate, sizeof(candidate));
+            }
+        }
+    }
+    if (lo_inner <= hi_inner && (lo == 0 || hi == 255))
+    {
+        float next = bc4_try(block, channel, lo_inner, hi_inner, candidate);
+        if (next < error)
+            memcpy(out, candidate, sizeof(candidate));
+    }
+}
+
+static void decode_bc4(const unsigned char *in, unsigned char *rgba, int channel)
+{
+    uint64_t bits = 0;
+    int palette[8], i;
+
+    bc4_palette(in[0], in[1], palette);
+    for (i = 0; i < 6; i++)
+        bits |= (uint64_t)in[2 + i] << (i * 8);
+    for (i = 0; i < 16; i++)
+        rgba[i * 4 + channel] = (unsigned char)palette[(bits >> (i * 3)) & 7];
+}
+
+// ---------------------------------------------------------------------------------------------
+// BC7 mode 6: one subset, RGBA endpoints of 7 bits plus a shared low bit each, 4-bit indices
+
+static void put_bits(unsigned char *block, int *position, unsigned int value, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++, (*position)++)
+    {
+        if ((value >> i) & 1)
+            block[*position >> 3] |= (unsigned char)(1 << (*position & 7));
+    }
+}
+
+static unsigned int get_bits(const unsigned char *block, int *position, int count)
+{
+    unsigned int value = 0;
+    int i;
+
+    for (i = 0; i < count; i++, (*position)++)
+        value |= (unsigned int)((block[*position >> 3] >> (*position & 7)) & 1) << i;
+    return value;
+}
+
+static int quantize_pbit(float v, int pbit)
+{
+    return clamp_int((int)lrintf((v - pbit) / 2.0f), 0, 127);
+}
+
+// the low bit that best reproduces an endpoint
+static int best_pbit(const float *endpoint)
+{
+    float error[2] = { 0.0f, 0.0f };
+    int p, c;
+
+    for (p = 0; p < 2; p++)
+    {
+        for (c = 0; c < 4; c++)
+        {
+            float d = (float)((quantize_pbit(endpoint[c], p) << 1) | p) - endpoint[c];
+            error[p] += d * d;
+        }
+    }
+    return error[1] < error[0];
+}
+
+static float bc7_try(const struct block *block, const float *e0, const float *e1, int p0, int p1, unsigned char *out,
+    unsigned char *indices)
+{
+    int q0[4], q1[4], v0[4], v1[4], i, c, position = 0;
+    float fit[16][4];
+
+    for (c = 0; c < 4; c++)
+    {
+        q0[c] = quantize_pbit(e0[c], p0);
+        q1[c] = quantize_pbit(e1[c], p1);
+        v0[c] = (q0[c] << 1) | p0;
+        v1[c] = (q1[c] << 1) | p1;
+    }
+    for (i = 0; i < 16; i++)
+    {
+        for (c = 0; c < 4; c++)
+            fit[i][c] = (float)(((64 - bc7_weights[i]) * v0[c] + bc7_weights[i] * v1[c] + 32) >> 6);
+    }
+    float error = fit_palette(block, 0, 4, (const float (*)[4])fit, 16, indices);
+
+    // the first texel's index is stored without its top bit, so it must be below 8
+    if (indices[0] & 8)
+    {
+        for (c = 0; c < 4; c++)
+        {
+            int swap = q0[c];
+            q0[c] = q1[c];
+            q1[c] = swap;
+        }
+        c = p0;
+        p0 = p1;
+        p1 = c;
+        for (i = 0; i < 16; i++)
+            indices[i] = (unsigned char)(15 - indices[i]);
+    }
+
+    memset(out, 0, 16);
+    put_bits(out, &position, 1u << 6, 7);
+    for (c = 0; c < 4; c++)
+    {
+        put_bits(out, &position, (unsigned int)q0[c], 7);
+        put_bits(out, &position, (unsigned int)q1[c], 7);
+    }
+    put_bits(out, &position, (unsigned int)p0, 1);
+    put_bits(out, &position, (unsigned int)p1, 1);
+    put_bits(out, &position, indices[0], 3);
+    for (i = 1; i < 16; i++)
+        put_bits(out, &position, indices[i], 4);
+    return error;
+}
+
+static void encode_bc7(const struct block *block, enum bc_quality quality, unsigned char *out)
+{
+    float weights[16], e0[4], e1[4], error;
+    unsigned char indices[16], candidate[16], candidate_indices[16];
+    int i, iteration, pbits;
+
+    principal_endpoints(block, 0, 4, e0, e1);
+    if (quality != BC_QUALITY_HIGH)
+    {
+        bc7_try(block, e0, e1, best_pbit(e0), best_pbit(e1), out, indices);
+        return;
+    }
+
+    for (i = 0; i < 16; i++)
+        weights[i] = bc7_weights[i] / 64.0f;
+    error = FLT_MAX;
+    for (iteration = 0; iteration < 4 && error > 0.0f; iteration++)
+    {
+        float previous = error;
+        // indices from the best try so far, which may have swapped the endpoints
+        if (iteration > 0 && !least_squares(block, 0, 4, indices, weights, e0, e1))
+            break;
+        for (pbits = 0; pbits < 4; pbits++)
+        {
+            float next = bc7_try(block, e0, e1, pbits & 1, pbits >> 1, candidate, candidate_indices);
+            if (next < error)
+            {
+                error = next;
+                memcpy(out, candidate, sizeof(candidate));
+                memcpy(indices, candidate_indices, sizeof(indices));
+            }
+        }
+        if (error >= previous)
+            break;
+    }
+}
+
+static void decode_bc7(const unsigned char *in, unsigned char *rgba)
+{
+    int q0[4], q1[4], p0, p1, i, c, position = 7;
+
+    if ((in[0] & 0x7f) != 0x40)
+    {
+        for (i = 0; i < 16; i++)
+        {
+            rgba[i * 4 + 0] = 255;
+            rgba[i * 4 + 1] = 0;
+            rgba[i * 4 + 2] = 255;
+            rgba[i * 4 + 3] = 255;
+        }
+        return;
+    }
+    for (c = 0; c < 4; c++)
+    {
+        q0[c] = (int)get_bits(in, &position, 7);
+        q1[c] = (int)get_bits(in, &position, 7);
+    }
+    p0 = (int)get_bits(in, &position, 1);
+    p1 = (int)get_bits(in, &position, 1);
+    for (i = 0; i < 16; i++)
+    {
+        int w = bc7_weights[get_bits(in, &position, i == 0 ? 3 : 4)];
+        for (c = 0; c < 4; c++)
+            rgba[i * 4 + c] = (unsigned char)(((64 - w) * ((q0[c] << 1) | p0) + w * ((q1[c] << 1) | p1) + 32) >> 6);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+
+size_t bc_block_size(enum bc_format format)
+{
+    return format == BC_FORMAT_BC1 || format == BC_FORMAT_BC4 ? 8 : 16;
+}
+
+size_t bc_image_size(enum bc_format format, int width, int height)
+{
+    return (size_t)((width + 3) / 4) * (size_t)((height + 3) / 4) * bc_block_size(format);
+}
+
+void bc_encode_block(enum bc_format format, enum bc_quality quality, const unsigned char *rgba, unsigned char *out)
+{
+    struct block block;
+
+    load_block(rgba, &block);
+    switch (format)
+    {
+    case BC_FORMAT_BC1:
+        encode_bc1(&block, quality, out);
+        break;
+    case BC_FORMAT_BC3:
+        encode_bc4(&block, 3, quality, out);
+        encode_bc1(&block, quality, out + 8);
+        break;
+    case BC_FORMAT_BC4:
+        encode_bc4(&block, 0, quality, out);
+        break;
+    case BC_FORMAT_BC5:
+        encode_bc4(&block, 0, quality, out);
+        encode_bc4(&block, 1, quality, out + 8);
+        break;
+    case BC_FORMAT_BC7:
+        encode_bc7(&block, quality, out);
+        break;
+    }
+}
+
+void bc_decode_block(enum bc_format format, const unsigned char *block, unsigned char *rgba)
+{
+    int i;
+
+    switch (format)
+    {
+    case BC_FORMAT_BC1:
+        decode_bc1(block, rgba, 0);
+        break;
+    case BC_FORMAT_BC3:
+        // the color block of BC3 is always four-color
+        decode_bc1(block + 8, rgba, 1);
+        decode_bc4(block, rgba, 3);
+        break;
+    case BC_FORMAT_BC4:
+    case BC_FORMAT_BC5:
+        for (i = 0; i < 16; i++)
+        {
+            rgba[i * 4 + 1] = 0;
+            rgba[i * 4 + 2] = 0;
+            rgba[i * 4 + 3] = 255;
+        }
+        decode_bc4(block, rgba, 0);
+        if (format == BC_FORMAT_BC5)
+            decode_bc4(block + 8, rgba, 1);
+        break;
+    case BC_FORMAT_BC7:
+        decode_bc7(block, rgba);
+        break;
+    }
+}
+
+struct encode_job
+{
+    const struct mip_level *image;
+    enum bc_format format;
+    enum bc_quality quality;
+    unsigned char *out;
+    int blocks_wide;
+    int blocks_high;
+    int band_rows;
+};
+
+static void encode_band(void *arg, unsigned int band)
+{
+    const struct encode_job *job = (const struct encode_job *)arg;
+    const struct mip_level *image = job->image;
+    size_t block_size = bc_block_size(job->format);
+    unsigned char texels[64];
+    int by, bx, x, y;
+
+    for (by = (int)band * job->band_rows; by < job->blocks_high && by < ((int)band + 1) * job->band_rows; by++)
+    {
+        for (bx = 0; bx < job->blocks_wide; bx++)
+        {
+            for (y = 0; y < 4; y++)
+            {
+                int sy = clamp_int(by * 4 + y, 0, image->height - 1);
+                for (x = 0; x < 4; x++)
+                {
+                    int sx = clamp_int(bx * 4 + x, 0, image->width - 1);
+                    memcpy(texels + (y * 4 + x) * 4, image->pixels + ((size_t)sy * image->width + sx) * 4, 4);
+                }
+            }
+            bc_encode_block(job->format, job->quality, texels,
+                job->out + ((size_t)by * job->blocks_wide + bx) * block_size);
+        }
+    }
+}
+
+void bc_encode(const struct mip_level *image, enum bc_format format, enum bc_quality quality,
+    struct thread_pool *pool, unsigned char *out)
+{
+    struct encode_job job;
+
+    job.image = image;
+    job.format = format;
+    job.quality = quality;
+    job.out = out;
+    job.blocks_wide = (image->width + 3) / 4;
+    job.blocks_high = (image->height + 3) / 4;
+    job.band_rows = pool != NULL ? BAND_BLOCKS / job.blocks_wide : job.blocks_high;
+    if (job.band_rows < 1)
+        job.band_rows = 1;
+    thread_pool_parallel_for(pool, (unsigned int)((job.blocks_high + job.band_rows - 1) / job.band_rows),
+        encode_band, &job);
+}
+
+void bc_decode(enum bc_format format, const unsigned char *data, int width, int height, unsigned char *rgba)
+{
+    int blocks_wide = (width + 3) / 4, blocks_high = (height + 3) / 4, bx, by, x, y;
+    size_t block_size = bc_block_size(format);
+    unsigned char texels[64];
+
+    for (by = 0; by < blocks_high; by++)
+    {
+        for (bx = 0; bx < blocks_wide; bx++)
+        {
+            bc_decode_block(format, data + ((size_t)by * blocks_wide + bx) * block_size, texels);
+            for (y = 0; y < 4 && by * 4 + y < height; y++)
+            {
+                for (x = 0; x < 4 && bx * 4 + x < width; x++)
+                    memcpy(rgba + ((size_t)(by * 4 + y) * width + bx * 4 + x) * 4, texels + (y * 4 + x) * 4, 4);
+            }
+        }
+    }
+}
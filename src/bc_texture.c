@@ -0,0 +1,173 @@
+#include <bc_texture.h>
+#include <glad/glad.h>
+#include <vfs.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BC_TEXTURE_MAGIC 0x58544342u      // "BCTX"
+
+// file layout: header, then the levels' blocks back to back, finest first. level sizes follow from
+// the format and the halved dimensions.
+struct bc_texture_header
+{
+    uint32_t magic;
+    uint32_t format;
+    uint32_t srgb;
+    uint32_t width;
+    uint32_t height;
+    uint32_t level_count;
+};
+
+int bc_texture_build(struct bc_texture *texture, const struct mip_level *levels, unsigned int level_count,
+    enum bc_format format, int srgb, enum bc_quality quality, struct thread_pool *pool)
+{
+    unsigned int i;
+
+    memset(texture, 0, sizeof(*texture));
+    texture->format = format;
+    texture->srgb = srgb;
+    for (i = 0; i < level_count && i < MIP_MAX_LEVELS; i++)
+    {
+        struct mip_level *level = &texture->levels[i];
+        level->width = levels[i].width;
+        level->height = levels[i].height;
+        level->size = bc_image_size(format, level->width, level->height);
+        level->pixels = (unsigned char *)malloc(level->size);
+        if (level->pixels == NULL)
+        {
+            bc_texture_free(texture);
+            return 0;
+        }
+        texture->level_count = i + 1;
+        bc_encode(&levels[i], format, quality, pool, level->pixels);
+    }
+    return 1;
+}
+
+int bc_texture_save(const struct bc_texture *texture, const char *path)
+{
+    struct bc_texture_header header;
+    unsigned int i;
+    int success;
+    FILE *file;
+
+    if (texture->level_count == 0)
+        return 0;
+    file = fopen(path, "wb");
+    if (file == NULL)
+        return 0;
+    header.magic = BC_TEXTURE_MAGIC;
+    header.format = (uint32_t)texture->format;
+    header.srgb = (uint32_t)texture->srgb;
+    header.width = (uint32_t)texture->levels[0].width;
+    header.height = (uint32_t)texture->levels[0].height;
+    header.level_count = texture->level_count;
+    success = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (i = 0; success && i < texture->level_count; i++)
+        success = fwrite(texture->levels[i].pixels, 1, texture->levels[i].size, file) == texture->levels[i].size;
+    success &= fclose(file) == 0;
+    if (!success)
+        remove(path);
+    return success;
+}
+
+int bc_texture_decode(const unsigned char *data, size_t size, struct bc_texture *texture)
+{
+    struct bc_texture_header header;
+    const unsigned char *p = data + sizeof(header), *end = data + size;
+    int width, height;
+    unsigned int i;
+
+    memset(texture, 0, sizeof(*texture));
+    if (size < sizeof(header))
+        return 0;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != BC_TEXTURE_MAGIC || header.format > BC_FORMAT_BC7 || header.level_count == 0 ||
+        header.level_count > MIP_MAX_LEVELS || header.width == 0 || header.height == 0 || header.width > 65536 ||
+        header.height > 65536)
+        return 0;
+
+    texture->format = (enum bc_format)header.format;
+    texture->srgb = header.srgb != 0;
+    width = (int)header.width;
+    height = (int)header.height;
+    for (i = 0; i < header.level_count; i++)
+    {
+        struct mip_level *level = &texture->levels[i];
+        level->width = width;
+        level->height = height;
+        level->size = bc_image_size(texture->format, width, height);
+        if ((size_t)(end - p) < level->size || (level->pixels = (unsigned char *)malloc(level->size)) == NULL)
+        {
+            bc_texture_free(texture);
+            return 0;
+        }
+        memcpy(level->pixels, p, level->size);
+        p += level->size;
+        texture->level_count = i + 1;
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    return 1;
+}
+
+int bc_texture_load(const char *path, struct bc_texture *texture)
+{
+    size_t size = 0;
+    unsigned char *data = vfs_read(path, &size);
+    int ok;
+
+    memset(texture, 0, sizeof(*texture));
+    if (data == NULL)
+        return 0;
+    ok = bc_texture_decode(data, size, texture);
+    free(data);
+    return ok;
+}
+
+void bc_texture_free(struct bc_texture *texture)
+{
+    unsigned int i;
+
+    for (i = 0; i < texture->level_count; i++)
+        free(texture->levels[i].pixels);
+    memset(texture, 0, sizeof(*texture));
+}
+
+unsigned int bc_texture_gl_format(enum bc_format format, int srgb)
+{
+    switch (format)
+    {
+    case BC_FORMAT_BC1:
+        return srgb ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    case BC_FORMAT_BC3:
+        return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case BC_FORMAT_BC4:
+        return GL_COMPRESSED_RED_RGTC1;
+    case BC_FORMAT_BC5:
+        return GL_COMPRESSED_RG_RGTC2;
+    case BC_FORMAT_BC7:
+        return srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_ARB : GL_COMPRESSED_RGBA_BPTC_UNORM_ARB;
+    }
+    return 0;
+}
+
+int bc_texture_supported(enum bc_format format, int srgb)
+{
+    switch (format)
+    {
+    case BC_FORMAT_BC1:
+    case BC_FORMAT_BC3:
+        return GLAD_GL_EXT_texture_compression_s3tc && (!srgb || GLAD_GL_EXT_texture_sRGB);
+    case BC_FORMAT_BC4:
+    case BC_FORMAT_BC5:
+        // RGTC is core since 3.0
+        return 1;
+    case BC_FORMAT_BC7:
+        return GLAD_GL_ARB_texture_compression_bptc || GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 2);
+    }
+    return 0;
+}
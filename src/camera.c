@@ -0,0 +1,65 @@
+#include <glad/glad.h>
+#include <camera.h>
+#include <math3d.h>
+
+#include <math.h>
+#include <string.h>
+
+void camera_init(struct camera *camera, float fov_y, float aspect, float near, int zero_to_one)
+{
+    memset(camera, 0, sizeof(*camera));
+    camera->fov_y = fov_y;
+    camera->aspect = aspect;
+    camera->near = near;
+    camera->zero_to_one = zero_to_one;
+    camera_update(camera);
+}
+
+void camera_axes(const struct camera *camera, float *forward, float *right)
+{
+    float cos_pitch = cosf(camera->pitch);
+
+    forward[0] = sinf(camera->yaw) * cos_pitch;
+    forward[1] = sinf(camera->pitch);
+    forward[2] = -cosf(camera->yaw) * cos_pitch;
+    right[0] = cosf(camera->yaw);
+    right[1] = 0.0f;
+    right[2] = sinf(camera->yaw);
+}
+
+void camera_update(struct camera *camera)
+{
+    const float up[3] = { 0.0f, 1.0f, 0.0f };
+    float forward[3], right[3];
+
+    camera_axes(camera, forward, right);
+    mat4_look_to(camera->view, camera->position, forward, up);
+    mat4_perspective_reversed_infinite(camera->projection, camera->fov_y, camera->aspect, camera->near,
+        camera->zero_to_one);
+    mat4_multiply(camera->view_projection, camera->projection, camera->view);
+    frustum_from_matrix(&camera->frustum, camera->view_projection, camera->zero_to_one);
+}
+
+void camera_fill_uniforms(const struct camera *camera, struct frame_uniforms *frame)
+{
+    memcpy(frame->view, camera->view, sizeof(frame->view));
+    memcpy(frame->projection, camera->projection, sizeof(frame->projection));
+    memcpy(frame->view_projection, camera->view_projection, sizeof(frame->view_projection));
+    memcpy(frame->camera_position, camera->position, sizeof(camera->position));
+    frame->camera_position[3] = 1.0f;
+}
+
+int camera_setup_depth(void)
+{
+    int zero_to_one = 0;
+
+    if (GLAD_GL_ARB_clip_control)
+    {
+        glClipControl(GL_LOWER_LEFT, GL_ZERO_TO_ONE);
+        zero_to_one = 1;
+    }
+    glClearDepth(0.0);
+    glDepthFunc(GL_GREATER);
+    glEnable(GL_DEPTH_TEST);
+    return zero_to_one;
+}
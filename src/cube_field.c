@@ -0,0 +1,26 @@
+#include <cube_field.h>
+#include <obj.h>
+
+#include <math.h>
+
+static const char *cube_obj =
+    "v -0.5 -0.5 -0.5\nv 0.5 -0.5 -0.5\nv 0.5 0.5 -0.5\nv -0.5 0.5 -0.5\n"
+    "v -0.5 -0.5 0.5\nv 0.5 -0.5 0.5\nv 0.5 0.5 0.5\nv -0.5 0.5 0.5\n"
+    "vn 0 0 -1\nvn 0 0 1\nvn -1 0 0\nvn 1 0 0\nvn 0 -1 0\nvn 0 1 0\n"
+    "f 1//1 4//1 3//1 2//1\nf 5//2 6//2 7//2 8//2\nf 1//3 5//3 8//3 4//3\n"
+    "f 2//4 3//4 7//4 6//4\nf 1//5 2//5 6//5 5//5\nf 4//6 8//6 7//6 3//6\n";
+
+int cube_mesh_create(struct mesh_data *mesh)
+{
+    return obj_parse(cube_obj, mesh);
+}
+
+void cube_field_position(unsigned int index, float *position)
+{
+    float x = ((float)(index % CUBE_FIELD_SIZE) - (CUBE_FIELD_SIZE - 1) * 0.5f) * CUBE_FIELD_SPACING;
+    float z = ((float)(index / CUBE_FIELD_SIZE) - (CUBE_FIELD_SIZE - 1) * 0.5f) * CUBE_FIELD_SPACING;
+
+    position[0] = x;
+    position[1] = -2.0f + 0.5f * sinf(x * 0.3f + z * 0.2f);
+    position[2] = z;
+}
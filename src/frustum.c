@@ -0,0 +1,89 @@
+#include <frustum.h>
+
+#include <math.h>
+
+void frustum_from_matrix(struct frustum *frustum, const float *m, int zero_to_one)
+{
+    // rows of the column-major matrix
+    float rows[4][4];
+    float candidates[6][4];
+    unsigned int i, j;
+
+    for (i = 0; i < 4; i++)
+    {
+        for (j = 0; j < 4; j++)
+            rows[i][j] = m[j * 4 + i];
+    }
+    // -w <= x, y <= w; depth is 0 <= z <= w or -w <= z <= w
+    for (j = 0; j < 4; j++)
+    {
+        candidates[0][j] = rows[3][j] + rows[0][j];
+        candidates[1][j] = rows[3][j] - rows[0][j];
+        candidates[2][j] = rows[3][j] + rows[1][j];
+        candidates[3][j] = rows[3][j] - rows[1][j];
+        candidates[4][j] = zero_to_one ? rows[2][j] : rows[3][j] + rows[2][j];
+        candidates[5][j] = rows[3][j] - rows[2][j];
+    }
+
+    frustum->plane_count = 0;
+    for (i = 0; i < 6; i++)
+    {
+        float *plane = candidates[i];
+        float length = sqrtf(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        if (length < 1e-6f)
+            continue;   // degenerate: the plane sits at infinity
+        for (j = 0; j < 4; j++)
+            frustum->planes[frustum->plane_count][j] = plane[j] / length;
+        frustum->plane_count++;
+    }
+}
+
+int frustum_test_aabb(const struct frustum *frustum, const struct aabb *box)
+{
+    unsigned int i;
+
+    for (i = 0; i < frustum->plane_count; i++)
+    {
+        const float *plane = frustum->planes[i];
+        // the corner furthest along the plane normal
+        float x = plane[0] >= 0.0f ? box->max[0] : box->min[0];
+        float y = plane[1] >= 0.0f ? box->max[1] : box->min[1];
+        float z = plane[2] >= 0.0f ? box->max[2] : box->min[2];
+        if (plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.0f)
+            return 0;
+    }
+    return 1;
+}
+
+unsigned int frustum_cull(const struct frustum *frustum, const struct aabb *boxes, unsigned int count,
+    unsigned int *visible)
+{
+    unsigned int i, visible_count = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        if (frustum_test_aabb(frustum, &boxes[i]))
+            visible[visible_count++] = i;
+    }
+    return visible_count;
+}
+
+void aabb_transform(struct aabb *out, const struct aabb *box, const float *model)
+{
+    struct aabb result;
+    unsigned int row, column;
+
+    // Arvo: each output axis is the translation plus the extremes of every column's contribution
+    for (row = 0; row < 3; row++)
+    {
+        result.min[row] = result.max[row] = model[12 + row];
+        for (column = 0; column < 3; column++)
+        {
+            float a = model[column * 4 + row] * box->min[column];
+            float b = model[column * 4 + row] * box->max[column];
+            result.min[row] += a < b ? a : b;
+            result.max[row] += a < b ? b : a;
+        }
+    }
+    *out = result;
+}
@@ -0,0 +1,384 @@
+#include <image.h>
+#include <inflate.h>
+#include <vfs.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int decode_tga(const unsigned char *data, size_t size, struct image *image)
+{
+    if (size < 18)
+        return 0;
+
+    unsigned int id_length = data[0];
+    unsigned int color_map = data[1];
+    unsigned int type = data[2];
+    int width = data[12] | (data[13] << 8);
+    int height = data[14] | (data[15] << 8);
+    unsigned int bpp = data[16] / 8;
+    int top_down = (data[17] & 0x20) != 0;
+
+    if (color_map != 0 || (type != 2 && type != 10) || (bpp != 3 && bpp != 4) || width <= 0 || height <= 0)
+        return 0;
+
+    const unsigned char *p = data + 18 + id_length;
+    const unsigned char *end = data + size;
+    size_t count = (size_t)width * height, i = 0;
+    unsigned char *pixels = (unsigned char *)malloc(count * 4);
+    if (pixels == NULL)
+        return 0;
+
+    while (i < count)
+    {
+        size_t run = 1;
+        int repeat = 0;
+        if (type == 10)
+        {
+            if (p >= end)
+                break;
+            run = (*p & 0x7f) + 1;
+            repeat = (*p & 0x80) != 0;
+            p++;
+        }
+        size_t j;
+        for (j = 0; j < run && i < count; j++, i++)
+        {
+            if (p + bpp > end)
+                break;
+            // stored as BGR(A)
+            pixels[i * 4 + 0] = p[2];
+            pixels[i * 4 + 1] = p[1];
+            pixels[i * 4 + 2] = p[0];
+            pixels[i * 4 + 3] = bpp == 4 ? p[3] : 255;
+            if (!repeat || j + 1 == run)
+                p += bpp;
+        }
+        if (j < run && i < count)
+            break;
+    }
+    if (i < count)
+    {
+        free(pixels);
+        return 0;
+    }
+
+    if (top_down)
+    {
+        int y;
+        size_t stride = (size_t)width * 4;
+        unsigned char *row = (unsigned char *)malloc(stride);
+        for (y = 0; row != NULL && y < height / 2; y++)
+        {
+            memcpy(row, pixels + y * stride, stride);
+            memcpy(pixels + y * stride, pixels + (height - 1 - y) * stride, stride);
+            memcpy(pixels + (height - 1 - y) * stride, row, stride);
+        }
+        free(row);
+    }
+
+    image->width = width;
+    image->height = height;
+    image->pixels = pixels;
+    return 1;
+}
+
+static const unsigned char *ppm_field(const unsigned char *p, const unsigned char *end, int *value)
+{
+    // skip whitespace and comments
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' || *p == '#'))
+    {
+        if (*p == '#')
+        {
+            while (p < end && *p != '\n')
+                p++;
+        }
+        else
+            p++;
+    }
+    *value = 0;
+    if (p >= end || *p < '0' || *p > '9')
+        return NULL;
+    while (p < end && *p >= '0' && *p <= '9')
+        *value = *value * 10 + (*p++ - '0');
+    return p;
+}
+
+static int decode_ppm(const unsigned char *data, size_t size, struct image *image)
+{
+    const unsigned char *end = data + size;
+    const unsigned char *p = data + 2;
+    int width, height, maxval, y, x;
+
+    if ((p = ppm_field(p, end, &width)) == NULL || (p = ppm_field(p, end, &height)) == NULL ||
+        (p = ppm_field(p, end, &maxval)) == NULL)
+        return 0;
+    p++;    // single whitespace before the raster
+    if (width <= 0 || height <= 0 || maxval != 255 || (size_t)(end - p) < (size_t)width * height * 3)
+        return 0;
+
+    unsigned char *pixels = (unsigned char *)malloc((size_t)width * height * 4);
+    if (pixels == NULL)
+        return 0;
+    // PPM is top to bottom
+    for (y = 0; y < height; y++)
+    {
+        unsigned char *row = pixels + (size_t)(height - 1 - y) * width * 4;
+        for (x = 0; x < width; x++, p += 3)
+        {
+            row[x * 4 + 0] = p[0];
+            row[x * 4 + 1] = p[1];
+            row[x * 4 + 2] = p[2];
+            row[x * 4 + 3] = 255;
+        }
+    }
+
+    image->width = width;
+    image->height = height;
+    image->pixels = pixels;
+    return 1;
+}
+
+static uint32_t read_be32(const unsigned char *p)
+{
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static int paeth(int a, int b, int c)
+{
+    int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+
+    return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+// reverses the per-row filters in place. bpp is the byte distance to the pixel on the left.
+static int unfilter(unsigned char *data, size_t stride, int height, size_t bpp)
+{
+    unsigned char *previous = NULL;
+    int y;
+
+    for (y = 0; y < height; y++)
+    {
+        unsigned char *row = data + (size_t)y * (stride + 1) + 1;
+        unsigned int filter = row[-1];
+        size_t x;
+
+        for (x = 0; x < stride; x++)
+        {
+            int left = x >= bpp ? row[x - bpp] : 0;
+            int up = previous != NULL ? previous[x] : 0;
+            int corner = previous != NULL && x >= bpp ? previous[x - bpp] : 0;
+
+            switch (filter)
+            {
+            case 0: break;
+            case 1: row[x] = (unsigned char)(row[x] + left); break;
+            case 2: row[x] = (unsigned char)(row[x] + up); break;
+            case 3: row[x] = (unsigned char)(row[x] + ((left + up) >> 1)); break;
+            case 4: row[x] = (unsigned char)(row[x] + paeth(left, up, corner)); break;
+            default: return 0;
+            }
+        }
+        previous = row;
+    }
+    return 1;
+}
+
+// one sample of a row, 1 to 16 bits deep, scaled to 8 bits unless it is a palette index
+static unsigned int png_sample(const unsigned char *row, size_t index, unsigned int depth, int scale)
+{
+    unsigned int value, max;
+
+    if (depth == 8)
+        return row[index];
+    if (depth == 16)
+        return row[index * 2];
+    value = (row[index * depth / 8] >> (8 - depth - index * depth % 8)) & ((1u << depth) - 1);
+    max = (1u << depth) - 1;
+    return scale ? value * 255 / max : value;
+}
+
+struct png_info
+{
+    uint32_t width;
+    uint32_t height;
+    unsigned int depth;
+    unsigned int color;
+    unsigned char palette[256][4];
+    int trns_key;               // transparent gray level, -1 if none
+    unsigned char *idat;        // all IDAT chunks joined
+    size_t idat_size;
+};
+
+// walks the chunks up to IEND. returns 0 if the file is not something decode_png handles.
+static int png_read_chunks(const unsigned char *data, size_t size, struct png_info *info)
+{
+    const unsigned char *p = data + 8, *end = data + size;
+    unsigned int i;
+
+    memset(info, 0, sizeof(*info));
+    memset(info->palette, 255, sizeof(info->palette));
+    info->trns_key = -1;
+    while ((size_t)(end - p) >= 12)
+    {
+        uint32_t length = read_be32(p);
+        const unsigned char *chunk = p + 8;
+        if (length > (size_t)(end - chunk) - 4)
+            break;
+        if (memcmp(p + 4, "IHDR", 4) == 0 && length >= 13)
+        {
+            info->width = read_be32(chunk);
+            info->height = read_be32(chunk + 4);
+            info->depth = chunk[8];
+            info->color = chunk[9];
+            // compression, filter method and interlacing
+            if (chunk[10] != 0 || chunk[11] != 0 || chunk[12] != 0)
+                break;
+        }
+        else if (memcmp(p + 4, "PLTE", 4) == 0)
+        {
+            for (i = 0; i < length / 3 && i < 256; i++)
+                memcpy(info->palette[i], chunk + i * 3, 3);
+        }
+        else if (memcmp(p + 4, "tRNS", 4) == 0)
+        {
+            if (info->color == 3)
+            {
+                for (i = 0; i < length && i < 256; i++)
+                    info->palette[i][3] = chunk[i];
+            }
+            else if (info->color == 0 && length >= 2)
+                info->trns_key = chunk[0] << 8 | chunk[1];
+        }
+        else if (memcmp(p + 4, "IDAT", 4) == 0)
+        {
+            unsigned char *idat = (unsigned char *)realloc(info->idat, info->idat_size + length);
+            if (idat == NULL)
+                break;
+            info->idat = idat;
+            memcpy(info->idat + info->idat_size, chunk, length);
+            info->idat_size += length;
+        }
+        else if (memcmp(p + 4, "IEND", 4) == 0)
+            return info->idat != NULL;
+        p = chunk + length + 4;
+    }
+    free(info->idat);
+    info->idat = NULL;
+    return 0;
+}
+
+static const unsigned int png_channels[7] = { 1, 0, 3, 1, 2, 0, 4 };
+
+static int png_supported(const struct png_info *info)
+{
+    unsigned int depth = info->depth;
+
+    if (info->width == 0 || info->height == 0 || info->width > (1u << 24) || info->height > (1u << 24) ||
+        info->color > 6 || png_channels[info->color] == 0)
+        return 0;
+    if (info->color == 0 || info->color == 3)
+        return depth == 1 || depth == 2 || depth == 4 || depth == 8 || (depth == 16 && info->color == 0);
+    return depth == 8 || depth == 16;
+}
+
+// expands unfiltered rows to RGBA, flipping them bottom to top
+static void png_convert(const struct png_info *info, const unsigned char *raw, size_t stride, unsigned char *pixels)
+{
+    unsigned int channels = png_channels[info->color], depth = info->depth, x, y, i;
+
+    for (y = 0; y < info->height; y++)
+    {
+        const unsigned char *row = raw + (size_t)y * (stride + 1) + 1;
+        unsigned char *out = pixels + (size_t)(info->height - 1 - y) * info->width * 4;
+        for (x = 0; x < info->width; x++, out += 4)
+        {
+            if (info->color == 3)
+                memcpy(out, info->palette[png_sample(row, x, depth, 0)], 4);
+            else if (info->color == 0 || info->color == 4)
+            {
+                out[0] = out[1] = out[2] = (unsigned char)png_sample(row, (size_t)x * channels, depth, 1);
+                if (info->color == 4)
+                    out[3] = (unsigned char)png_sample(row, (size_t)x * channels + 1, depth, 1);
+                else
+                {
+                    unsigned int level = depth == 16 ? (unsigned int)(row[x * 2] << 8 | row[x * 2 + 1])
+                        : png_sample(row, x, depth, 0);
+                    out[3] = (int)level == info->trns_key ? 0 : 255;
+                }
+            }
+            else
+            {
+                for (i = 0; i < channels; i++)
+                    out[i] = (unsigned char)png_sample(row, (size_t)x * channels + i, depth, 1);
+                if (channels == 3)
+                    out[3] = 255;
+            }
+        }
+    }
+}
+
+// non-interlaced PNG of any color type and bit depth. 16-bit samples keep their high byte.
+static int decode_png(const unsigned char *data, size_t size, struct image *image)
+{
+    struct png_info info;
+    unsigned char *raw = NULL, *pixels = NULL;
+    size_t stride, raw_size;
+    int ok = 0;
+
+    if (!png_read_chunks(data, size, &info))
+        return 0;
+    if (png_supported(&info))
+    {
+        unsigned int bits = png_channels[info.color] * info.depth;
+        stride = ((size_t)info.width * bits + 7) / 8;
+        raw_size = (stride + 1) * info.height;
+        raw = (unsigned char *)malloc(raw_size);
+        pixels = (unsigned char *)malloc((size_t)info.width * info.height * 4);
+        ok = raw != NULL && pixels != NULL && inflate_zlib(info.idat, info.idat_size, raw, raw_size) == raw_size &&
+            unfilter(raw, stride, (int)info.height, (bits + 7) / 8);
+    }
+    if (ok)
+    {
+        png_convert(&info, raw, stride, pixels);
+        image->width = (int)info.width;
+        image->height = (int)info.height;
+        image->pixels = pixels;
+    }
+    else
+        free(pixels);
+    free(raw);
+    free(info.idat);
+    return ok;
+}
+
+int image_decode(const unsigned char *data, size_t size, struct image *image)
+{
+    memset(image, 0, sizeof(*image));
+    if (size >= 8 && memcmp(data, "\x89PNG\r\n\x1a\n", 8) == 0)
+        return decode_png(data, size, image);
+    if (size >= 2 && data[0] == 'P' && data[1] == '6')
+        return decode_ppm(data, size, image);
+    return decode_tga(data, size, image);
+}
+
+int image_load(const char *path, struct image *image)
+{
+    size_t size = 0;
+    unsigned char *data = vfs_read(path, &size);
+    int ok;
+
+    memset(image, 0, sizeof(*image));
+    if (data == NULL)
+        return 0;
+    ok = image_decode(data, size, image);
+    free(data);
+    return ok;
+}
+
+void image_free(struct image *image)
+{
+    free(image->pixels);
+    memset(image, 0, sizeof(*image));
+}
@@ -0,0 +1,340 @@
+#include <inflate.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#define MAX_BITS 15
+// codes up to this long decode with one table lookup, longer ones bit by bit
+#define FAST_BITS 9
+#define LITERAL_CODES 288
+#define DISTANCE_CODES 30
+
+struct huffman
+{
+    uint16_t count[MAX_BITS + 1];   // codes of each length
+    uint16_t symbol[LITERAL_CODES]; // ordered by code
+    uint16_t fast[1 << FAST_BITS];  // symbol << 4 | length, 0 for longer codes
+};
+
+struct bits
+{
+    const unsigned char *p;
+    const unsigned char *end;
+    uint64_t buffer;
+    unsigned int count;
+    unsigned int overrun;       // zero bytes fed past the end
+};
+
+static const uint16_t length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t length_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t distance_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097,
+    6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t distance_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static void refill(struct bits *bits)
+{
+    while (bits->count <= 56)
+    {
+        uint64_t byte = 0;
+        if (bits->p < bits->end)
+            byte = *bits->p++;
+        else
+            bits->overrun++;
+        bits->buffer |= byte << bits->count;
+        bits->count += 8;
+    }
+}
+
+static unsigned int get_bits(struct bits *bits, unsigned int count)
+{
+    unsigned int value;
+
+    if (count == 0)
+        return 0;
+    if (bits->count < count)
+        refill(bits);
+    value = (unsigned int)(bits->buffer & ((1u << count) - 1));
+    bits->buffer >>= count;
+    bits->count -= count;
+    return value;
+}
+
+// canonical code from a list of lengths. returns 0 for over-subscribed sets; incomplete ones are
+// allowed (a single distance code is legal).
+static int build(struct huffman *h, const uint8_t *lengths, unsigned int count)
+{
+    uint16_t offsets[MAX_BITS + 2];
+    unsigned int symbol, length, code = 0;
+    int left = 1;
+
+    memset(h->count, 0, sizeof(h->count));
+    memset(h->fast, 0, sizeof(h->fast));
+    for (symbol = 0; symbol < count; symbol++)
+        h->count[lengths[symbol]]++;
+    h->count[0] = 0;
+    for (length = 1; length <= MAX_BITS; length++)
+    {
+        left = left * 2 - h->count[length];
+        if (left < 0)
+            return 0;
+    }
+    offsets[1] = 0;
+    for (length = 1; length <= MAX_BITS; length++)
+        offsets[length + 1] = (uint16_t)(offsets[length] + h->count[length]);
+    for (symbol = 0; symbol < count; symbol++)
+    {
+        if (lengths[symbol] != 0)
+            h->symbol[offsets[lengths[symbol]]++] = (uint16_t)symbol;
+    }
+
+    // the fast table is indexed by the next FAST_BITS of the stream, which hold a code bit-reversed
+    for (length = 1, symbol = 0; length <= FAST_BITS; length++)
+    {
+        unsigned int i;
+        for (i = 0; i < h->count[length]; i++, code++, symbol++)
+        {
+            unsigned int reversed = 0, bit, fill;
+            for (bit = 0; bit < length; bit++)
+                reversed |= ((code >> bit) & 1) << (length - 1 - bit);
+            for (fill = reversed; fill < (1u << FAST_BITS); fill += 1u << length)
+                h->fast[fill] = (uint16_t)(h->symbol[symbol] << 4 | length);
+        }
+        code <<= 1;
+    }
+    return 1;
+}
+
+static int decode(struct bits *bits, const struct huffman *h)
+{
+    int code = 0, first = 0, index = 0;
+    unsigned int length;
+    uint16_t entry;
+
+    if (bits->count < MAX_BITS)
+        refill(bits);
+    entry = h->fast[bits->buffer & ((1u << FAST_BITS) - 1)];
+    if (entry != 0)
+    {
+        bits->buffer >>= entry & 15;
+        bits->count -= entry & 15;
+        return entry >> 4;
+    }
+    for (length = 1; length <= MAX_BITS; length++)
+    {
+        int count = h->count[length];
+        code |= (int)(bits->buffer & 1);
+        bits->buffer >>= 1;
+        bits->count--;
+        if (code - count < first)
+            return h->symbol[index + (code - first)];
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+static int inflate_codes(struct bits *bits, const struct huffman *literals, const struct huffman *distances,
+    unsigned char *dst, size_t capacity, size_t *position)
+{
+    size_t out = *position;
+
+    for (;;)
+    {
+        int symbol = decode(bits, literals);
+        if (symbol < 0 || bits->overrun > 8)
+            return 0;
+        if (symbol < 256)
+        {
+            if (out >= capacity)
+                return 0;
+            dst[out++] = (unsigned char)symbol;
+        }
+        else if (symbol == 256)
+            break;
+        else
+        {
+            size_t length, distance;
+            symbol -= 257;
+            if (symbol >= 29)
+                return 0;
+            length = length_base[symbol] + get_bits(bits, length_extra[symbol]);
+            symbol = decode(bits, distances);
+            if (symbol < 0 || symbol >= DISTANCE_CODES)
+                return 0;
+            distance = distance_base[symbol] + get_bits(bits, distance_extra[symbol]);
+            if (distance > out || length > capacity - out)
+                return 0;
+            // byte by byte: a run may overlap itself
+            for (; length > 0; length--, out++)
+                dst[out] = dst[out - distance];
+        }
+    }
+    *position = out;
+    return 1;
+}
+
+static int inflate_fixed(struct bits *bits, unsigned char *dst, size_t capacity, size_t *position)
+{
+    struct huffman literals, distances;
+    uint8_t lengths[LITERAL_CODES];
+    unsigned int i;
+
+    // cheap next to decoding a block, and keeps the decoder free of shared state
+    for (i = 0; i < 144; i++)
+        lengths[i] = 8;
+    for (; i < 256; i++)
+        lengths[i] = 9;
+    for (; i < 280; i++)
+        lengths[i] = 7;
+    for (; i < LITERAL_CODES; i++)
+        lengths[i] = 8;
+    build(&literals, lengths, LITERAL_CODES);
+    for (i = 0; i < DISTANCE_CODES; i++)
+        lengths[i] = 5;
+    build(&distances, lengths, DISTANCE_CODES);
+    return inflate_codes(bits, &literals, &distances, dst, capacity, position);
+}
+
+static int inflate_dynamic(struct bits *bits, unsigned char *dst, size_t capacity, size_t *position)
+{
+    static const uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+    struct huffman literals, distances;
+    uint8_t lengths[LITERAL_CODES + DISTANCE_CODES];
+    unsigned int literal_count, distance_count, code_count, i;
+
+    literal_count = get_bits(bits, 5) + 257;
+    distance_count = get_bits(bits, 5) + 1;
+    code_count = get_bits(bits, 4) + 4;
+    if (literal_count > 286 || distance_count > DISTANCE_CODES)
+        return 0;
+
+    memset(lengths, 0, sizeof(lengths));
+    for (i = 0; i < code_count; i++)
+        lengths[order[i]] = (uint8_t)get_bits(bits, 3);
+    if (!build(&literals, lengths, 19))
+        return 0;
+
+    for (i = 0; i < literal_count + distance_count;)
+    {
+        int symbol = decode(bits, &literals);
+        unsigned int repeat;
+        uint8_t value = 0;
+
+        if (symbol < 0 || bits->overrun > 8)
+            return 0;
+        if (symbol < 16)
+        {
+            lengths[i++] = (uint8_t)symbol;
+            continue;
+        }
+        if (symbol == 16)
+        {
+            if (i == 0)
+                return 0;
+            value = lengths[i - 1];
+            repeat = 3 + get_bits(bits, 2);
+        }
+        else if (symbol == 17)
+            repeat = 3 + get_bits(bits, 3);
+        else
+            repeat = 11 + get_bits(bits, 7);
+        if (i + repeat > literal_count + distance_count)
+            return 0;
+        while (repeat-- > 0)
+            lengths[i++] = value;
+    }
+    // a block without an end-of-block code could never finish
+    if (lengths[256] == 0)
+        return 0;
+    if (!build(&literals, lengths, literal_count) || !build(&distances, lengths + literal_count, distance_count))
+        return 0;
+    return inflate_codes(bits, &literals, &distances, dst, capacity, position);
+}
+
+// drops the bits up to the next byte boundary and hands the whole bytes still buffered back to
+// the input. returns 0 if bytes past the end were consumed.
+static int align_to_byte(struct bits *bits)
+{
+    unsigned int buffered;
+
+    get_bits(bits, bits->count & 7);
+    buffered = bits->count / 8;
+    if (buffered < bits->overrun)
+        return 0;
+    bits->p -= buffered - bits->overrun;
+    bits->buffer = 0;
+    bits->count = 0;
+    bits->overrun = 0;
+    return 1;
+}
+
+static int inflate_stored(struct bits *bits, unsigned char *dst, size_t capacity, size_t *position)
+{
+    unsigned int length;
+
+    if (!align_to_byte(bits) || bits->end - bits->p < 4)
+        return 0;
+    length = bits->p[0] | bits->p[1] << 8;
+    if ((length ^ 0xffff) != (unsigned int)(bits->p[2] | bits->p[3] << 8) || length > capacity - *position)
+        return 0;
+    bits->p += 4;
+    if ((size_t)(bits->end - bits->p) < length)
+        return 0;
+    memcpy(dst + *position, bits->p, length);
+    bits->p += length;
+    *position += length;
+    return 1;
+}
+
+size_t inflate_zlib(const unsigned char *src, size_t size, unsigned char *dst, size_t capacity)
+{
+    struct bits bits;
+    size_t position = 0, i;
+    unsigned int last, type;
+    uint32_t a = 1, b = 0, adler;
+
+    // deflate, window up to 32K, no preset dictionary
+    if (size < 6 || (src[0] & 15) != 8 || (src[0] >> 4) > 7 || ((src[0] << 8) | src[1]) % 31 != 0 || (src[1] & 32))
+        return 0;
+    bits.p = src + 2;
+    bits.end = src + size;
+    bits.buffer = 0;
+    bits.count = 0;
+    bits.overrun = 0;
+    do
+    {
+        int ok;
+        last = get_bits(&bits, 1);
+        type = get_bits(&bits, 2);
+        if (type == 0)
+            ok = inflate_stored(&bits, dst, capacity, &position);
+        else if (type == 1)
+            ok = inflate_fixed(&bits, dst, capacity, &position);
+        else if (type == 2)
+            ok = inflate_dynamic(&bits, dst, capacity, &position);
+        else
+            ok = 0;
+        if (!ok || bits.overrun > 8)
+            return 0;
+    } while (!last);
+
+    // the trailer starts at the byte after the last block
+    if (!align_to_byte(&bits) || bits.end - bits.p < 4)
+        return 0;
+    adler = (uint32_t)bits.p[0] << 24 | (uint32_t)bits.p[1] << 16 | (uint32_t)bits.p[2] << 8 | bits.p[3];
+    for (i = 0; i < position; i++)
+    {
+        a = (a + dst[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return adler == (b << 16 | a) ? position : 0;
+}
@@ -0,0 +1,469 @@
+#include <glad/glad.h>
+#include <light_clusters.h>
+#include <uniforms.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LIGHTS_X86 1
+#include <immintrin.h>
+#endif
+
+// stands in for the unbounded far end of the last slice; big, but squares stay finite-ish
+#define FAR_AWAY 1e30f
+
+void light_point(struct light *light, const float *position, float radius, const float *color)
+{
+    memset(light, 0, sizeof(*light));
+    memcpy(light->position, position, sizeof(light->position));
+    light->radius = radius;
+    memcpy(light->color, color, sizeof(light->color));
+    light->spot_inner = -2.0f;
+    light->spot_outer = -2.0f;
+}
+
+void light_spot(struct light *light, const float *position, const float *direction, float radius,
+    const float *color, float inner_angle, float outer_angle)
+{
+    light_point(light, position, radius, color);
+    memcpy(light->direction, direction, sizeof(light->direction));
+    light->spot_inner = cosf(inner_angle);
+    light->spot_outer = cosf(outer_angle);
+}
+
+void light_clusters_init(struct light_clusters *clusters, struct thread_pool *pool)
+{
+    memset(clusters, 0, sizeof(*clusters));
+    clusters->pool = pool;
+    clusters->simd = 1;
+}
+
+static void free_candidates(struct light_candidates *candidates)
+{
+    free(candidates->lights);
+    free(candidates->x);
+    free(candidates->y);
+    free(candidates->depth);
+    free(candidates->radius_sq);
+}
+
+void light_clusters_shutdown(struct light_clusters *clusters)
+{
+    unsigned int i;
+
+    for (i = 0; i < LIGHT_CLUSTERS_Z; i++)
+    {
+        free_candidates(&clusters->slices[i].candidates);
+        free_candidates(&clusters->slices[i].row);
+        free(clusters->slices[i].indices);
+    }
+    free(clusters->view_x);
+    free(clusters->view_y);
+    free(clusters->view_depth);
+    free(clusters->view_radius);
+    free(clusters->indices);
+    if (clusters->light_buffer)
+    {
+        GLuint buffers[3] = { clusters->light_buffer, clusters->grid_buffer, clusters->index_buffer };
+        GLuint textures[3] = { clusters->light_texture, clusters->grid_texture, clusters->index_texture };
+        glDeleteBuffers(3, buffers);
+        glDeleteTextures(3, textures);
+    }
+    memset(clusters, 0, sizeof(*clusters));
+}
+
+static int grow_floats(float **array, size_t count)
+{
+    float *grown = (float *)realloc(*array, sizeof(float) * count);
+    if (grown == NULL)
+        return 0;
+    *array = grown;
+    return 1;
+}
+
+static int grow_indices(uint32_t **array, unsigned int *capacity, unsigned int needed)
+{
+    unsigned int grown_capacity = *capacity ? *capacity : 256;
+    uint32_t *grown;
+
+    if (needed <= *capacity && *array != NULL)
+        return 1;
+    while (grown_capacity < needed)
+        grown_capacity *= 2;
+    grown = (uint32_t *)realloc(*array, sizeof(*grown) * grown_capacity);
+    if (grown == NULL)
+        return 0;
+    *array = grown;
+    *capacity = grown_capacity;
+    return 1;
+}
+
+// room for count candidates plus padding to the next multiple of 4
+static int reserve_candidates(struct light_candidates *candidates, unsigned int count)
+{
+    unsigned int padded = (count + 3) & ~3u, capacity = candidates->capacity;
+
+    if (padded <= candidates->capacity && candidates->lights != NULL)
+        return 1;
+    if (!grow_indices(&candidates->lights, &capacity, padded))
+        return 0;
+    if (!grow_floats(&candidates->x, capacity) || !grow_floats(&candidates->y, capacity) ||
+        !grow_floats(&candidates->depth, capacity) || !grow_floats(&candidates->radius_sq, capacity))
+        return 0;
+    candidates->capacity = capacity;
+    return 1;
+}
+
+static void add_candidate(struct light_candidates *candidates, uint32_t light, float x, float y, float depth,
+    float radius_sq)
+{
+    unsigned int n = candidates->count++;
+
+    candidates->lights[n] = light;
+    candidates->x[n] = x;
+    candidates->y[n] = y;
+    candidates->depth[n] = depth;
+    candidates->radius_sq[n] = radius_sq;
+}
+
+// fills up to the multiple of 4 with spheres that touch nothing. the negative radius is what
+// guarantees it: the last slice's boxes reach FAR_AWAY themselves once fov_y is 90 degrees or more,
+// and a distance of 0 would pass against a radius of 0.
+static void pad_candidates(struct light_candidates *candidates)
+{
+    unsigned int i;
+
+    for (i = candidates->count; i < ((candidates->count + 3) & ~3u); i++)
+    {
+        candidates->x[i] = candidates->y[i] = candidates->depth[i] = FAR_AWAY;
+        candidates->radius_sq[i] = -1.0f;
+    }
+}
+
+// view-space box around the part of the frustum over tiles [x_begin, x_end) of row y between the
+// slice's depths
+static void cluster_box(const struct light_clusters *clusters, const struct light_slice *slice, unsigned int x_begin,
+    unsigned int x_end, unsigned int y, float *box_min, float *box_max)
+{
+    float ndc_x[2] = { -1.0f + 2.0f * x_begin / LIGHT_CLUSTERS_X, -1.0f + 2.0f * x_end / LIGHT_CLUSTERS_X };
+    float ndc_y[2] = { -1.0f + 2.0f * y / LIGHT_CLUSTERS_Y, -1.0f + 2.0f * (y + 1) / LIGHT_CLUSTERS_Y };
+    unsigned int i, j;
+
+    box_min[0] = box_min[1] = FAR_AWAY;
+    box_max[0] = box_max[1] = -FAR_AWAY;
+    for (i = 0; i < 2; i++)
+    {
+        for (j = 0; j < 2; j++)
+        {
+            float vx = ndc_x[j] * slice->depth[i] * clusters->tile_scale[0];
+            float vy = ndc_y[j] * slice->depth[i] * clusters->tile_scale[1];
+            box_min[0] = vx < box_min[0] ? vx : box_min[0];
+            box_max[0] = vx > box_max[0] ? vx : box_max[0];
+            box_min[1] = vy < box_min[1] ? vy : box_min[1];
+            box_max[1] = vy > box_max[1] ? vy : box_max[1];
+        }
+    }
+    box_min[2] = slice->depth[0];
+    box_max[2] = slice->depth[1];
+}
+
+static float outside(float v, float lo, float hi)
+{
+    return v < lo ? lo - v : v > hi ? v - hi : 0.0f;
+}
+
+static void select_candidates_scalar(const struct light_clusters *clusters, struct light_slice *slice)
+{
+    unsigned int i;
+
+    for (i = 0; i < clusters->light_count; i++)
+    {
+        float depth = clusters->view_depth[i], radius = clusters->view_radius[i];
+        if (depth + radius > slice->depth[0] && depth - radius < slice->depth[1])
+            add_candidate(&slice->candidates, i, clusters->view_x[i], clusters->view_y[i], depth, radius * radius);
+    }
+}
+
+// writes the positions of the candidates whose spheres touch the box to slots
+static unsigned int test_box_scalar(const struct light_candidates *candidates, const float *box_min,
+    const float *box_max, uint32_t *slots)
+{
+    unsigned int i, count = 0;
+
+    for (i = 0; i < candidates->count; i++)
+    {
+        float dx = outside(candidates->x[i], box_min[0], box_max[0]);
+        float dy = outside(candidates->y[i], box_min[1], box_max[1]);
+        float dz = outside(candidates->depth[i], box_min[2], box_max[2]);
+        if (dx * dx + dy * dy + dz * dz <= candidates->radius_sq[i])
+            slots[count++] = i;
+    }
+    return count;
+}
+
+#ifdef LIGHTS_X86
+
+__attribute__((target("sse2")))
+static void select_candidates_sse(const struct light_clusters *clusters, struct light_slice *slice)
+{
+    const __m128 near = _mm_set1_ps(slice->depth[0]), far = _mm_set1_ps(slice->depth[1]);
+    unsigned int i;
+
+    // the view arrays are padded with lights that reach nowhere
+    for (i = 0; i < clusters->light_count; i += 4)
+    {
+        __m128 depth = _mm_loadu_ps(clusters->view_depth + i), radius = _mm_loadu_ps(clusters->view_radius + i);
+        __m128 touches = _mm_and_ps(_mm_cmpgt_ps(_mm_add_ps(depth, radius), near),
+            _mm_cmplt_ps(_mm_sub_ps(depth, radius), far));
+        int mask = _mm_movemask_ps(touches);
+        while (mask)
+        {
+            unsigned int light = i + (unsigned int)__builtin_ctz((unsigned int)mask);
+            add_candidate(&slice->candidates, light, clusters->view_x[light], clusters->view_y[light],
+                clusters->view_depth[light], clusters->view_radius[light] * clusters->view_radius[light]);
+            mask &= mask - 1;
+        }
+    }
+}
+
+__attribute__((target("sse2")))
+static __m128 outside_sse(__m128 v, __m128 lo, __m128 hi)
+{
+    const __m128 zero = _mm_setzero_ps();
+    return _mm_add_ps(_mm_max_ps(_mm_sub_ps(lo, v), zero), _mm_max_ps(_mm_sub_ps(v, hi), zero));
+}
+
+// four candidates per iteration; the padding past count never passes (see pad_candidates)
+__attribute__((target("sse2")))
+static unsigned int test_box_sse(const struct light_candidates *candidates, const float *box_min,
+    const float *box_max, uint32_t *slots)
+{
+    const __m128 min_x = _mm_set1_ps(box_min[0]), min_y = _mm_set1_ps(box_min[1]), min_z = _mm_set1_ps(box_min[2]);
+    const __m128 max_x = _mm_set1_ps(box_max[0]), max_y = _mm_set1_ps(box_max[1]), max_z = _mm_set1_ps(box_max[2]);
+    unsigned int i, count = 0;
+
+    for (i = 0; i < candidates->count; i += 4)
+    {
+        __m128 dx = outside_sse(_mm_loadu_ps(candidates->x + i), min_x, max_x);
+        __m128 dy = outside_sse(_mm_loadu_ps(candidates->y + i), min_y, max_y);
+        __m128 dz = outside_sse(_mm_loadu_ps(candidates->depth + i), min_z, max_z);
+        __m128 distance_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        int mask = _mm_movemask_ps(_mm_cmple_ps(distance_sq, _mm_loadu_ps(candidates->radius_sq + i)));
+        while (mask)
+        {
+            slots[count++] = i + (unsigned int)__builtin_ctz((unsigned int)mask);
+            mask &= mask - 1;
+        }
+    }
+    return count;
+}
+
+#endif
+
+static unsigned int test_box(const struct light_candidates *candidates, const float *box_min, const float *box_max,
+    uint32_t *slots, int simd)
+{
+#ifdef LIGHTS_X86
+    if (simd)
+        return test_box_sse(candidates, box_min, box_max, slots);
+#endif
+    return test_box_scalar(candidates, box_min, box_max, slots);
+}
+
+// narrows the slice's candidates down to those reaching row y, using the slice's index array as
+// scratch for the slots
+static void select_row(struct light_clusters *clusters, struct light_slice *slice, unsigned int y, int simd)
+{
+    const struct light_candidates *from = &slice->candidates;
+    uint32_t *slots = slice->indices + slice->index_count;
+    float box_min[3], box_max[3];
+    unsigned int count, i;
+
+    cluster_box(clusters, slice, 0, LIGHT_CLUSTERS_X, y, box_min, box_max);
+    count = test_box(from, box_min, box_max, slots, simd);
+    slice->row.count = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t s = slots[i];
+        add_candidate(&slice->row, from->lights[s], from->x[s], from->y[s], from->depth[s], from->radius_sq[s]);
+    }
+    pad_candidates(&slice->row);
+}
+
+// parallel_for body: one depth slice
+static void bin_slice(void *arg, unsigned int z)
+{
+    struct light_clusters *clusters = (struct light_clusters *)arg;
+    struct light_slice *slice = &clusters->slices[z];
+    unsigned int x, y, i;
+    int simd = 0;
+
+#ifdef LIGHTS_X86
+    simd = clusters->simd;
+#endif
+    slice->candidates.count = 0;
+    slice->index_count = 0;
+    slice->failed = 0;
+    if (!reserve_candidates(&slice->candidates, clusters->light_count))
+    {
+        slice->failed = 1;
+        return;
+    }
+#ifdef LIGHTS_X86
+    if (simd)
+        select_candidates_sse(clusters, slice);
+#endif
+    if (!simd)
+        select_candidates_scalar(clusters, slice);
+    pad_candidates(&slice->candidates);
+    if (!reserve_candidates(&slice->row, slice->candidates.count))
+    {
+        slice->failed = 1;
+        return;
+    }
+
+    for (y = 0; y < LIGHT_CLUSTERS_Y; y++)
+    {
+        // a row can add at most every candidate to each of its clusters
+        if (!grow_indices(&slice->indices, &slice->index_capacity,
+            slice->index_count + slice->candidates.count * LIGHT_CLUSTERS_X))
+        {
+            slice->failed = 1;
+            return;
+        }
+        select_row(clusters, slice, y, simd);
+        for (x = 0; x < LIGHT_CLUSTERS_X; x++)
+        {
+            uint32_t *cell = &clusters->grid[((z * LIGHT_CLUSTERS_Y + y) * LIGHT_CLUSTERS_X + x) * 2];
+            uint32_t *out = slice->indices + slice->index_count;
+            float box_min[3], box_max[3];
+
+            cluster_box(clusters, slice, x, x + 1, y, box_min, box_max);
+            unsigned int count = test_box(&slice->row, box_min, box_max, out, simd);
+            for (i = 0; i < count; i++)
+                out[i] = slice->row.lights[out[i]];
+            // offsets are local to the slice until the slices are joined
+            cell[0] = slice->index_count;
+            cell[1] = count;
+            slice->index_count += count;
+        }
+    }
+}
+
+// moves the lights into view space, as SoA padded to a multiple of 4
+static int transform_lights(struct light_clusters *clusters, const struct camera *camera, const struct light *lights,
+    unsigned int light_count)
+{
+    unsigned int padded = (light_count + 3) & ~3u, i;
+
+    if (padded > clusters->view_capacity)
+    {
+        if (!grow_floats(&clusters->view_x, padded) || !grow_floats(&clusters->view_y, padded) ||
+            !grow_floats(&clusters->view_depth, padded) || !grow_floats(&clusters->view_radius, padded))
+            return 0;
+        clusters->view_capacity = padded;
+    }
+    for (i = 0; i < light_count; i++)
+    {
+        const float *p = lights[i].position, *v = camera->view;
+        clusters->view_x[i] = v[0] * p[0] + v[4] * p[1] + v[8] * p[2] + v[12];
+        clusters->view_y[i] = v[1] * p[0] + v[5] * p[1] + v[9] * p[2] + v[13];
+        clusters->view_depth[i] = -(v[2] * p[0] + v[6] * p[1] + v[10] * p[2] + v[14]);
+        clusters->view_radius[i] = lights[i].radius;
+    }
+    for (; i < padded; i++)
+    {
+        clusters->view_x[i] = clusters->view_y[i] = 0.0f;
+        clusters->view_depth[i] = -FAR_AWAY;
+        clusters->view_radius[i] = 0.0f;
+    }
+    return 1;
+}
+
+int light_clusters_build(struct light_clusters *clusters, const struct camera *camera, const struct light *lights,
+    unsigned int light_count, int width, int height)
+{
+    const float near = camera->near, far = LIGHT_CLUSTERS_FAR;
+    float log_range = logf(far / near);
+    unsigned int z, i;
+    int ok = 1;
+
+    clusters->lights = lights;
+    clusters->light_count = 0;
+    clusters->index_count = 0;
+    if (!transform_lights(clusters, camera, lights, light_count))
+        return 0;
+    clusters->light_count = light_count;
+    clusters->tile_scale[0] = 1.0f / camera->projection[0];
+    clusters->tile_scale[1] = 1.0f / camera->projection[5];
+    for (z = 0; z < LIGHT_CLUSTERS_Z; z++)
+    {
+        clusters->slices[z].depth[0] = near * powf(far / near, (float)z / LIGHT_CLUSTERS_Z);
+        clusters->slices[z].depth[1] = z + 1 < LIGHT_CLUSTERS_Z ?
+            near * powf(far / near, (float)(z + 1) / LIGHT_CLUSTERS_Z) : FAR_AWAY;
+    }
+    // slice = log(depth) * scale + bias, the inverse of the spacing above
+    clusters->cluster_scale[0] = (float)LIGHT_CLUSTERS_X / (float)(width > 0 ? width : 1);
+    clusters->cluster_scale[1] = (float)LIGHT_CLUSTERS_Y / (float)(height > 0 ? height : 1);
+    clusters->cluster_scale[2] = LIGHT_CLUSTERS_Z / log_range;
+    clusters->cluster_scale[3] = -LIGHT_CLUSTERS_Z * logf(near) / log_range;
+
+    thread_pool_parallel_for(clusters->pool, LIGHT_CLUSTERS_Z, bin_slice, clusters);
+
+    // join the slices' lists into one and make the grid offsets global
+    for (z = 0; z < LIGHT_CLUSTERS_Z; z++)
+    {
+        struct light_slice *slice = &clusters->slices[z];
+        uint32_t *cells = &clusters->grid[z * LIGHT_CLUSTERS_X * LIGHT_CLUSTERS_Y * 2];
+
+        if (slice->failed || !grow_indices(&clusters->indices, &clusters->index_capacity,
+            clusters->index_count + slice->index_count))
+        {
+            memset(cells, 0, sizeof(*cells) * LIGHT_CLUSTERS_X * LIGHT_CLUSTERS_Y * 2);
+            ok = 0;
+            continue;
+        }
+        memcpy(clusters->indices + clusters->index_count, slice->indices, sizeof(uint32_t) * slice->index_count);
+        for (i = 0; i < LIGHT_CLUSTERS_X * LIGHT_CLUSTERS_Y; i++)
+            cells[i * 2] += clusters->index_count;
+        clusters->index_count += slice->index_count;
+    }
+    return ok;
+}
+
+// respecifies a texture buffer's store with data; always at least one texel so the texture is valid
+static void upload(unsigned int buffer, unsigned int texture, GLenum format, const void *data, size_t size)
+{
+    static const uint32_t empty[4] = { 0, 0, 0, 0 };
+
+    glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+    glBufferData(GL_TEXTURE_BUFFER, size ? size : sizeof(empty), size ? data : empty, GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_BUFFER, texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, format, buffer);
+}
+
+void light_clusters_bind(struct light_clusters *clusters, struct ring_buffer *stream)
+{
+    if (clusters->light_buffer == 0)
+    {
+        glGenBuffers(1, &clusters->light_buffer);
+        glGenBuffers(1, &clusters->grid_buffer);
+        glGenBuffers(1, &clusters->index_buffer);
+        glGenTextures(1, &clusters->light_texture);
+        glGenTextures(1, &clusters->grid_texture);
+        glGenTextures(1, &clusters->index_texture);
+    }
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_LIGHTS);
+    upload(clusters->light_buffer, clusters->light_texture, GL_RGBA32F, clusters->lights,
+        sizeof(struct light) * clusters->light_count);
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_LIGHT_GRID);
+    upload(clusters->grid_buffer, clusters->grid_texture, GL_RG32UI, clusters->grid, sizeof(clusters->grid));
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_LIGHT_INDICES);
+    upload(clusters->index_buffer, clusters->index_texture, GL_R32UI, clusters->indices,
+        sizeof(uint32_t) * clusters->index_count);
+    glActiveTexture(GL_TEXTURE0);
+    uniforms_push(stream, UNIFORM_BINDING_LIGHTING, clusters->cluster_scale, sizeof(clusters->cluster_scale));
+}
@@ -0,0 +1,163 @@
+#include <lz4_block.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#define HASH_BITS 14
+#define MIN_MATCH 4
+// the format ends every block with at least 5 literals, and the last match has to start 12 bytes
+// before the end
+#define LAST_LITERALS 5
+#define MATCH_LIMIT 12
+#define MAX_OFFSET 65535
+
+static uint32_t read32(const unsigned char *p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint32_t hash4(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+size_t lz4_block_bound(size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+// writes the 255-run extension of a length field that overflowed its 4-bit nibble
+static unsigned char *put_length(unsigned char *op, unsigned char *end, size_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        if (op >= end)
+            return NULL;
+        *op++ = 255;
+    }
+    if (op >= end)
+        return NULL;
+    *op++ = (unsigned char)length;
+    return op;
+}
+
+// one sequence: token, literals, and unless this is the last one, the match
+static unsigned char *put_sequence(unsigned char *op, unsigned char *end, const unsigned char *literals,
+    size_t literal_count, size_t offset, size_t match_length)
+{
+    unsigned char *token = op;
+
+    if (op >= end)
+        return NULL;
+    op++;
+    *token = (unsigned char)((literal_count >= 15 ? 15 : literal_count) << 4);
+    if (literal_count >= 15 && (op = put_length(op, end, literal_count - 15)) == NULL)
+        return NULL;
+    if ((size_t)(end - op) < literal_count)
+        return NULL;
+    memcpy(op, literals, literal_count);
+    op += literal_count;
+    if (match_length == 0)
+        return op;
+
+    if (end - op < 2)
+        return NULL;
+    *op++ = (unsigned char)(offset & 0xff);
+    *op++ = (unsigned char)(offset >> 8);
+    match_length -= MIN_MATCH;
+    *token |= (unsigned char)(match_length >= 15 ? 15 : match_length);
+    if (match_length >= 15)
+        op = put_length(op, end, match_length - 15);
+    return op;
+}
+
+size_t lz4_block_compress(const unsigned char *src, size_t size, unsigned char *dst, size_t capacity)
+{
+    // positions + 1, so zero means empty
+    uint32_t table[1 << HASH_BITS];
+    unsigned char *op = dst, *end = dst + capacity;
+    size_t ip = 0, anchor = 0;
+
+    if (size > UINT32_MAX - 1)
+        return 0;
+    memset(table, 0, sizeof(table));
+    while (size > MATCH_LIMIT && ip < size - MATCH_LIMIT)
+    {
+        uint32_t sequence = read32(src + ip);
+        uint32_t h = hash4(sequence);
+        size_t candidate = table[h];
+        size_t length;
+
+        table[h] = (uint32_t)ip + 1;
+        if (candidate == 0 || ip - (candidate - 1) > MAX_OFFSET || read32(src + candidate - 1) != sequence)
+        {
+            ip++;
+            continue;
+        }
+        candidate--;
+        for (length = MIN_MATCH; ip + length < size - LAST_LITERALS && src[candidate + length] == src[ip + length];)
+            length++;
+
+        op = put_sequence(op, end, src + anchor, ip - anchor, ip - candidate, length);
+        if (op == NULL)
+            return 0;
+        ip += length;
+        anchor = ip;
+    }
+    op = put_sequence(op, end, src + anchor, size - anchor, 0, 0);
+    return op != NULL ? (size_t)(op - dst) : 0;
+}
+
+// a length nibble of 15 continues in following bytes
+static int get_length(const unsigned char **ip, const unsigned char *end, size_t *length)
+{
+    unsigned char byte;
+
+    if (*length != 15)
+        return 1;
+    do
+    {
+        if (*ip >= end)
+            return 0;
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return 1;
+}
+
+int lz4_block_decompress(const unsigned char *src, size_t src_size, unsigned char *dst, size_t size)
+{
+    const unsigned char *ip = src, *end = src + src_size;
+    size_t op = 0;
+
+    while (ip < end)
+    {
+        unsigned char token = *ip++;
+        size_t literal_count = token >> 4, match_length = token & 15, offset;
+
+        if (!get_length(&ip, end, &literal_count) || (size_t)(end - ip) < literal_count ||
+            size - op < literal_count)
+            return 0;
+        memcpy(dst + op, ip, literal_count);
+        ip += literal_count;
+        op += literal_count;
+        if (ip == end)
+            break;      // the last sequence has no match
+
+        if (end - ip < 2)
+            return 0;
+        offset = (size_t)ip[0] | (size_t)ip[1] << 8;
+        ip += 2;
+        if (offset == 0 || offset > op || !get_length(&ip, end, &match_length))
+            return 0;
+        match_length += MIN_MATCH;
+        if (size - op < match_length)
+            return 0;
+        // byte by byte: the match may overlap what it is copying
+        for (; match_length > 0; match_length--, op++)
+            dst[op] = dst[op - offset];
+    }
+    return op == size;
+}
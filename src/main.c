@@ -1,26 +1,103 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#include <atlas.h>
+#include <camera.h>
+#include <cube_field.h>
+#include <frustum.h>
+#include <light_clusters.h>
+#include <material.h>
+#include <math3d.h>
+#include <overdraw.h>
+#include <render_queue.h>
+#include <render_target.h>
+#include <ring_buffer.h>
+#include <shader.h>
+#include <shader_async.h>
+#include <shader_cache.h>
+#include <shader_library.h>
+#include <shadow_maps.h>
+#include <texture_stream.h>
+#include <thread_pool.h>
+#include <uniforms.h>
+#include <vfs.h>
+
+#include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void processInput(GLFWwindow *window);
+void moveCamera(GLFWwindow *window, struct camera *camera, float dt);
+int keyToggled(GLFWwindow *window, int key, int *down);
+void animateLights(struct light *lights, unsigned int count, float time);
+void makeContextCurrent(void *context);
+int makeSpriteImage(struct mip_level *image, int width, int height, unsigned int seed);
 
 // settings
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
+// bytes of per-frame streaming data (uniforms, instance data, debug lines) per in-flight frame
+const size_t STREAM_PARTITION_SIZE = 4 * 1024 * 1024;
+// where linked program binaries are kept between runs
+const char *SHADER_CACHE_DIR = ".shader_cache";
+// VRAM allowed for streamed textures, and how much texel data one frame may upload
+const size_t TEXTURE_BUDGET = 256 * 1024 * 1024;
+const size_t TEXTURE_UPLOAD_PER_FRAME = 8 * 1024 * 1024;
+// shader sources; the build points this at the source tree
+#ifndef SHADER_DIR
+#define SHADER_DIR "shaders"
+#endif
+// surface textures; the build points this at the source tree
+#ifndef TEXTURE_DIR
+#define TEXTURE_DIR "textures"
+#endif
+// packed shaders (pack <out> <dir>); read instead of SHADER_DIR when present
+const char *SHADER_PACK = "shaders" PACK_EXTENSION;
+// sprites along the bottom of the screen, all sampling one texture array
+#define SPRITE_COUNT 12
+const int SPRITE_ATLAS_SIZE = 256;
+const unsigned int SPRITE_ATLAS_LEVELS = 3;
+// materials the cube field (see cube_field.h) cycles through; cubes outside the view are culled
+#define CUBE_COLORS 4
+// lights drifting over the cube field, every fourth one a spot pointing down
+#define LIGHT_COUNT 2048
+const float LIGHT_RADIUS = 4.0f;
+// the sun: cascaded shadow map resolution and the direction its light travels
+const int SHADOW_MAP_SIZE = 2048;
+const float SUN_DIRECTION[3] = { -0.36f, -0.8f, -0.48f };
+// camera: vertical field of view, near plane (there is no far plane), movement and turning speed
+const float CAMERA_FOV_Y = 1.0471976f;
+const float CAMERA_NEAR = 0.1f;
+const float CAMERA_SPEED = 5.0f;
+const float CAMERA_TURN_SPEED = 1.5f;
 
-const char *vertexShaderSource = "#version 330 core\n"
+// drawn with until the real program finishes compiling in the background; kept trivial so it
+// builds instantly
+const char *fallbackVertexShaderSource = "#version 330 core\n"
     "layout (location = 0) in vec3 aPos;\n"
+    "layout (std140) uniform Frame\n"
+    "{\n"
+    "   mat4 view;\n"
+    "   mat4 projection;\n"
+    "   mat4 viewProjection;\n"
+    "   vec4 cameraPosition;\n"
+    "   vec4 time;\n"
+    "};\n"
+    "layout (std140) uniform Draw\n"
+    "{\n"
+    "   mat4 model;\n"
+    "};\n"
     "void main()\n"
     "{\n"
-    "   gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
+    "   gl_Position = viewProjection * model * vec4(aPos, 1.0);\n"
     "}\0";
-const char *fragmentShaderSource = "#version 330 core\n"
+const char *fallbackFragmentShaderSource = "#version 330 core\n"
     "out vec4 FragColor;\n"
     "void main()\n"
     "{\n"
-    "   FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+    "   FragColor = vec4(0.5f, 0.5f, 0.5f, 1.0f);\n"
     "}\n\0";
 
 int main()
@@ -38,6 +115,7 @@ int main()
 
     // glfw window creation
     // --------------------
+    double contextStart = glfwGetTime();
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
     if (window == NULL)
     {
@@ -47,50 +125,77 @@ int main()
     glfwMakeContextCurrent(window);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
-    // glad: load all OpenGL function pointers
-    // ---------------------------------------
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    // glad: point every OpenGL function at a trampoline that looks it up on its first call
+    // -------------------------------------------------------------------------------------
+    if (!gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress))
+    {
+        return -1;
+    }
+
+    // reversed-Z depth into a float depth buffer; the camera's projection and the CPU frustum
+    // culler are both built from the same view-projection matrix
+    // ------------------------------------------------------------------------------------------
+    int framebufferWidth, framebufferHeight;
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+    struct camera camera;
+    struct render_target sceneTarget;
+    camera_init(&camera, CAMERA_FOV_Y, (float)SCR_WIDTH / (float)SCR_HEIGHT, CAMERA_NEAR, camera_setup_depth());
+    camera.position[2] = 3.0f;
+    if (!render_target_init(&sceneTarget, framebufferWidth, framebufferHeight, GL_RGBA8))
     {
+        fprintf(stderr, "scene framebuffer incomplete\n");
+        glfwTerminate();
         return -1;
     }
 
 
     // build and compile our shader program
     // ------------------------------------
-    // vertex shader
-    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    // check for shader compile errors
-    int success;
+    // linked programs are cached on disk, so only the first launch after a shader or driver change
+    // pays for compiling and linking. variants are built in the background the first time they are
+    // drawn and draws use the fallback until they are ready, so the first frame does not wait on
+    // the compiler.
+    struct shader_cache shaderCache;
+    struct shader_compiler shaderCompiler;
     char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-    }
-    // fragment shader
-    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-    // check for shader compile errors
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-    }
-    // link shaders
-    unsigned int shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    // check for linking errors
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-    }
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    double shaderStart = glfwGetTime();
+    shader_cache_init(&shaderCache, SHADER_CACHE_DIR);
+    unsigned int fallbackProgram = shader_build_program(fallbackVertexShaderSource, fallbackFragmentShaderSource,
+        0, infoLog, sizeof(infoLog));
+    if (!fallbackProgram)
+    {
+        fprintf(stderr, "fallback shader build failed:\n%s\n", infoLog);
+        glfwTerminate();
+        return -1;
+    }
+    uniforms_bind_blocks(fallbackProgram);
+
+    // without driver-side parallel compile, a hidden window provides a context shared with ours
+    // for the compile thread
+    GLFWwindow* compileContext = NULL;
+    if (!GLAD_GL_KHR_parallel_shader_compile && !GLAD_GL_ARB_parallel_shader_compile)
+    {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        compileContext = glfwCreateWindow(1, 1, "", NULL, window);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+    }
+    // point the uniform blocks and samplers of every finished program at their bindings
+    shader_compiler_init(&shaderCompiler, &shaderCache, compileContext, makeContextCurrent, uniforms_bind_blocks);
+    struct shader_library shaderLibrary;
+    int shadersPacked = vfs_mount(SHADER_PACK, SHADER_DIR);
+    if (shadersPacked)
+        printf("shaders: reading from %s, edits to %s are not picked up\n", SHADER_PACK, SHADER_DIR);
+    shader_library_init(&shaderLibrary, SHADER_DIR, &shaderCompiler);
+    // pick up edits to the shader files while running. not with a pack mounted: a reload would
+    // read the packed sources again and drop the edit
+    if (!shadersPacked)
+        shader_library_watch(&shaderLibrary);
+    struct shader_variant *basicShader = shader_library_variant(&shaderLibrary, "basic", "");
+    struct shader_variant *spriteShader = shader_library_variant(&shaderLibrary, "sprite", "");
+    struct shader_variant *meshShader = shader_library_variant(&shaderLibrary, "mesh", "");
+    struct shader_variant *depthShader = shader_library_variant(&shaderLibrary, "depth", "");
+    struct shader_variant *overdrawShader = shader_library_variant(&shaderLibrary, "depth", "COUNT_FRAGMENTS");
+    int shaderReported = 0, firstDrawReported = 0;
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     // ------------------------------------------------------------------
@@ -130,6 +235,157 @@ int main()
     // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
     glBindVertexArray(0); 
 
+    // the same quad with texture coordinates for sprites; instance attributes are pointed at the
+    // stream buffer by the render queue
+    float spriteVertices[] = {
+         0.5f,  0.5f, 0.0f,  1.0f, 1.0f,
+         0.5f, -0.5f, 0.0f,  1.0f, 0.0f,
+        -0.5f, -0.5f, 0.0f,  0.0f, 0.0f,
+        -0.5f,  0.5f, 0.0f,  0.0f, 1.0f
+    };
+    unsigned int spriteVBO;
+    struct render_mesh spriteMesh = { 0, 6, 0, 0 };
+    glGenVertexArrays(1, &spriteMesh.vao);
+    glGenBuffers(1, &spriteVBO);
+    glBindVertexArray(spriteMesh.vao);
+    glBindBuffer(GL_ARRAY_BUFFER, spriteVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(spriteVertices), spriteVertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    // every sprite image goes into one texture array; draws then differ only by their region
+    struct mip_level spriteImages[SPRITE_COUNT];
+    struct atlas_region spriteRegions[SPRITE_COUNT];
+    struct atlas spriteAtlas;
+    int spritesMade = 1;
+    // without an atlas the sprite materials below still get (empty) regions
+    memset(spriteRegions, 0, sizeof(spriteRegions));
+    memset(&spriteAtlas, 0, sizeof(spriteAtlas));
+    for (unsigned int i = 0; i < SPRITE_COUNT; i++)
+        spritesMade &= makeSpriteImage(&spriteImages[i], 16 + (int)(i * 37 % 49), 16 + (int)(i * 23 % 49), i);
+    if (spritesMade && atlas_build(&spriteAtlas, spriteImages, SPRITE_COUNT, SPRITE_ATLAS_SIZE, SPRITE_ATLAS_LEVELS, 1, spriteRegions))
+        printf("atlas: %d sprites in %u layer(s)\n", SPRITE_COUNT, spriteAtlas.layer_count);
+    for (unsigned int i = 0; i < SPRITE_COUNT; i++)
+        free(spriteImages[i].pixels);
+
+    // one material per sprite: its atlas region and a tint. draws only carry the index, so the
+    // sprites still go out as one instanced draw.
+    struct material_table materials;
+    int spriteMaterials[SPRITE_COUNT];
+    material_table_init(&materials);
+    for (unsigned int i = 0; i < SPRITE_COUNT; i++)
+    {
+        struct material spriteMaterial = { { 1.0f, 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 0.0f } };
+        if (i % 3 == 2)
+            spriteMaterial.color[2] = 0.5f;
+        memcpy(spriteMaterial.uv_rect, spriteRegions[i].uv_rect, sizeof(spriteMaterial.uv_rect));
+        spriteMaterial.layer[0] = spriteRegions[i].layer;
+        spriteMaterials[i] = material_table_add(&materials, &spriteMaterial);
+    }
+
+    // the cube field: world bounds are computed once and tested against the camera every frame
+    struct mesh_data cubeData;
+    struct render_mesh cubeMesh;
+    struct render_instance *cubes = (struct render_instance *)calloc(CUBE_FIELD_COUNT, sizeof(*cubes));
+    struct aabb *cubeBounds = (struct aabb *)malloc(sizeof(*cubeBounds) * CUBE_FIELD_COUNT);
+    unsigned int *visibleCubes = (unsigned int *)malloc(sizeof(*visibleCubes) * CUBE_FIELD_COUNT);
+    if (cubes == NULL || cubeBounds == NULL || visibleCubes == NULL || !cube_mesh_create(&cubeData))
+    {
+        glfwTerminate();
+        return -1;
+    }
+    render_mesh_create(&cubeMesh, &cubeData);
+    struct aabb cubeLocalBounds;
+    memcpy(cubeLocalBounds.min, cubeData.bounds_min, sizeof(cubeLocalBounds.min));
+    memcpy(cubeLocalBounds.max, cubeData.bounds_max, sizeof(cubeLocalBounds.max));
+    mesh_free(&cubeData);
+    int cubeMaterials[CUBE_COLORS];
+    for (unsigned int i = 0; i < CUBE_COLORS; i++)
+    {
+        struct material cubeMaterial = { { 0.9f, 0.9f, 0.9f, 1.0f }, { 0.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 0.0f } };
+        cubeMaterial.color[i % 3] = 0.3f;
+        cubeMaterials[i] = material_table_add(&materials, &cubeMaterial);
+    }
+    for (unsigned int i = 0; i < CUBE_FIELD_COUNT; i++)
+    {
+        float position[3];
+        cube_field_position(i, position);
+        mat4_translation(cubes[i].model, position[0], position[1], position[2]);
+        cubes[i].material = (unsigned int)(cubeMaterials[i % CUBE_COLORS] >= 0 ? cubeMaterials[i % CUBE_COLORS] : 0);
+        aabb_transform(&cubeBounds[i], &cubeLocalBounds, cubes[i].model);
+    }
+
+
+    // streaming buffer for everything that changes per frame
+    // ------------------------------------------------------
+    struct ring_buffer stream;
+    if (!ring_buffer_create(&stream, STREAM_PARTITION_SIZE))
+    {
+        glfwTerminate();
+        return -1;
+    }
+
+
+    // sorts and instances the sprite and cube draws each frame. P toggles the Z-prepass; O
+    // toggles measuring overdraw (debug: it replays the frame and reads the counts back)
+    struct render_queue renderQueue;
+    struct overdraw_counter overdraw;
+    int depthPrepass = 0, measureOverdraw = 0, prepassKeyDown = 0, overdrawKeyDown = 0;
+    double overdrawReported = 0.0;
+    render_queue_init(&renderQueue, &stream);
+    if (!overdraw_counter_init(&overdraw, framebufferWidth, framebufferHeight))
+        fprintf(stderr, "overdraw counter framebuffer incomplete\n");
+
+
+    // background workers (texture decoding) and the texture streamer they feed
+    // -------------------------------------------------------------------------
+    struct thread_pool workers;
+    struct texture_streamer textures;
+    if (!thread_pool_init(&workers, 0) || !texture_streamer_init(&textures, &workers, TEXTURE_BUDGET, TEXTURE_UPLOAD_PER_FRAME))
+    {
+        glfwTerminate();
+        return -1;
+    }
+    // the cubes' surface. the scene is shaded without sRGB conversion, so neither is the texture
+    struct texture *cubeTexture = texture_streamer_load(&textures, TEXTURE_DIR "/tiles.png", 0);
+
+    // lights are binned into clusters of the view frustum on the workers every frame
+    struct light *lights = (struct light *)malloc(sizeof(*lights) * LIGHT_COUNT);
+    struct light_clusters lightClusters;
+    if (lights == NULL)
+    {
+        glfwTerminate();
+        return -1;
+    }
+    light_clusters_init(&lightClusters, &workers);
+
+    // the cube field casts cached shadows; one cube bobbing above it is redrawn every frame
+    struct shadow_maps shadows;
+    if (!shadow_maps_init(&shadows, SHADOW_MAP_SIZE, SUN_DIRECTION, camera.zero_to_one))
+    {
+        glfwTerminate();
+        return -1;
+    }
+    for (unsigned int i = 0; i < CUBE_FIELD_COUNT; i++)
+        shadow_maps_add_static(&shadows, &cubeMesh, &cubes[i], &cubeBounds[i]);
+    struct render_instance floatingCube;
+    struct aabb floatingCubeBounds;
+    memset(&floatingCube, 0, sizeof(floatingCube));
+    floatingCube.material = cubes[0].material;
+
+    // per-frame, per-material and per-draw constants
+    // ----------------------------------------------
+    struct frame_uniforms frame;
+    struct material_uniforms material = { { 1.0f, 0.5f, 0.2f, 1.0f } };
+    struct draw_uniforms draw;
+    camera_fill_uniforms(&camera, &frame);
+    memset(frame.time, 0, sizeof(frame.time));
+    mat4_identity(draw.model);
 
     // uncomment this call to draw in wireframe polygons.
     //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
@@ -141,18 +397,125 @@ int main()
         // input
         // -----
         processInput(window);
+        if (keyToggled(window, GLFW_KEY_P, &prepassKeyDown))
+        {
+            depthPrepass = !depthPrepass;
+            printf("z-prepass: %s\n", depthPrepass ? "on" : "off");
+        }
+        if (keyToggled(window, GLFW_KEY_O, &overdrawKeyDown))
+            measureOverdraw = !measureOverdraw;
+
+        // wait for the GPU to release this frame's partition of the stream buffer
+        ring_buffer_begin_frame(&stream);
+
+        // pick up programs that finished compiling since the last frame and rebuild edited shaders;
+        // programs only ever change here, between frames
+        unsigned int shadersPending = shader_compiler_poll(&shaderCompiler);
+        shader_library_update(&shaderLibrary);
+        if (!shaderReported && basicShader->sources != NULL && shadersPending == 0)
+        {
+            // without binary support nothing is counted: every program was compiled from source
+            if (!shaderCache.enabled)
+                printf("shaders: %.2f ms (uncached)\n", (glfwGetTime() - shaderStart) * 1000.0);
+            else
+                printf("shaders: %.2f ms (%s, %u cached, %u compiled)\n", (glfwGetTime() - shaderStart) * 1000.0,
+                    shaderCache.misses ? "cold" : "warm", shaderCache.hits, shaderCache.misses);
+            shaderReported = 1;
+        }
+
+        // upload whatever texture mips the workers finished decoding
+        texture_streamer_update(&textures);
+
+        float now = (float)glfwGetTime();
+        frame.time[1] = now - frame.time[0];
+        frame.time[0] = now;
+
+        // camera: follow the window's shape, then rebuild the matrices and frustum
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        render_target_resize(&sceneTarget, framebufferWidth, framebufferHeight);
+        if (framebufferWidth > 0 && framebufferHeight > 0)
+            camera.aspect = (float)framebufferWidth / (float)framebufferHeight;
+        moveCamera(window, &camera, frame.time[1]);
+        camera_update(&camera);
+        camera_fill_uniforms(&camera, &frame);
+        animateLights(lights, LIGHT_COUNT, now);
+        light_clusters_build(&lightClusters, &camera, lights, LIGHT_COUNT, framebufferWidth, framebufferHeight);
+        render_queue_set_eye(&renderQueue, camera.position);
+
+        // shadows: only the texels that scrolled into view or sat under a moving caster are rendered
+        mat4_translation(floatingCube.model, 0.0f, 1.0f + 0.75f * sinf(now * 1.5f), -8.0f);
+        aabb_transform(&floatingCubeBounds, &cubeLocalBounds, floatingCube.model);
+        shadow_maps_add_dynamic(&shadows, &cubeMesh, &floatingCube, &floatingCubeBounds);
+        shadow_maps_update(&shadows, &camera, &stream, &renderQueue, shader_variant_program(&shaderLibrary, depthShader, 0));
+        uniforms_push(&stream, UNIFORM_BINDING_FRAME, &frame, sizeof(frame));
 
         // render
         // ------
+        render_target_bind(&sceneTarget);
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         // draw our first triangle
-        glUseProgram(shaderProgram);
+        glUseProgram(shader_variant_program(&shaderLibrary, basicShader, fallbackProgram));
+        uniforms_push(&stream, UNIFORM_BINDING_MATERIAL, &material, sizeof(material));
+        uniforms_push(&stream, UNIFORM_BINDING_DRAW, &draw, sizeof(draw));
         glBindVertexArray(VAO); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
         //glDrawArrays(GL_TRIANGLES, 0, 6);
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
         // glBindVertexArray(0); // no need to unbind it every time 
+        if (!firstDrawReported)
+        {
+            glFinish();
+            printf("first draw: %.2f ms after context creation\n", (glfwGetTime() - contextStart) * 1000.0);
+            firstDrawReported = 1;
+        }
+
+        // sprites: one instanced draw for all of them, since they share program, mesh and atlas
+        unsigned int spriteProgram = shader_variant_program(&shaderLibrary, spriteShader, 0);
+        for (unsigned int i = 0; i < SPRITE_COUNT && spriteAtlas.texture && spriteMaterials[i] >= 0; i++)
+        {
+            struct render_instance sprite;
+            float scale[16];
+            memset(&sprite, 0, sizeof(sprite));
+            mat4_translation(sprite.model, -0.88f + (float)i * 0.16f, -0.8f, 0.0f);
+            mat4_scale(scale, 0.14f, 0.14f, 1.0f);
+            mat4_multiply(sprite.model, sprite.model, scale);
+            sprite.material = (unsigned int)spriteMaterials[i];
+            render_queue_submit(&renderQueue, spriteProgram, &spriteMesh, spriteAtlas.texture, &sprite);
+        }
+
+        // cubes: only the ones inside the same frustum the GPU clips against are submitted
+        unsigned int meshProgram = shader_variant_program(&shaderLibrary, meshShader, 0);
+        unsigned int visibleCubeCount = frustum_cull(&camera.frustum, cubeBounds, CUBE_FIELD_COUNT, visibleCubes);
+        for (unsigned int i = 0; i < visibleCubeCount; i++)
+            render_queue_submit(&renderQueue, meshProgram, &cubeMesh, 0, &cubes[visibleCubes[i]]);
+        if (frustum_test_aabb(&camera.frustum, &floatingCubeBounds))
+            render_queue_submit(&renderQueue, meshProgram, &cubeMesh, 0, &floatingCube);
+
+        // opaque draws front to back, optionally after laying down depth so each pixel is shaded once
+        material_table_bind(&materials);
+        light_clusters_bind(&lightClusters, &stream);
+        shadow_maps_bind(&shadows, &stream);
+        if (cubeTexture != NULL)
+        {
+            glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_ALBEDO);
+            glBindTexture(GL_TEXTURE_2D, texture_streamer_use(&textures, cubeTexture));
+            glActiveTexture(GL_TEXTURE0);
+        }
+        renderQueue.prepass_program = depthPrepass ? shader_variant_program(&shaderLibrary, depthShader, 0) : 0;
+        render_queue_flush(&renderQueue);
+        if (measureOverdraw && overdraw_counter_measure(&overdraw, &renderQueue,
+            shader_variant_program(&shaderLibrary, overdrawShader, 0), framebufferWidth, framebufferHeight) &&
+            now - overdrawReported >= 1.0)
+        {
+            printf("overdraw: %.2f fragments per covered pixel (%.0f fragments, %u of %u pixels, z-prepass %s)\n",
+                overdraw_counter_ratio(&overdraw), overdraw.fragments, overdraw.covered_pixels, overdraw.pixels,
+                renderQueue.prepass_program ? "on" : "off");
+            overdrawReported = now;
+        }
+        render_target_present(&sceneTarget, framebufferWidth, framebufferHeight);
+
+        ring_buffer_end_frame(&stream);
  
         // glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
         // -------------------------------------------------------------------------------
@@ -165,7 +528,30 @@ int main()
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glDeleteBuffers(1, &EBO);
-    glDeleteProgram(shaderProgram);
+    glDeleteVertexArrays(1, &spriteMesh.vao);
+    glDeleteBuffers(1, &spriteVBO);
+    render_mesh_destroy(&cubeMesh);
+    free(cubes);
+    free(cubeBounds);
+    free(visibleCubes);
+    render_target_destroy(&sceneTarget);
+    atlas_destroy(&spriteAtlas);
+    material_table_shutdown(&materials);
+    render_queue_shutdown(&renderQueue);
+    overdraw_counter_destroy(&overdraw);
+    light_clusters_shutdown(&lightClusters);
+    shadow_maps_shutdown(&shadows);
+    free(lights);
+    shader_library_shutdown(&shaderLibrary);
+    shader_compiler_shutdown(&shaderCompiler);
+    glDeleteProgram(fallbackProgram);
+    ring_buffer_destroy(&stream);
+    texture_streamer_shutdown(&textures);
+    thread_pool_shutdown(&workers);
+    vfs_unmount_all();
+
+    if (compileContext)
+        glfwDestroyWindow(compileContext);
 
     // glfw: terminate, clearing all previously allocated GLFW resources.
     // ------------------------------------------------------------------
@@ -181,6 +567,77 @@ void processInput(GLFWwindow *window)
         glfwSetWindowShouldClose(window, 1);
 }
 
+// fly the camera: WASD moves, Q/E go down and up, the arrow keys turn
+// -------------------------------------------------------------------
+void moveCamera(GLFWwindow *window, struct camera *camera, float dt)
+{
+    float forward[3], right[3];
+    float move = CAMERA_SPEED * dt, turn = CAMERA_TURN_SPEED * dt;
+    camera_axes(camera, forward, right);
+    for (int c = 0; c < 3; c++)
+    {
+        if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
+            camera->position[c] += forward[c] * move;
+        if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
+            camera->position[c] -= forward[c] * move;
+        if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
+            camera->position[c] += right[c] * move;
+        if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
+            camera->position[c] -= right[c] * move;
+    }
+    if (glfwGetKey(window, GLFW_KEY_E) == GLFW_PRESS)
+        camera->position[1] += move;
+    if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)
+        camera->position[1] -= move;
+    if (glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS)
+        camera->yaw -= turn;
+    if (glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS)
+        camera->yaw += turn;
+    if (glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS)
+        camera->pitch += turn;
+    if (glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS)
+        camera->pitch -= turn;
+    // stop short of straight up or down, where the view basis degenerates
+    if (camera->pitch > 1.5f)
+        camera->pitch = 1.5f;
+    if (camera->pitch < -1.5f)
+        camera->pitch = -1.5f;
+}
+
+// lights circling over the cube field, each on its own orbit and in its own color
+// -------------------------------------------------------------------------------
+void animateLights(struct light *lights, unsigned int count, float time)
+{
+    const float down[3] = { 0.0f, -1.0f, 0.0f };
+    float extent = CUBE_FIELD_SIZE * CUBE_FIELD_SPACING * 0.5f;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int hash = i * 2654435761u;
+        float u = (float)(hash & 0xffff) / 65535.0f, v = (float)(hash >> 16) / 65535.0f;
+        float angle = time * (0.3f + 0.7f * v) + (float)i;
+        float position[3] = { (u * 2.0f - 1.0f) * extent + 2.0f * cosf(angle), -0.5f + 0.5f * sinf(angle * 1.7f),
+            (v * 2.0f - 1.0f) * extent + 2.0f * sinf(angle) };
+        float color[3] = { 0.5f + 0.5f * sinf((float)i), 0.5f + 0.5f * sinf((float)i * 1.3f + 2.0f),
+            0.5f + 0.5f * sinf((float)i * 1.9f + 4.0f) };
+        for (int c = 0; c < 3; c++)
+            color[c] *= 6.0f;
+        if (i % 4 == 3)
+            light_spot(&lights[i], position, down, LIGHT_RADIUS * 1.5f, color, 0.4f, 0.6f);
+        else
+            light_point(&lights[i], position, LIGHT_RADIUS, color);
+    }
+}
+
+// true once per press of key; down remembers whether it was held last frame
+// ---------------------------------------------------------------------------
+int keyToggled(GLFWwindow *window, int key, int *down)
+{
+    int pressed = glfwGetKey(window, key) == GLFW_PRESS;
+    int toggled = pressed && !*down;
+    *down = pressed;
+    return toggled;
+}
+
 // glfw: whenever the window size changed (by OS or user resize) this callback function executes
 // ---------------------------------------------------------------------------------------------
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
@@ -189,3 +646,36 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
     // height will be significantly larger than specified on retina displays.
     glViewport(0, 0, width, height);
 }
+
+// shader compile thread: binds the hidden window's shared context to the calling thread
+// ---------------------------------------------------------------------------------------
+void makeContextCurrent(void *context)
+{
+    glfwMakeContextCurrent((GLFWwindow*)context);
+}
+
+// a framed two-tone checkerboard, different for every seed, standing in for sprite art
+// ----------------------------------------------------------------------------------
+int makeSpriteImage(struct mip_level *image, int width, int height, unsigned int seed)
+{
+    unsigned char a[3] = { (unsigned char)(80 + seed * 53 % 176), (unsigned char)(80 + seed * 97 % 176), (unsigned char)(80 + seed * 29 % 176) };
+    image->width = width;
+    image->height = height;
+    image->size = (size_t)width * height * 4;
+    image->pixels = (unsigned char *)malloc(image->size);
+    if (image->pixels == NULL)
+        return 0;
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            unsigned char *p = image->pixels + ((size_t)y * width + x) * 4;
+            int frame = x < 2 || y < 2 || x >= width - 2 || y >= height - 2;
+            int light = ((x / 4) ^ (y / 4)) & 1;
+            for (int c = 0; c < 3; c++)
+                p[c] = frame ? 255 : light ? a[c] : (unsigned char)(a[c] / 3);
+            p[3] = 255;
+        }
+    }
+    return 1;
+}
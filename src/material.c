@@ -0,0 +1,85 @@
+#include <glad/glad.h>
+#include <material.h>
+#include <uniforms.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+void material_table_init(struct material_table *table)
+{
+    memset(table, 0, sizeof(*table));
+    glGenBuffers(1, &table->buffer);
+    glGenTextures(1, &table->texture);
+}
+
+void material_table_shutdown(struct material_table *table)
+{
+    glDeleteTextures(1, &table->texture);
+    glDeleteBuffers(1, &table->buffer);
+    free(table->materials);
+    memset(table, 0, sizeof(*table));
+}
+
+static void mark_dirty(struct material_table *table, unsigned int index)
+{
+    if (table->dirty_begin >= table->dirty_end)
+    {
+        table->dirty_begin = index;
+        table->dirty_end = index + 1;
+        return;
+    }
+    if (index < table->dirty_begin)
+        table->dirty_begin = index;
+    if (index + 1 > table->dirty_end)
+        table->dirty_end = index + 1;
+}
+
+int material_table_add(struct material_table *table, const struct material *material)
+{
+    if (table->count == table->capacity)
+    {
+        unsigned int capacity = table->capacity ? table->capacity * 2 : 64;
+        struct material *materials = (struct material *)realloc(table->materials, sizeof(*materials) * capacity);
+        if (materials == NULL)
+            return -1;
+        table->materials = materials;
+        table->capacity = capacity;
+    }
+    table->materials[table->count] = *material;
+    mark_dirty(table, table->count);
+    return (int)table->count++;
+}
+
+void material_table_set(struct material_table *table, unsigned int index, const struct material *material)
+{
+    if (index >= table->count)
+        return;
+    table->materials[index] = *material;
+    mark_dirty(table, index);
+}
+
+void material_table_bind(struct material_table *table)
+{
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_MATERIALS);
+    glBindTexture(GL_TEXTURE_BUFFER, table->texture);
+    if (table->dirty_begin < table->dirty_end)
+    {
+        glBindBuffer(GL_TEXTURE_BUFFER, table->buffer);
+        if (table->uploaded_capacity < table->capacity)
+        {
+            // grown: respecify the whole store and re-attach it
+            glBufferData(GL_TEXTURE_BUFFER, sizeof(struct material) * table->capacity, NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_TEXTURE_BUFFER, 0, sizeof(struct material) * table->count, table->materials);
+            glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, table->buffer);
+            table->uploaded_capacity = table->capacity;
+        }
+        else
+        {
+            glBufferSubData(GL_TEXTURE_BUFFER, sizeof(struct material) * table->dirty_begin,
+                sizeof(struct material) * (table->dirty_end - table->dirty_begin), &table->materials[table->dirty_begin]);
+        }
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+        table->dirty_begin = table->dirty_end = 0;
+    }
+    glActiveTexture(GL_TEXTURE0);
+}
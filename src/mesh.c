@@ -0,0 +1,127 @@
+#include <mesh.h>
+#include <vfs.h>
+
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MESH_MAGIC 0x4853454du  // "MESH"
+#define MESH_VERSION 1
+
+// file layout: header, vertices, then indices
+struct mesh_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vertex_count;
+    uint32_t index_count;
+    float bounds_min[3];
+    float bounds_max[3];
+};
+
+int mesh_save(const struct mesh_data *mesh, const char *path)
+{
+    struct mesh_header header;
+    FILE *file = fopen(path, "wb");
+    int success;
+
+    if (file == NULL)
+        return 0;
+    header.magic = MESH_MAGIC;
+    header.version = MESH_VERSION;
+    header.vertex_count = mesh->vertex_count;
+    header.index_count = mesh->index_count;
+    memcpy(header.bounds_min, mesh->bounds_min, sizeof(header.bounds_min));
+    memcpy(header.bounds_max, mesh->bounds_max, sizeof(header.bounds_max));
+    success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+        fwrite(mesh->vertices, sizeof(struct mesh_vertex), mesh->vertex_count, file) == mesh->vertex_count &&
+        fwrite(mesh->indices, sizeof(uint32_t), mesh->index_count, file) == mesh->index_count;
+    success &= fclose(file) == 0;
+    if (!success)
+        remove(path);
+    return success;
+}
+
+int mesh_decode(const unsigned char *data, size_t size, struct mesh_data *mesh)
+{
+    struct mesh_header header;
+    size_t vertex_bytes, index_bytes;
+    uint32_t i;
+
+    memset(mesh, 0, sizeof(*mesh));
+    if (size < sizeof(header))
+        return 0;
+    memcpy(&header, data, sizeof(header));
+    vertex_bytes = (size_t)header.vertex_count * sizeof(struct mesh_vertex);
+    index_bytes = (size_t)header.index_count * sizeof(uint32_t);
+    if (header.magic != MESH_MAGIC || header.version != MESH_VERSION || header.index_count % 3 != 0 ||
+        vertex_bytes > size - sizeof(header) || index_bytes > size - sizeof(header) - vertex_bytes)
+        return 0;
+
+    mesh->vertices = (struct mesh_vertex *)malloc(vertex_bytes ? vertex_bytes : 1);
+    mesh->indices = (uint32_t *)malloc(index_bytes ? index_bytes : 1);
+    if (mesh->vertices == NULL || mesh->indices == NULL)
+    {
+        mesh_free(mesh);
+        return 0;
+    }
+    memcpy(mesh->vertices, data + sizeof(header), vertex_bytes);
+    memcpy(mesh->indices, data + sizeof(header) + vertex_bytes, index_bytes);
+    mesh->vertex_count = header.vertex_count;
+    mesh->index_count = header.index_count;
+    memcpy(mesh->bounds_min, header.bounds_min, sizeof(header.bounds_min));
+    memcpy(mesh->bounds_max, header.bounds_max, sizeof(header.bounds_max));
+    for (i = 0; i < mesh->index_count; i++)
+    {
+        if (mesh->indices[i] >= mesh->vertex_count)
+        {
+            mesh_free(mesh);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int mesh_load(const char *path, struct mesh_data *mesh)
+{
+    size_t size = 0;
+    unsigned char *data = vfs_read(path, &size);
+    int ok;
+
+    memset(mesh, 0, sizeof(*mesh));
+    if (data == NULL)
+        return 0;
+    ok = mesh_decode(data, size, mesh);
+    free(data);
+    return ok;
+}
+
+void mesh_free(struct mesh_data *mesh)
+{
+    free(mesh->vertices);
+    free(mesh->indices);
+    memset(mesh, 0, sizeof(*mesh));
+}
+
+void mesh_compute_bounds(struct mesh_data *mesh)
+{
+    uint32_t i, axis;
+
+    for (axis = 0; axis < 3; axis++)
+    {
+        mesh->bounds_min[axis] = mesh->vertex_count ? FLT_MAX : 0.0f;
+        mesh->bounds_max[axis] = mesh->vertex_count ? -FLT_MAX : 0.0f;
+    }
+    for (i = 0; i < mesh->vertex_count; i++)
+    {
+        for (axis = 0; axis < 3; axis++)
+        {
+            float value = mesh->vertices[i].position[axis];
+            if (value < mesh->bounds_min[axis])
+                mesh->bounds_min[axis] = value;
+            if (value > mesh->bounds_max[axis])
+                mesh->bounds_max[axis] = value;
+        }
+    }
+}
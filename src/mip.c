@@ -0,0 +1,544 @@
+#include <mip.h>
+
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MIP_X86 1
+#include <immintrin.h>
+#endif
+
+// linear -> sRGB goes through a table this big; the step near black is under half a code value
+#define SRGB_ENCODE_SIZE 8192
+
+// output rows per parallel task, scaled down for wide levels so tasks stay around this many pixels
+#define BAND_PIXELS 65536
+
+struct kernel
+{
+    int taps;
+    int offset;         // source column of the first tap for output column 0, before the 2x
+    float weights[8];
+};
+
+static float decode_table[2][256];      // [0] sRGB -> linear, [1] unorm -> float
+static int32_t encode_table[SRGB_ENCODE_SIZE];
+static struct kernel kernels[2];
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+static int simd_override = -1;
+
+static double bessel_i0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    int k;
+
+    for (k = 1; k < 32; k++)
+    {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+static void init_tables(void)
+{
+    const double pi = 3.14159265358979323846, beta = 4.0, radius = 4.0;
+    double sum = 0.0;
+    int i;
+
+    for (i = 0; i < 256; i++)
+    {
+        double c = i / 255.0;
+        decode_table[0][i] = (float)(c <= 0.04045 ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4));
+        decode_table[1][i] = (float)c;
+    }
+    for (i = 0; i < SRGB_ENCODE_SIZE; i++)
+    {
+        double l = (double)i / (SRGB_ENCODE_SIZE - 1);
+        double c = l <= 0.0031308 ? l * 12.92 : 1.055 * pow(l, 1.0 / 2.4) - 0.055;
+        encode_table[i] = (int32_t)(c * 255.0 + 0.5);
+    }
+
+    kernels[MIP_FILTER_BOX].taps = 2;
+    kernels[MIP_FILTER_BOX].offset = 0;
+    kernels[MIP_FILTER_BOX].weights[0] = 0.5f;
+    kernels[MIP_FILTER_BOX].weights[1] = 0.5f;
+
+    // sinc cut off at the new Nyquist limit, windowed over 4 source pixels either side
+    kernels[MIP_FILTER_KAISER].taps = 8;
+    kernels[MIP_FILTER_KAISER].offset = -3;
+    double weights[8];
+    for (i = 0; i < 8; i++)
+    {
+        double d = i - 3.5, x = pi * d / 2.0, t = d / radius;
+        weights[i] = sin(x) / x * bessel_i0(beta * sqrt(1.0 - t * t)) / bessel_i0(beta);
+        sum += weights[i];
+    }
+    for (i = 0; i < 8; i++)
+        kernels[MIP_FILTER_KAISER].weights[i] = (float)(weights[i] / sum);
+}
+
+static enum mip_simd detect_simd(void)
+{
+#ifdef MIP_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return MIP_SIMD_AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return MIP_SIMD_SSE;
+#endif
+    return MIP_SIMD_NONE;
+}
+
+enum mip_simd mip_simd(void)
+{
+    enum mip_simd best = detect_simd();
+
+    if (simd_override >= 0 && (enum mip_simd)simd_override < best)
+        return (enum mip_simd)simd_override;
+    return best;
+}
+
+void mip_set_simd(enum mip_simd simd)
+{
+    simd_override = (int)simd;
+}
+
+static int clamp_int(int v, int lo, int hi)
+{
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+// ---------------------------------------------------------------------------------------------
+// row kernels. rows are RGBA floats; the horizontal pass halves a row, the vertical pass blends
+// kernel->taps horizontally filtered rows into one, encode quantizes back to bytes.
+
+// columns [*begin, *end) of the output read only in-bounds source pixels
+static void interior_columns(const struct kernel *kernel, int src_width, int dst_width, int *begin, int *end)
+{
+    int last = src_width - kernel->taps - kernel->offset;
+
+    *begin = kernel->offset < 0 ? (1 - kernel->offset) / 2 : 0;
+    *end = last >= 0 ? last / 2 + 1 : 0;
+    if (*end > dst_width)
+        *end = dst_width;
+    if (*begin > *end)
+        *begin = *end;
+}
+
+static void decode_row_scalar(const unsigned char *src, float *dst, int width, int srgb)
+{
+    const float *color = decode_table[srgb ? 0 : 1], *alpha = decode_table[1];
+    int x;
+
+    for (x = 0; x < width; x++)
+    {
+        dst[x * 4 + 0] = color[src[x * 4 + 0]];
+        dst[x * 4 + 1] = color[src[x * 4 + 1]];
+        dst[x * 4 + 2] = color[src[x * 4 + 2]];
+        dst[x * 4 + 3] = alpha[src[x * 4 + 3]];
+    }
+}
+
+static void horizontal_pixel_scalar(const struct kernel *kernel, const float *src, int src_width, int x, float *dst)
+{
+    float acc[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    int k, c;
+
+    for (k = 0; k < kernel->taps; k++)
+    {
+        const float *p = src + clamp_int(2 * x + kernel->offset + k, 0, src_width - 1) * 4;
+        for (c = 0; c < 4; c++)
+            acc[c] += kernel->weights[k] * p[c];
+    }
+    memcpy(dst, acc, sizeof(acc));
+}
+
+static void horizontal_scalar(const struct kernel *kernel, const float *src, int src_width, float *dst, int dst_width)
+{
+    int x;
+
+    for (x = 0; x < dst_width; x++)
+        horizontal_pixel_scalar(kernel, src, src_width, x, dst + x * 4);
+}
+
+static void vertical_scalar(const struct kernel *kernel, const float *const *rows, float *dst, int count)
+{
+    int i, k;
+
+    for (i = 0; i < count; i++)
+    {
+        float acc = 0.0f;
+        for (k = 0; k < kernel->taps; k++)
+            acc += kernel->weights[k] * rows[k][i];
+        dst[i] = acc;
+    }
+}
+
+static int32_t quantize(float v, int srgb_channel)
+{
+    // round to nearest even, like the SIMD conversions, so every path gives the same bytes
+    v = v < 0.0f ? 0.0f : v > 1.0f ? 1.0f : v;
+    if (srgb_channel)
+        return encode_table[lrintf(v * (SRGB_ENCODE_SIZE - 1))];
+    return (int32_t)lrintf(v * 255.0f);
+}
+
+static void encode_scalar(const float *src, unsigned char *dst, int width, int srgb)
+{
+    int i;
+
+    for (i = 0; i < width * 4; i++)
+        dst[i] = (unsigned char)quantize(src[i], srgb && (i & 3) != 3);
+}
+
+#ifdef MIP_X86
+
+__attribute__((target("sse2")))
+static void horizontal_sse(const struct kernel *kernel, const float *src, int src_width, float *dst, int dst_width)
+{
+    int begin, end, x, k;
+
+    interior_columns(kernel, src_width, dst_width, &begin, &end);
+    for (x = 0; x < begin; x++)
+        horizontal_pixel_scalar(kernel, src, src_width, x, dst + x * 4);
+    // one pixel per iteration, its four channels side by side
+    for (; x < end; x++)
+    {
+        const float *p = src + (2 * x + kernel->offset) * 4;
+        __m128 acc = _mm_setzero_ps();
+        for (k = 0; k < kernel->taps; k++)
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(kernel->weights[k]), _mm_loadu_ps(p + k * 4)));
+        _mm_storeu_ps(dst + x * 4, acc);
+    }
+    for (; x < dst_width; x++)
+        horizontal_pixel_scalar(kernel, src, src_width, x, dst + x * 4);
+}
+
+__attribute__((target("sse2")))
+static void vertical_sse(const struct kernel *kernel, const float *const *rows, float *dst, int count)
+{
+    int i, k;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        __m128 acc = _mm_mul_ps(_mm_set1_ps(kernel->weights[0]), _mm_loadu_ps(rows[0] + i));
+        for (k = 1; k < kernel->taps; k++)
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(kernel->weights[k]), _mm_loadu_ps(rows[k] + i)));
+        _mm_storeu_ps(dst + i, acc);
+    }
+}
+
+__attribute__((target("sse2")))
+static void encode_sse(const float *src, unsigned char *dst, int width, int srgb)
+{
+    const float top = srgb ? (float)(SRGB_ENCODE_SIZE - 1) : 255.0f;
+    const __m128 scale = _mm_setr_ps(top, top, top, 255.0f), zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+    int x;
+
+    for (x = 0; x < width; x++)
+    {
+        __m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + x * 4), zero), one);
+        __m128i q = _mm_cvtps_epi32(_mm_mul_ps(v, scale));
+        if (srgb)
+        {
+            int32_t index[4];
+            _mm_storeu_si128((__m128i *)index, q);
+            // no gather before AVX2
+            dst[x * 4 + 0] = (unsigned char)encode_table[index[0]];
+            dst[x * 4 + 1] = (unsigned char)encode_table[index[1]];
+            dst[x * 4 + 2] = (unsigned char)encode_table[index[2]];
+            dst[x * 4 + 3] = (unsigned char)index[3];
+        }
+        else
+        {
+            __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(q, q), _mm_setzero_si128());
+            int32_t packed = _mm_cvtsi128_si32(bytes);
+            memcpy(dst + x * 4, &packed, 4);
+        }
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void decode_row_avx2(const unsigned char *src, float *dst, int width, int srgb)
+{
+    // both tables are one array: alpha (and everything when not sRGB) indexes the second half
+    const __m256i offset = srgb ? _mm256_setr_epi32(0, 0, 0, 256, 0, 0, 0, 256) : _mm256_set1_epi32(256);
+    int x;
+
+    for (x = 0; x + 2 <= width; x += 2)
+    {
+        __m256i index = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + x * 4))), offset);
+        _mm256_storeu_ps(dst + x * 4, _mm256_i32gather_ps(&decode_table[0][0], index, 4));
+    }
+    if (x < width)
+        decode_row_scalar(src + x * 4, dst + x * 4, width - x, srgb);
+}
+
+__attribute__((target("avx2,fma")))
+static void horizontal_avx2(const struct kernel *kernel, const float *src, int src_width, float *dst, int dst_width)
+{
+    int begin, end, x, k;
+
+    interior_columns(kernel, src_width, dst_width, &begin, &end);
+    for (x = 0; x < begin; x++)
+        horizontal_pixel_scalar(kernel, src, src_width, x, dst + x * 4);
+    // two output pixels per iteration; their taps are two source pixels apart
+    for (; x + 2 <= end; x += 2)
+    {
+        const float *p = src + (2 * x + kernel->offset) * 4;
+        __m256 acc = _mm256_setzero_ps();
+        for (k = 0; k < kernel->taps; k++)
+        {
+            __m256 pair = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + k * 4)), _mm_loadu_ps(p + k * 4 + 8), 1);
+            acc = _mm256_fmadd_ps(_mm256_set1_ps(kernel->weights[k]), pair, acc);
+        }
+        _mm256_storeu_ps(dst + x * 4, acc);
+    }
+    for (; x < dst_width; x++)
+        horizontal_pixel_scalar(kernel, src, src_width, x, dst + x * 4);
+}
+
+__attribute__((target("avx2,fma")))
+static void vertical_avx2(const struct kernel *kernel, const float *const *rows, float *dst, int count)
+{
+    int i, k;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        __m256 acc = _mm256_mul_ps(_mm256_set1_ps(kernel->weights[0]), _mm256_loadu_ps(rows[0] + i));
+        for (k = 1; k < kernel->taps; k++)
+            acc = _mm256_fmadd_ps(_mm256_set1_ps(kernel->weights[k]), _mm256_loadu_ps(rows[k] + i), acc);
+        _mm256_storeu_ps(dst + i, acc);
+    }
+    for (; i < count; i += 4)
+    {
+        __m128 acc = _mm_mul_ps(_mm_set1_ps(kernel->weights[0]), _mm_loadu_ps(rows[0] + i));
+        for (k = 1; k < kernel->taps; k++)
+            acc = _mm_fmadd_ps(_mm_set1_ps(kernel->weights[k]), _mm_loadu_ps(rows[k] + i), acc);
+        _mm_storeu_ps(dst + i, acc);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void encode_avx2(const float *src, unsigned char *dst, int width, int srgb)
+{
+    const float top = srgb ? (float)(SRGB_ENCODE_SIZE - 1) : 255.0f;
+    const __m256 scale = _mm256_setr_ps(top, top, top, 255.0f, top, top, top, 255.0f);
+    const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+    int x;
+
+    for (x = 0; x + 2 <= width; x += 2)
+    {
+        __m256 v = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + x * 4), zero), one);
+        __m256i q = _mm256_cvtps_epi32(_mm256_mul_ps(v, scale));
+        // alpha lanes were scaled to 0..255 already, so they keep q as is
+        if (srgb)
+            q = _mm256_blend_epi32(_mm256_i32gather_epi32((const int *)encode_table, q, 4), q, 0x88);
+        __m128i words = _mm_packus_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+        _mm_storel_epi64((__m128i *)(dst + x * 4), _mm_packus_epi16(words, words));
+    }
+    if (x < width)
+        encode_scalar(src + x * 4, dst + x * 4, width - x, srgb);
+}
+
+#endif
+
+// ---------------------------------------------------------------------------------------------
+
+struct row_kernels
+{
+    void (*decode)(const unsigned char *src, float *dst, int width, int srgb);
+    void (*horizontal)(const struct kernel *kernel, const float *src, int src_width, float *dst, int dst_width);
+    void (*vertical)(const struct kernel *kernel, const float *const *rows, float *dst, int count);
+    void (*encode)(const float *src, unsigned char *dst, int width, int srgb);
+};
+
+static struct row_kernels select_kernels(enum mip_simd simd)
+{
+    struct row_kernels kernels = { decode_row_scalar, horizontal_scalar, vertical_scalar, encode_scalar };
+
+#ifdef MIP_X86
+    if (simd == MIP_SIMD_AVX2)
+    {
+        kernels.decode = decode_row_avx2;
+        kernels.horizontal = horizontal_avx2;
+        kernels.vertical = vertical_avx2;
+        kernels.encode = encode_avx2;
+    }
+    else if (simd == MIP_SIMD_SSE)
+    {
+        kernels.horizontal = horizontal_sse;
+        kernels.vertical = vertical_sse;
+        kernels.encode = encode_sse;
+    }
+#else
+    (void)simd;
+#endif
+    return kernels;
+}
+
+struct downsample_job
+{
+    const struct mip_level *src;
+    struct mip_level *dst;
+    const struct kernel *kernel;
+    struct row_kernels row;
+    int srgb;
+    int band_rows;
+    pthread_mutex_t lock;
+    int failed;                 // a band couldn't allocate its scratch rows; under lock
+};
+
+// produces output rows [y0, y1). horizontally filtered source rows are kept in a ring of one slot per
+// tap, so each source row is decoded and filtered once per band.
+static void downsample_rows(struct downsample_job *job, int y0, int y1)
+{
+    const struct mip_level *src = job->src;
+    struct mip_level *dst = job->dst;
+    const struct kernel *kernel = job->kernel;
+    size_t stride = (size_t)dst->width * 4;
+    float *decoded = (float *)malloc(sizeof(float) * ((size_t)src->width * 4 + stride * (kernel->taps + 1)));
+    float *ring, *out;
+    const float *rows[8];
+    int ring_row[8], y, k;
+
+    if (decoded == NULL)
+    {
+        pthread_mutex_lock(&job->lock);
+        job->failed = 1;
+        pthread_mutex_unlock(&job->lock);
+        return;
+    }
+    ring = decoded + (size_t)src->width * 4;
+    out = ring + stride * kernel->taps;
+    for (k = 0; k < kernel->taps; k++)
+        ring_row[k] = -1;
+
+    for (y = y0; y < y1; y++)
+    {
+        for (k = 0; k < kernel->taps; k++)
+        {
+            // the rows one output row needs are consecutive, so they never share a slot
+            int sy = clamp_int(2 * y + kernel->offset + k, 0, src->height - 1), slot = sy % kernel->taps;
+            float *row = ring + stride * slot;
+            if (ring_row[slot] != sy)
+            {
+                job->row.decode(src->pixels + (size_t)sy * src->width * 4, decoded, src->width, job->srgb);
+                job->row.horizontal(kernel, decoded, src->width, row, dst->width);
+                ring_row[slot] = sy;
+            }
+            rows[k] = row;
+        }
+        job->row.vertical(kernel, rows, out, (int)stride);
+        job->row.encode(out, dst->pixels + (size_t)y * stride, dst->width, job->srgb);
+    }
+    free(decoded);
+}
+
+static void downsample_band(void *arg, unsigned int band)
+{
+    struct downsample_job *job = (struct downsample_job *)arg;
+    int y0 = (int)band * job->band_rows, y1 = y0 + job->band_rows;
+
+    downsample_rows(job, y0, y1 < job->dst->height ? y1 : job->dst->height);
+}
+
+// returns 0 if out of memory, with dst only partly written
+static int downsample(const struct mip_level *src, struct mip_level *dst, enum mip_filter filter, int srgb,
+    struct thread_pool *pool)
+{
+    struct downsample_job job;
+
+    pthread_once(&tables_once, init_tables);
+    job.src = src;
+    job.dst = dst;
+    job.kernel = &kernels[filter];
+    job.row = select_kernels(mip_simd());
+    job.srgb = srgb;
+    job.band_rows = pool != NULL ? BAND_PIXELS / dst->width : dst->height;
+    if (job.band_rows < 4)
+        job.band_rows = 4;
+    pthread_mutex_init(&job.lock, NULL);
+    job.failed = 0;
+    thread_pool_parallel_for(pool, (unsigned int)((dst->height + job.band_rows - 1) / job.band_rows), downsample_band, &job);
+    pthread_mutex_destroy(&job.lock);
+    return !job.failed;
+}
+
+int mip_downsample(const struct mip_level *src, struct mip_level *dst, enum mip_filter filter, int srgb)
+{
+    return downsample(src, dst, filter, srgb, NULL);
+}
+
+unsigned int mip_generate(struct mip_level *levels, unsigned int max_levels, enum mip_filter filter, int srgb,
+    struct thread_pool *pool)
+{
+    unsigned int count = 1;
+
+    if (max_levels > MIP_MAX_LEVELS)
+        max_levels = MIP_MAX_LEVELS;
+    while (count < max_levels && (levels[count - 1].width > 1 || levels[count - 1].height > 1))
+    {
+        struct mip_level *src = &levels[count - 1], *dst = &levels[count];
+        dst->width = src->width > 1 ? src->width / 2 : 1;
+        dst->height = src->height > 1 ? src->height / 2 : 1;
+        dst->size = (size_t)dst->width * dst->height * 4;
+        dst->pixels = (unsigned char *)malloc(dst->size);
+        if (dst->pixels == NULL)
+            break;
+        if (!downsample(src, dst, filter, srgb, pool))
+        {
+            // the chain ends at the last complete level
+            free(dst->pixels);
+            dst->pixels = NULL;
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
+struct batch_job
+{
+    struct mip_chain *chains;
+    enum mip_filter filter;
+};
+
+static void generate_chain(void *arg, unsigned int index)
+{
+    struct batch_job *batch = (struct batch_job *)arg;
+    struct mip_chain *chain = &batch->chains[index];
+
+    chain->count = mip_generate(chain->levels, chain->max_levels, batch->filter, chain->srgb, NULL);
+}
+
+void mip_generate_batch(struct mip_chain *chains, unsigned int count, enum mip_filter filter, struct thread_pool *pool)
+{
+    struct batch_job batch;
+    unsigned int i;
+
+    batch.chains = chains;
+    batch.filter = filter;
+    if (pool == NULL || count > pool->thread_count)
+    {
+        thread_pool_parallel_for(pool, count, generate_chain, &batch);
+        return;
+    }
+    for (i = 0; i < count; i++)
+        chains[i].count = mip_generate(chains[i].levels, chains[i].max_levels, filter, chains[i].srgb, pool);
+}
+
+void mip_free(struct mip_level *levels, unsigned int count)
+{
+    unsigned int i;
+
+    for (i = 1; i < count; i++)
+    {
+        free(levels[i].pixels);
+        levels[i].pixels = NULL;
+    }
+}
@@ -0,0 +1,309 @@
+#include <obj.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct floats
+{
+    float *data;
+    size_t count;               // floats, not elements
+    size_t capacity;
+};
+
+// the v/vt/vn indices of a face corner; 0 where the corner has none
+struct corner
+{
+    uint32_t position;
+    uint32_t uv;
+    uint32_t normal;
+};
+
+struct builder
+{
+    struct floats positions;
+    struct floats uvs;
+    struct floats normals;
+    struct mesh_data *mesh;
+    uint32_t vertex_capacity;
+    uint32_t index_capacity;
+    struct corner *corners;     // per vertex, for deduplication and normal generation
+    uint32_t *slots;            // open addressing over corners: vertex index + 1, 0 when empty
+    uint32_t slot_count;        // power of two
+};
+
+static int push_floats(struct floats *array, const float *values, unsigned int count)
+{
+    if (array->count + count > array->capacity)
+    {
+        size_t capacity = array->capacity ? array->capacity * 2 : 3 * 1024;
+        float *data = (float *)realloc(array->data, sizeof(float) * capacity);
+        if (data == NULL)
+            return 0;
+        array->data = data;
+        array->capacity = capacity;
+    }
+    memcpy(array->data + array->count, values, sizeof(float) * count);
+    array->count += count;
+    return 1;
+}
+
+// reads up to count numbers from the rest of a line; missing ones stay zero
+static const char *parse_floats(const char *p, float *values, unsigned int count)
+{
+    unsigned int i;
+
+    for (i = 0; i < count; i++)
+    {
+        char *end;
+        values[i] = 0.0f;
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (*p == '\n' || *p == '\r' || *p == '\0')
+            continue;
+        values[i] = strtof(p, &end);
+        if (end == p)
+            return NULL;
+        p = end;
+    }
+    return p;
+}
+
+static uint32_t hash_corner(const struct corner *corner)
+{
+    return (corner->position * 73856093u) ^ (corner->uv * 19349663u) ^ (corner->normal * 83492791u);
+}
+
+static int grow_slots(struct builder *builder)
+{
+    uint32_t count = builder->slot_count ? builder->slot_count * 2 : 4096, i;
+    uint32_t *slots = (uint32_t *)calloc(count, sizeof(uint32_t));
+
+    if (slots == NULL)
+        return 0;
+    for (i = 0; i < builder->mesh->vertex_count; i++)
+    {
+        uint32_t slot = hash_corner(&builder->corners[i]) & (count - 1);
+        while (slots[slot] != 0)
+            slot = (slot + 1) & (count - 1);
+        slots[slot] = i + 1;
+    }
+    free(builder->slots);
+    builder->slots = slots;
+    builder->slot_count = count;
+    return 1;
+}
+
+// the vertex for a corner, made on first sight. returns -1 if out of memory.
+static int64_t corner_vertex(struct builder *builder, const struct corner *corner)
+{
+    struct mesh_data *mesh = builder->mesh;
+    struct mesh_vertex *vertex;
+    uint32_t slot;
+
+    // keep the table at most half full
+    if ((mesh->vertex_count + 1) * 2 > builder->slot_count && !grow_slots(builder))
+        return -1;
+    for (slot = hash_corner(corner) & (builder->slot_count - 1); builder->slots[slot] != 0;
+         slot = (slot + 1) & (builder->slot_count - 1))
+    {
+        if (memcmp(&builder->corners[builder->slots[slot] - 1], corner, sizeof(*corner)) == 0)
+            return builder->slots[slot] - 1;
+    }
+
+    if (mesh->vertex_count == builder->vertex_capacity)
+    {
+        uint32_t capacity = builder->vertex_capacity ? builder->vertex_capacity * 2 : 1024;
+        struct mesh_vertex *vertices = (struct mesh_vertex *)realloc(mesh->vertices, sizeof(*vertices) * capacity);
+        struct corner *corners;
+        if (vertices == NULL)
+            return -1;
+        mesh->vertices = vertices;
+        corners = (struct corner *)realloc(builder->corners, sizeof(*corners) * capacity);
+        if (corners == NULL)
+            return -1;
+        builder->corners = corners;
+        builder->vertex_capacity = capacity;
+    }
+    vertex = &mesh->vertices[mesh->vertex_count];
+    memset(vertex, 0, sizeof(*vertex));
+    memcpy(vertex->position, &builder->positions.data[(corner->position - 1) * 3], sizeof(vertex->position));
+    if (corner->uv)
+        memcpy(vertex->uv, &builder->uvs.data[(corner->uv - 1) * 2], sizeof(vertex->uv));
+    if (corner->normal)
+        memcpy(vertex->normal, &builder->normals.data[(corner->normal - 1) * 3], sizeof(vertex->normal));
+    builder->corners[mesh->vertex_count] = *corner;
+    builder->slots[slot] = mesh->vertex_count + 1;
+    return mesh->vertex_count++;
+}
+
+static int push_index(struct builder *builder, uint32_t index)
+{
+    struct mesh_data *mesh = builder->mesh;
+
+    if (mesh->index_count == builder->index_capacity)
+    {
+        uint32_t capacity = builder->index_capacity ? builder->index_capacity * 2 : 3 * 1024;
+        uint32_t *indices = (uint32_t *)realloc(mesh->indices, sizeof(uint32_t) * capacity);
+        if (indices == NULL)
+            return 0;
+        mesh->indices = indices;
+        builder->index_capacity = capacity;
+    }
+    mesh->indices[mesh->index_count++] = index;
+    return 1;
+}
+
+// one index of a corner: 1-based, negative counts back from the last element so far. 0 if absent.
+static const char *parse_index(const char *p, size_t element_count, uint32_t *index)
+{
+    char *end;
+    long value;
+
+    *index = 0;
+    if (*p < '0' && *p != '-')
+        return p;
+    if (*p > '9')
+        return NULL;
+    value = strtol(p, &end, 10);
+    if (end == p)
+        return p;
+    if (value < 0)
+        value += (long)element_count + 1;
+    if (value <= 0 || (size_t)value > element_count)
+        return NULL;
+    *index = (uint32_t)value;
+    return end;
+}
+
+static const char *parse_corner(const struct builder *builder, const char *p, struct corner *corner)
+{
+    if ((p = parse_index(p, builder->positions.count / 3, &corner->position)) == NULL || corner->position == 0)
+        return NULL;
+    corner->uv = corner->normal = 0;
+    if (*p == '/')
+    {
+        if ((p = parse_index(p + 1, builder->uvs.count / 2, &corner->uv)) == NULL)
+            return NULL;
+        if (*p == '/' && (p = parse_index(p + 1, builder->normals.count / 3, &corner->normal)) == NULL)
+            return NULL;
+    }
+    return p;
+}
+
+static int parse_face(struct builder *builder, const char *p)
+{
+    int64_t first = -1, previous = -1;
+    unsigned int count = 0;
+
+    for (;;)
+    {
+        struct corner corner;
+        int64_t vertex;
+
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (*p == '\n' || *p == '\r' || *p == '\0')
+            break;
+        if ((p = parse_corner(builder, p, &corner)) == NULL || (vertex = corner_vertex(builder, &corner)) < 0)
+            return 0;
+        // fan around the first corner
+        if (count >= 2 && (!push_index(builder, (uint32_t)first) || !push_index(builder, (uint32_t)previous) ||
+            !push_index(builder, (uint32_t)vertex)))
+            return 0;
+        if (count == 0)
+            first = vertex;
+        previous = vertex;
+        count++;
+    }
+    return count >= 3;
+}
+
+// area weighted, summed per position so faces meeting at a uv seam still agree
+static int generate_normals(struct builder *builder)
+{
+    struct mesh_data *mesh = builder->mesh;
+    size_t position_count = builder->positions.count / 3;
+    float *sums = NULL;
+    uint32_t i, j;
+
+    for (i = 0; i < mesh->vertex_count && builder->corners[i].normal != 0; i++)
+        ;
+    if (i == mesh->vertex_count)
+        return 1;
+    sums = (float *)calloc(position_count * 3, sizeof(float));
+    if (sums == NULL)
+        return 0;
+    for (i = 0; i < mesh->index_count; i += 3)
+    {
+        const float *a = mesh->vertices[mesh->indices[i]].position;
+        const float *b = mesh->vertices[mesh->indices[i + 1]].position;
+        const float *c = mesh->vertices[mesh->indices[i + 2]].position;
+        float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+        float e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+        float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+        for (j = 0; j < 3; j++)
+        {
+            float *sum = &sums[(builder->corners[mesh->indices[i + j]].position - 1) * 3];
+            sum[0] += n[0];
+            sum[1] += n[1];
+            sum[2] += n[2];
+        }
+    }
+    for (i = 0; i < mesh->vertex_count; i++)
+    {
+        const float *sum = &sums[(builder->corners[i].position - 1) * 3];
+        float length = sqrtf(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]);
+        if (builder->corners[i].normal != 0)
+            continue;
+        if (length > 0.0f)
+        {
+            mesh->vertices[i].normal[0] = sum[0] / length;
+            mesh->vertices[i].normal[1] = sum[1] / length;
+            mesh->vertices[i].normal[2] = sum[2] / length;
+        }
+        else
+            mesh->vertices[i].normal[1] = 1.0f;
+    }
+    free(sums);
+    return 1;
+}
+
+int obj_parse(const char *text, struct mesh_data *mesh)
+{
+    struct builder builder;
+    const char *p = text;
+    int ok = 1;
+
+    memset(mesh, 0, sizeof(*mesh));
+    memset(&builder, 0, sizeof(builder));
+    builder.mesh = mesh;
+    while (ok && *p)
+    {
+        const char *next = strchr(p, '\n');
+        float values[3];
+
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (p[0] == 'v' && (p[1] == ' ' || p[1] == '\t'))
+            ok = parse_floats(p + 2, values, 3) != NULL && push_floats(&builder.positions, values, 3);
+        else if (p[0] == 'v' && p[1] == 't' && (p[2] == ' ' || p[2] == '\t'))
+            ok = parse_floats(p + 3, values, 2) != NULL && push_floats(&builder.uvs, values, 2);
+        else if (p[0] == 'v' && p[1] == 'n' && (p[2] == ' ' || p[2] == '\t'))
+            ok = parse_floats(p + 3, values, 3) != NULL && push_floats(&builder.normals, values, 3);
+        else if (p[0] == 'f' && (p[1] == ' ' || p[1] == '\t'))
+            ok = parse_face(&builder, p + 2);
+        p = next ? next + 1 : p + strlen(p);
+    }
+    ok = ok && generate_normals(&builder);
+    if (ok)
+        mesh_compute_bounds(mesh);
+    else
+        mesh_free(mesh);
+    free(builder.positions.data);
+    free(builder.uvs.data);
+    free(builder.normals.data);
+    free(builder.corners);
+    free(builder.slots);
+    return ok;
+}
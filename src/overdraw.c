@@ -0,0 +1,72 @@
+#include <glad/glad.h>
+#include <overdraw.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+int overdraw_counter_init(struct overdraw_counter *counter, int width, int height)
+{
+    memset(counter, 0, sizeof(*counter));
+    return render_target_init(&counter->target, width, height, GL_R32F);
+}
+
+void overdraw_counter_destroy(struct overdraw_counter *counter)
+{
+    render_target_destroy(&counter->target);
+    free(counter->counts);
+    memset(counter, 0, sizeof(*counter));
+}
+
+int overdraw_counter_measure(struct overdraw_counter *counter, struct render_queue *queue,
+    unsigned int count_program, int width, int height)
+{
+    GLint depth_func;
+    size_t pixels, i;
+
+    if (count_program == 0 || !render_target_resize(&counter->target, width, height))
+        return 0;
+    pixels = (size_t)counter->target.width * counter->target.height;
+    if (pixels > counter->count_capacity)
+    {
+        float *counts = (float *)realloc(counter->counts, sizeof(*counts) * pixels);
+        if (counts == NULL)
+            return 0;
+        counter->counts = counts;
+        counter->count_capacity = pixels;
+    }
+
+    render_target_bind(&counter->target);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glGetIntegerv(GL_DEPTH_FUNC, &depth_func);
+    if (queue->prepass_program)
+    {
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        render_queue_replay(queue, queue->prepass_program);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glDepthFunc(GL_EQUAL);
+        glDepthMask(GL_FALSE);
+    }
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    render_queue_replay(queue, count_program);
+    glDisable(GL_BLEND);
+    glDepthMask(GL_TRUE);
+    glDepthFunc((GLenum)depth_func);
+
+    glReadPixels(0, 0, counter->target.width, counter->target.height, GL_RED, GL_FLOAT, counter->counts);
+    counter->fragments = 0.0;
+    counter->covered_pixels = 0;
+    counter->pixels = (unsigned int)pixels;
+    for (i = 0; i < pixels; i++)
+    {
+        counter->fragments += counter->counts[i];
+        counter->covered_pixels += counter->counts[i] > 0.0f;
+    }
+    return 1;
+}
+
+float overdraw_counter_ratio(const struct overdraw_counter *counter)
+{
+    return counter->covered_pixels ? (float)(counter->fragments / counter->covered_pixels) : 0.0f;
+}
@@ -0,0 +1,425 @@
+#include <hash.h>
+#include <lz4_block.h>
+#include <pack.h>
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <stdio.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static void unmap(const unsigned char *data, size_t size)
+{
+#ifdef _WIN32
+    (void)size;
+    free((void *)data);
+#else
+    munmap((void *)data, size);
+#endif
+}
+
+// the whole file, mapped where there is mmap and read in one go elsewhere
+static const unsigned char *map(const char *path, size_t *size)
+{
+#ifdef _WIN32
+    FILE *file = fopen(path, "rb");
+    unsigned char *data = NULL;
+    long length;
+
+    if (file == NULL)
+        return NULL;
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) > 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        data = (unsigned char *)malloc((size_t)length);
+        if (data != NULL && fread(data, 1, (size_t)length, file) != (size_t)length)
+        {
+            free(data);
+            data = NULL;
+        }
+        *size = (size_t)length;
+    }
+    fclose(file);
+    return data;
+#else
+    struct stat st;
+    void *data;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        return NULL;
+    }
+    data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return NULL;
+    *size = (size_t)st.st_size;
+    return (const unsigned char *)data;
+#endif
+}
+
+static int valid(const struct pack *pack, const struct pack_header *header)
+{
+    uint64_t directory_size = (uint64_t)header->entry_count * sizeof(struct pack_entry);
+    uint32_t i;
+
+    if (header->magic != PACK_MAGIC || header->version != PACK_VERSION || header->directory_offset % 8 != 0 ||
+        header->directory_offset > pack->size || directory_size > pack->size - header->directory_offset ||
+        header->names_size > pack->size - header->directory_offset - directory_size ||
+        (header->names_size > 0 && pack->names[header->names_size - 1] != '\0'))
+        return 0;
+    for (i = 0; i < header->entry_count; i++)
+    {
+        const struct pack_entry *entry = &pack->entries[i];
+        if (entry->offset > pack->size || entry->stored_size > pack->size - entry->offset ||
+            entry->name >= header->names_size || entry->compression > PACK_COMPRESSION_LZ4 ||
+            (entry->compression == PACK_COMPRESSION_NONE && entry->stored_size != entry->size) ||
+            (i > 0 && entry->hash < pack->entries[i - 1].hash))
+            return 0;
+    }
+    return 1;
+}
+
+int pack_open(struct pack *pack, const char *path)
+{
+    struct pack_header header;
+
+    memset(pack, 0, sizeof(*pack));
+    pack->data = map(path, &pack->size);
+    if (pack->data == NULL)
+        return 0;
+    if (pack->size < sizeof(header))
+    {
+        pack_close(pack);
+        return 0;
+    }
+    memcpy(&header, pack->data, sizeof(header));
+    if (header.directory_offset > pack->size)
+    {
+        pack_close(pack);
+        return 0;
+    }
+    pack->entries = (const struct pack_entry *)(pack->data + header.directory_offset);
+    pack->entry_count = header.entry_count;
+    pack->names = (const char *)(pack->entries + header.entry_count);
+    pack->names_size = header.names_size;
+    // bounds are checked before anything in the directory is looked at
+    if (!valid(pack, &header))
+    {
+        pack_close(pack);
+        return 0;
+    }
+    return 1;
+}
+
+void pack_close(struct pack *pack)
+{
+    if (pack->data != NULL)
+        unmap(pack->data, pack->size);
+    memset(pack, 0, sizeof(*pack));
+}
+
+const struct pack_entry *pack_find(const struct pack *pack, const char *name)
+{
+    uint64_t hash = hash_string(HASH_SEED, name);
+    uint32_t low = 0, high = pack->entry_count;
+
+    // first entry with this hash, then past any colliding names
+    while (low < high)
+    {
+        uint32_t middle = low + (high - low) / 2;
+        if (pack->entries[middle].hash < hash)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    for (; low < pack->entry_count && pack->entries[low].hash == hash; low++)
+    {
+        if (strcmp(pack->names + pack->entries[low].name, name) == 0)
+            return &pack->entries[low];
+    }
+    return NULL;
+}
+
+const char *pack_entry_name(const struct pack *pack, const struct pack_entry *entry)
+{
+    return pack->names + entry->name;
+}
+
+const unsigned char *pack_entry_data(const struct pack *pack, const struct pack_entry *entry)
+{
+    return pack->data + entry->offset;
+}
+
+unsigned char *pack_read(const struct pack *pack, const struct pack_entry *entry, size_t *size)
+{
+    const unsigned char *stored = pack_entry_data(pack, entry);
+    unsigned char *data;
+
+    if (entry->size > (uint64_t)((size_t)-1) - 1)
+        return NULL;
+    data = (unsigned char *)malloc((size_t)entry->size + 1);
+    if (data == NULL)
+        return NULL;
+    if (entry->compression == PACK_COMPRESSION_LZ4)
+    {
+        if (!lz4_block_decompress(stored, (size_t)entry->stored_size, data, (size_t)entry->size))
+        {
+            free(data);
+            return NULL;
+        }
+    }
+    else
+        memcpy(data, stored, (size_t)entry->size);
+    data[entry->size] = '\0';
+    if (size != NULL)
+        *size = (size_t)entry->size;
+    return data;
+}
+
+// a read's place in file order, with the offset it is sorted by
+struct read_key
+{
+    uint64_t offset;
+    unsigned int index;
+};
+
+struct batch
+{
+    const struct pack *pack;
+    struct pack_read *reads;
+    const struct read_key *order;
+};
+
+static int compare_offsets(const void *a, const void *b)
+{
+    const struct read_key *ka = (const struct read_key *)a, *kb = (const struct read_key *)b;
+
+    if (ka->offset != kb->offset)
+        return ka->offset < kb->offset ? -1 : 1;
+    return ka->index < kb->index ? -1 : ka->index > kb->index;
+}
+
+static void read_one(void *arg, unsigned int index)
+{
+    struct batch *batch = (struct batch *)arg;
+    struct pack_read *read = &batch->reads[batch->order[index].index];
+
+    read->data = pack_read(batch->pack, read->entry, &read->size);
+}
+
+void pack_read_batch(const struct pack *pack, struct pack_read *reads, unsigned int count, struct thread_pool *pool)
+{
+    struct read_key *order = (struct read_key *)malloc(sizeof(struct read_key) * (count ? count : 1));
+    struct batch batch;
+    unsigned int i;
+
+    if (order == NULL)
+    {
+        for (i = 0; i < count; i++)
+            reads[i].data = NULL;
+        return;
+    }
+    for (i = 0; i < count; i++)
+    {
+        order[i].offset = reads[i].entry->offset;
+        order[i].index = i;
+    }
+    qsort(order, count, sizeof(struct read_key), compare_offsets);
+
+#ifndef _WIN32
+    {
+        // queue the whole batch with the kernel up front, in file order
+        uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+        for (i = 0; i < count; i++)
+        {
+            const struct pack_entry *entry = reads[order[i].index].entry;
+            uintptr_t begin = (uintptr_t)(pack->data + entry->offset) & ~(page - 1);
+            uintptr_t end = (uintptr_t)(pack->data + entry->offset + entry->stored_size);
+            if (end > begin)
+                madvise((void *)begin, end - begin, MADV_WILLNEED);
+        }
+    }
+#endif
+
+    // workers take indices in ascending order, so the faults that do happen still move forward
+    batch.pack = pack;
+    batch.reads = reads;
+    batch.order = order;
+    thread_pool_parallel_for(pool, count, read_one, &batch);
+    free(order);
+}
+
+int pack_writer_open(struct pack_writer *writer, const char *path)
+{
+    static const unsigned char zero[PACK_ALIGNMENT];
+
+    memset(writer, 0, sizeof(*writer));
+    writer->file = fopen(path, "wb");
+    if (writer->file == NULL)
+        return 0;
+    // the header is filled in on close
+    if (fwrite(zero, 1, PACK_ALIGNMENT, writer->file) != PACK_ALIGNMENT)
+        writer->failed = 1;
+    writer->position = PACK_ALIGNMENT;
+    return 1;
+}
+
+static int pad_to(struct pack_writer *writer, uint64_t alignment)
+{
+    static const unsigned char zero[PACK_ALIGNMENT];
+    size_t padding = (size_t)((alignment - writer->position % alignment) % alignment);
+
+    if (padding > 0 && fwrite(zero, 1, padding, writer->file) != padding)
+        return 0;
+    writer->position += padding;
+    return 1;
+}
+
+int pack_writer_add(struct pack_writer *writer, const char *name, const void *data, size_t size,
+    enum pack_compression compression)
+{
+    struct pack_entry *entry;
+    unsigned char *compressed = NULL;
+    const void *stored = data;
+    size_t stored_size = size, name_length = strlen(name) + 1;
+
+    if (writer->failed)
+        return 0;
+    if (writer->count == writer->capacity)
+    {
+        unsigned int capacity = writer->capacity ? writer->capacity * 2 : 64;
+        struct pack_entry *entries = (struct pack_entry *)realloc(writer->entries, sizeof(*entries) * capacity);
+        if (entries == NULL)
+            return 0;
+        writer->entries = entries;
+        writer->capacity = capacity;
+    }
+    if (writer->names_size + name_length > writer->names_capacity)
+    {
+        size_t capacity = writer->names_capacity ? writer->names_capacity * 2 : 4096;
+        char *names;
+        while (capacity < writer->names_size + name_length)
+            capacity *= 2;
+        names = (char *)realloc(writer->names, capacity);
+        if (names == NULL)
+            return 0;
+        writer->names = names;
+        writer->names_capacity = capacity;
+    }
+
+    if (compression == PACK_COMPRESSION_LZ4 && size > 0)
+    {
+        size_t bound = lz4_block_bound(size);
+        compressed = (unsigned char *)malloc(bound);
+        if (compressed != NULL)
+        {
+            size_t packed = lz4_block_compress((const unsigned char *)data, size, compressed, bound);
+            // not worth a decompression pass for less than an eighth
+            if (packed > 0 && packed < size - size / 8)
+            {
+                stored = compressed;
+                stored_size = packed;
+            }
+            else
+                compression = PACK_COMPRESSION_NONE;
+        }
+        else
+            compression = PACK_COMPRESSION_NONE;
+    }
+    else
+        compression = PACK_COMPRESSION_NONE;
+
+    if (!pad_to(writer, PACK_ALIGNMENT) || (stored_size > 0 && fwrite(stored, 1, stored_size, writer->file) != stored_size))
+    {
+        writer->failed = 1;
+        free(compressed);
+        return 0;
+    }
+    entry = &writer->entries[writer->count++];
+    entry->hash = hash_string(HASH_SEED, name);
+    entry->offset = writer->position;
+    entry->stored_size = stored_size;
+    entry->size = size;
+    entry->compression = (uint32_t)compression;
+    entry->name = (uint32_t)writer->names_size;
+    memcpy(writer->names + writer->names_size, name, name_length);
+    writer->names_size += name_length;
+    writer->position += stored_size;
+    free(compressed);
+    return 1;
+}
+
+// an entry with its name, which the directory is sorted by after the hash
+struct entry_key
+{
+    struct pack_entry entry;
+    const char *name;
+};
+
+static int compare_entries(const void *a, const void *b)
+{
+    const struct entry_key *ka = (const struct entry_key *)a, *kb = (const struct entry_key *)b;
+
+    if (ka->entry.hash != kb->entry.hash)
+        return ka->entry.hash < kb->entry.hash ? -1 : 1;
+    return strcmp(ka->name, kb->name);
+}
+
+int pack_writer_close(struct pack_writer *writer)
+{
+    struct pack_header header;
+    struct entry_key *keys;
+    unsigned int i;
+    int ok = !writer->failed;
+
+    if (writer->file == NULL)
+        return 0;
+    keys = (struct entry_key *)malloc(sizeof(struct entry_key) * (writer->count ? writer->count : 1));
+    ok = ok && keys != NULL;
+    for (i = 0; ok && i < writer->count; i++)
+    {
+        keys[i].entry = writer->entries[i];
+        keys[i].name = writer->names + writer->entries[i].name;
+    }
+    if (ok && writer->count > 0)
+        qsort(keys, writer->count, sizeof(struct entry_key), compare_entries);
+    for (i = 0; ok && i < writer->count; i++)
+    {
+        if (i > 0 && compare_entries(&keys[i - 1], &keys[i]) == 0)
+        {
+            fprintf(stderr, "pack: %s added twice\n", keys[i].name);
+            ok = 0;
+        }
+        writer->entries[i] = keys[i].entry;
+    }
+    free(keys);
+
+    memset(&header, 0, sizeof(header));
+    header.magic = PACK_MAGIC;
+    header.version = PACK_VERSION;
+    header.entry_count = writer->count;
+    header.names_size = (uint32_t)writer->names_size;
+    ok = ok && pad_to(writer, 8);
+    header.directory_offset = writer->position;
+    ok = ok && (writer->count == 0 ||
+        fwrite(writer->entries, sizeof(struct pack_entry), writer->count, writer->file) == writer->count);
+    ok = ok && (writer->names_size == 0 ||
+        fwrite(writer->names, 1, writer->names_size, writer->file) == writer->names_size);
+    ok = ok && fseek(writer->file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, writer->file) == 1;
+    if (fclose(writer->file) != 0)
+        ok = 0;
+
+    free(writer->entries);
+    free(writer->names);
+    memset(writer, 0, sizeof(*writer));
+    return ok;
+}
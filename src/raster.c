@@ -0,0 +1,1350 @@
+#include <math3d.h>
+#include <raster.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RASTER_X86 1
+#include <immintrin.h>
+#endif
+
+#define TILE_PIXELS (RASTER_TILE_SIZE * RASTER_TILE_SIZE)
+#define SUBPIXELS (1 << RASTER_SUBPIXEL_BITS)
+// lit shader: light everything gets, the rest is scaled by the directional light
+#define LIT_AMBIENT 0.1f
+// polygon a triangle can become after clipping against the near plane and four guard band planes
+#define CLIP_MAX_VERTICES 8
+// outcode bits: the sides of the view volume (near plane at bit 4), then of the guard band
+#define OUTSIDE_VIEW 0x1fu
+#define NEEDS_CLIP 0x1f0u
+// beyond any window coordinate inside the guard band, in subpixels
+#define FIXED_LIMIT 1073741824.0f
+// every sample of a multisampled pixel, and the furthest any of them is from its center along
+// either axis, in subpixels
+#define FULL_COVERAGE ((1 << RASTER_MSAA_SAMPLES) - 1)
+#define SAMPLE_REACH 6
+
+// the 4x rotated grid, in subpixels from the pixel center
+static const int sample_offsets[RASTER_MSAA_SAMPLES][2] = { { -2, -6 }, { 6, -2 }, { -6, 2 }, { 2, 6 } };
+
+#if defined(__GNUC__)
+#define FORCE_INLINE inline __attribute__((always_inline))
+#define NO_INLINE __attribute__((noinline))
+#else
+#define FORCE_INLINE inline
+#define NO_INLINE
+#endif
+
+// what the vertex stage needs of a draw
+struct vertex_constants
+{
+    float matrix[16];           // object to clip space
+    const float *model;         // normals are transformed by its upper 3x3
+    float light[3];
+    float width;                // of the target
+    float height;
+    float guard_x;              // guard band, in normalized device coordinates
+    float guard_y;
+    int sample_reach;           // SAMPLE_REACH when multisampled, else 0
+    int zero_to_one;
+    int lit;
+};
+
+// a clip space vertex while a triangle is being clipped
+struct clip_vertex
+{
+    float position[4];
+    float intensity;
+};
+
+struct draw_job
+{
+    struct raster_target *target;
+    const struct vertex_constants *constants;
+    const struct raster_vertex_array *array;
+    const float *rgba;
+    const struct raster_pipeline *pipeline;
+    uint32_t triangle_count;
+    unsigned int range_count;
+    int simd;
+};
+
+static int cpu_has_avx2(void)
+{
+#ifdef RASTER_X86
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return 0;
+#endif
+}
+
+int raster_target_init(struct raster_target *target, int width, int height, int samples, int zero_to_one,
+    struct thread_pool *pool)
+{
+    size_t pixels;
+
+    memset(target, 0, sizeof(*target));
+    if (width < 1 || height < 1 || width > RASTER_GUARD_BAND || height > RASTER_GUARD_BAND)
+        return 0;
+    if (samples != 1 && samples != RASTER_MSAA_SAMPLES)
+        return 0;
+    target->width = width;
+    target->height = height;
+    target->tiles_x = (width + RASTER_TILE_SIZE - 1) / RASTER_TILE_SIZE;
+    target->tiles_y = (height + RASTER_TILE_SIZE - 1) / RASTER_TILE_SIZE;
+    target->bins_x = (width + RASTER_BIN_SIZE - 1) / RASTER_BIN_SIZE;
+    target->bins_y = (height + RASTER_BIN_SIZE - 1) / RASTER_BIN_SIZE;
+    target->samples = samples;
+    target->zero_to_one = zero_to_one;
+    target->pool = pool;
+    target->simd = cpu_has_avx2();
+    target->hierarchical_z = 1;
+    target->specialized = 1;
+    target->light[1] = 1.0f;
+    pixels = (size_t)target->tiles_x * target->tiles_y * TILE_PIXELS;
+    target->color = (uint32_t *)malloc(sizeof(*target->color) * pixels);
+    target->depth = (float *)malloc(sizeof(*target->depth) * pixels);
+    target->tile_near = (float *)malloc(sizeof(float) * target->tiles_x * target->tiles_y);
+    target->tile_far = (float *)malloc(sizeof(float) * target->tiles_x * target->tiles_y);
+    target->bins = (struct raster_bin *)calloc((size_t)target->bins_x * target->bins_y, sizeof(*target->bins));
+    target->range_count = pool != NULL ? pool->thread_count + 1 : 1;
+    target->ranges = (struct raster_vertex_range *)calloc(target->range_count, sizeof(*target->ranges));
+    if (target->color == NULL || target->depth == NULL || target->tile_near == NULL || target->tile_far == NULL ||
+        target->bins == NULL || target->ranges == NULL)
+    {
+        raster_target_destroy(target);
+        return 0;
+    }
+    if (samples > 1)
+    {
+        // sample storage is only touched for edge pixels, so most of it is never paged in
+        target->tile_edges = (uint64_t *)calloc((size_t)target->tiles_x * target->tiles_y, sizeof(uint64_t));
+        target->sample_color = (uint32_t *)malloc(sizeof(*target->sample_color) * pixels * samples);
+        target->sample_depth = (float *)malloc(sizeof(*target->sample_depth) * pixels * samples);
+        if (target->tile_edges == NULL || target->sample_color == NULL || target->sample_depth == NULL)
+        {
+            raster_target_destroy(target);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void free_vertices(struct raster_vertices *vertices)
+{
+    int i;
+
+    for (i = 0; i < 4; i++)
+        free(vertices->clip[i]);
+    free(vertices->intensity);
+    free(vertices->window_x);
+    free(vertices->window_y);
+    free(vertices->window_z);
+    free(vertices->inv_w);
+    free(vertices->intensity_w);
+    free(vertices->outcode);
+    memset(vertices, 0, sizeof(*vertices));
+}
+
+void raster_target_destroy(struct raster_target *target)
+{
+    unsigned int i;
+
+    for (i = 0; target->bins != NULL && i < (unsigned int)(target->bins_x * target->bins_y); i++)
+        free(target->bins[i].triangles);
+    for (i = 0; target->ranges != NULL && i < target->range_count; i++)
+    {
+        free(target->ranges[i].cache_stamp);
+        free(target->ranges[i].cache_slot);
+        free(target->ranges[i].sources);
+        free(target->ranges[i].triangles);
+        free_vertices(&target->ranges[i].vertices);
+    }
+    free(target->ranges);
+    free(target->bins);
+    free(target->color);
+    free(target->depth);
+    free(target->tile_near);
+    free(target->tile_far);
+    free(target->tile_edges);
+    free(target->sample_color);
+    free(target->sample_depth);
+    free(target->triangles);
+    memset(target, 0, sizeof(*target));
+}
+
+static uint32_t pack_color(const float *color)
+{
+    uint32_t packed = 0;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        float c = color[i] < 0.0f ? 0.0f : color[i] > 1.0f ? 1.0f : color[i];
+        packed |= (uint32_t)(c * 255.0f + 0.5f) << (i * 8);
+    }
+    return packed;
+}
+
+void raster_clear(struct raster_target *target, const float *color)
+{
+    size_t pixels = (size_t)target->tiles_x * target->tiles_y * TILE_PIXELS, i;
+    uint32_t packed = pack_color(color);
+    int bin;
+
+    for (i = 0; i < pixels; i++)
+    {
+        target->color[i] = packed;
+        target->depth[i] = 0.0f;
+    }
+    for (i = 0; i < (size_t)target->tiles_x * target->tiles_y; i++)
+    {
+        target->tile_near[i] = 0.0f;
+        target->tile_far[i] = 0.0f;
+    }
+    if (target->tile_edges != NULL)
+        memset(target->tile_edges, 0, sizeof(uint64_t) * target->tiles_x * target->tiles_y);
+    for (bin = 0; bin < target->bins_x * target->bins_y; bin++)
+        target->bins[bin].count = 0;
+    target->triangle_count = 0;
+    memset(&target->stats, 0, sizeof(target->stats));
+}
+
+void raster_vertex_array_init(struct raster_vertex_array *array, uint32_t vertex_count, const uint32_t *indices,
+    uint32_t count)
+{
+    memset(array, 0, sizeof(*array));
+    array->vertex_count = vertex_count;
+    array->indices = indices;
+    array->index_count = count;
+}
+
+void raster_vertex_attrib_pointer(struct raster_vertex_array *array, unsigned int location, int size, size_t stride,
+    const void *buffer, size_t offset)
+{
+    if (location >= RASTER_MAX_ATTRIBUTES)
+        return;
+    array->attributes[location].buffer = buffer;
+    array->attributes[location].size = size < 1 ? 1 : size > 4 ? 4 : size;
+    array->attributes[location].stride = stride;
+    array->attributes[location].offset = offset;
+}
+
+void raster_vertex_array_from_mesh(struct raster_vertex_array *array, const struct mesh_data *mesh)
+{
+    raster_vertex_array_init(array, mesh->vertex_count, mesh->indices, mesh->index_count);
+    raster_vertex_attrib_pointer(array, RASTER_POSITION_LOCATION, 3, sizeof(struct mesh_vertex), mesh->vertices,
+        offsetof(struct mesh_vertex, position));
+    raster_vertex_attrib_pointer(array, RASTER_NORMAL_LOCATION, 3, sizeof(struct mesh_vertex), mesh->vertices,
+        offsetof(struct mesh_vertex, normal));
+}
+
+static int bin_add(struct raster_bin *bin, uint32_t triangle)
+{
+    if (bin->count == bin->capacity)
+    {
+        unsigned int capacity = bin->capacity ? bin->capacity * 2 : 64;
+        uint32_t *triangles = (uint32_t *)realloc(bin->triangles, sizeof(*triangles) * capacity);
+        if (triangles == NULL)
+            return 0;
+        bin->triangles = triangles;
+        bin->capacity = capacity;
+    }
+    bin->triangles[bin->count++] = triangle;
+    return 1;
+}
+
+// reads one vertex of an attribute into out, filling in what it lacks like GL does
+static void fetch_attribute(const struct raster_attribute *attribute, uint32_t vertex, float *out)
+{
+    size_t stride = attribute->stride ? attribute->stride : sizeof(float) * attribute->size;
+
+    out[0] = 0.0f;
+    out[1] = 0.0f;
+    out[2] = 0.0f;
+    out[3] = 1.0f;
+    if (attribute->buffer != NULL)
+        memcpy(out, (const char *)attribute->buffer + attribute->offset + stride * vertex, sizeof(float) * attribute->size);
+}
+
+// the scalar vertex stage. the AVX2 one below does exactly these operations in this order, so the
+// two agree to the bit; keep them in step.
+static void project_vertex(const struct vertex_constants *k, struct raster_vertices *out, uint32_t slot)
+{
+    float inv_w = 1.0f / out->clip[3][slot];
+    float x = out->clip[0][slot] * inv_w, y = out->clip[1][slot] * inv_w, z = out->clip[2][slot] * inv_w;
+
+    x = floorf((x * 0.5f + 0.5f) * k->width * SUBPIXELS + 0.5f);
+    y = floorf((y * 0.5f + 0.5f) * k->height * SUBPIXELS + 0.5f);
+    // vertices outside the guard band are never set up from these, but must not overflow either
+    out->window_x[slot] = x > -FIXED_LIMIT && x < FIXED_LIMIT ? (int32_t)x : 0;
+    out->window_y[slot] = y > -FIXED_LIMIT && y < FIXED_LIMIT ? (int32_t)y : 0;
+    if (!k->zero_to_one)
+        z = z * 0.5f + 0.5f;
+    z = z < 0.0f ? 0.0f : z;
+    z = z > 1.0f ? 1.0f : z;
+    out->window_z[slot] = z;
+    out->inv_w[slot] = inv_w;
+    out->intensity_w[slot] = out->intensity[slot] * inv_w;
+}
+
+static void transform_scalar(const struct vertex_constants *k, float position[4][RASTER_VERTEX_BATCH],
+    float normal[3][RASTER_VERTEX_BATCH], struct raster_vertices *out, uint32_t first)
+{
+    const float *m = k->matrix;
+    int lane, row;
+
+    for (lane = 0; lane < RASTER_VERTEX_BATCH; lane++)
+    {
+        uint32_t slot = first + lane;
+        float px = position[0][lane], py = position[1][lane], pz = position[2][lane], pw = position[3][lane];
+
+        for (row = 0; row < 4; row++)
+            out->clip[row][slot] = m[row] * px + m[4 + row] * py + m[8 + row] * pz + m[12 + row] * pw;
+        out->intensity[slot] = 1.0f;
+        if (k->lit)
+        {
+            // rotations, translations and uniform scales, like mesh.vert assumes
+            float n[3], length, diffuse;
+
+            for (row = 0; row < 3; row++)
+                n[row] = k->model[row] * normal[0][lane] + k->model[4 + row] * normal[1][lane] +
+                    k->model[8 + row] * normal[2][lane];
+            length = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            if (length > 0.0f)
+            {
+                n[0] = n[0] / length;
+                n[1] = n[1] / length;
+                n[2] = n[2] / length;
+            }
+            diffuse = n[0] * k->light[0] + n[1] * k->light[1] + n[2] * k->light[2];
+            out->intensity[slot] = LIT_AMBIENT + (1.0f - LIT_AMBIENT) * (diffuse > 0.0f ? diffuse : 0.0f);
+        }
+
+        float x = out->clip[0][slot], y = out->clip[1][slot], z = out->clip[2][slot], w = out->clip[3][slot];
+        out->outcode[slot] = (uint32_t)((x > w) | (x < -w) << 1 | (y > w) << 2 | (y < -w) << 3 | (z > w) << 4 |
+            (x > k->guard_x * w) << 5 | (x < -(k->guard_x * w)) << 6 | (y > k->guard_y * w) << 7 |
+            (y < -(k->guard_y * w)) << 8);
+        project_vertex(k, out, slot);
+    }
+}
+
+#ifdef RASTER_X86
+__attribute__((target("avx2")))
+static __m256i outcode_bit(__m256 outside, int bit)
+{
+    return _mm256_and_si256(_mm256_castps_si256(outside), _mm256_set1_epi32(1 << bit));
+}
+
+__attribute__((target("avx2")))
+static void transform_avx2(const struct vertex_constants *k, float position[4][RASTER_VERTEX_BATCH],
+    float normal[3][RASTER_VERTEX_BATCH], struct raster_vertices *out, uint32_t first)
+{
+    const __m256 zero = _mm256_setzero_ps(), half = _mm256_set1_ps(0.5f), one = _mm256_set1_ps(1.0f);
+    const float *m = k->matrix;
+    __m256 p[4], clip[4], intensity = one;
+    int row;
+
+    for (row = 0; row < 4; row++)
+        p[row] = _mm256_loadu_ps(position[row]);
+    for (row = 0; row < 4; row++)
+    {
+        __m256 sum = _mm256_mul_ps(_mm256_set1_ps(m[row]), p[0]);
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(m[4 + row]), p[1]));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(m[8 + row]), p[2]));
+        clip[row] = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(m[12 + row]), p[3]));
+        _mm256_storeu_ps(out->clip[row] + first, clip[row]);
+    }
+    if (k->lit)
+    {
+        __m256 source[3], n[3];
+
+        for (row = 0; row < 3; row++)
+            source[row] = _mm256_loadu_ps(normal[row]);
+        for (row = 0; row < 3; row++)
+        {
+            __m256 sum = _mm256_mul_ps(_mm256_set1_ps(k->model[row]), source[0]);
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(k->model[4 + row]), source[1]));
+            n[row] = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(k->model[8 + row]), source[2]));
+        }
+        __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(n[0], n[0]), _mm256_mul_ps(n[1], n[1])),
+            _mm256_mul_ps(n[2], n[2])));
+        __m256 nonzero = _mm256_cmp_ps(length, zero, _CMP_GT_OQ);
+        for (row = 0; row < 3; row++)
+            n[row] = _mm256_blendv_ps(n[row], _mm256_div_ps(n[row], length), nonzero);
+        __m256 diffuse = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(n[0], _mm256_set1_ps(k->light[0])),
+            _mm256_mul_ps(n[1], _mm256_set1_ps(k->light[1]))), _mm256_mul_ps(n[2], _mm256_set1_ps(k->light[2])));
+        intensity = _mm256_add_ps(_mm256_set1_ps(LIT_AMBIENT),
+            _mm256_mul_ps(_mm256_set1_ps(1.0f - LIT_AMBIENT), _mm256_max_ps(diffuse, zero)));
+    }
+    _mm256_storeu_ps(out->intensity + first, intensity);
+
+    // the view volume and guard band in SoA: one compare per side for all eight vertices
+    __m256 w = clip[3], negative_w = _mm256_sub_ps(zero, w);
+    __m256 guard_x = _mm256_mul_ps(_mm256_set1_ps(k->guard_x), w), guard_y = _mm256_mul_ps(_mm256_set1_ps(k->guard_y), w);
+    __m256i code = outcode_bit(_mm256_cmp_ps(clip[0], w, _CMP_GT_OQ), 0);
+    code = _mm256_or_si256(code, outcode_bit(_mm256_cmp_ps(clip[0], negative_w, _CMP_LT_OQ), 1));
+    code = _mm256_or_si256(code, outcode_bit(_mm256_cmp_ps(clip[1], w, _CMP_GT_OQ), 2));
+    code = _mm256_or_si256(code, outcode_bit(_mm256_cmp_ps(clip[1], negative_w, _CMP_LT_OQ), 3));
+    code = _mm256_or_si256(code, outcode_bit(_mm256_cmp_ps(clip[2], w, _CMP_GT_OQ), 4));
+    code = _mm256_or_si256(code, outcode_bit(_mm256_cmp_ps(clip[0], guard_x, _CMP_GT_OQ), 5));
+    code = _mm256_or_si256(code, outcode_bit(_mm256_cmp_ps(clip[0], _mm256_sub_ps(zero, guard_x), _CMP_LT_OQ), 6));
+    code = _mm256_or_si256(code, outcode_bit(_mm256_cmp_ps(clip[1], guard_y, _CMP_GT_OQ), 7));
+    code = _mm256_or_si256(code, outcode_bit(_mm256_cmp_ps(clip[1], _mm256_sub_ps(zero, guard_y), _CMP_LT_OQ), 8));
+    _mm256_storeu_si256((__m256i *)(out->outcode + first), code);
+
+    // projection, as project_vertex
+    __m256 inv_w = _mm256_div_ps(one, w);
+    __m256 subpixels = _mm256_set1_ps((float)SUBPIXELS);
+    __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(clip[0], inv_w), half), half);
+    __m256 y = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(clip[1], inv_w), half), half);
+    __m256 z = _mm256_mul_ps(clip[2], inv_w);
+    x = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(x, _mm256_set1_ps(k->width)), subpixels), half);
+    y = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(y, _mm256_set1_ps(k->height)), subpixels), half);
+    _mm256_storeu_si256((__m256i *)(out->window_x + first), _mm256_cvttps_epi32(_mm256_floor_ps(x)));
+    _mm256_storeu_si256((__m256i *)(out->window_y + first), _mm256_cvttps_epi32(_mm256_floor_ps(y)));
+    if (!k->zero_to_one)
+        z = _mm256_add_ps(_mm256_mul_ps(z, half), half);
+    // max(0, z) and min(1, z) keep z when it is -0 or NaN, like the compares in project_vertex
+    z = _mm256_min_ps(one, _mm256_max_ps(zero, z));
+    _mm256_storeu_ps(out->window_z + first, z);
+    _mm256_storeu_ps(out->inv_w + first, inv_w);
+    _mm256_storeu_ps(out->intensity_w + first, _mm256_mul_ps(intensity, inv_w));
+}
+#endif
+
+// fits value = out[0] + out[1] px + out[2] py through the vertices, with px, py whole pixels
+// addressing pixel centers
+static void setup_plane(float *out, const float *x, const float *y, const float *value, float area)
+{
+    float dx = ((value[1] - value[0]) * (y[2] - y[0]) - (value[2] - value[0]) * (y[1] - y[0])) / area;
+    float dy = ((x[1] - x[0]) * (value[2] - value[0]) - (x[2] - x[0]) * (value[1] - value[0])) / area;
+
+    out[0] = value[0] - dx * (x[0] - 0.5f) - dy * (y[0] - 0.5f);
+    out[1] = dx;
+    out[2] = dy;
+}
+
+// sets up the triangle between three projected vertices of range->vertices and adds it to the
+// range's list
+static int setup_triangle(struct raster_vertex_range *range, const struct vertex_constants *k, const uint32_t *slots,
+    const float *rgba, const struct raster_pipeline *pipeline)
+{
+    const struct raster_vertices *v = &range->vertices;
+    struct raster_triangle *triangle;
+    int32_t fx[3], fy[3];
+    float x[3], y[3], z[3], inv_w[3], intensity[3];
+    int64_t area;
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        fx[i] = v->window_x[slots[i]];
+        fy[i] = v->window_y[slots[i]];
+        z[i] = v->window_z[slots[i]];
+        inv_w[i] = v->inv_w[slots[i]];
+        intensity[i] = v->intensity_w[slots[i]];
+    }
+    area = (int64_t)(fx[1] - fx[0]) * (fy[2] - fy[0]) - (int64_t)(fx[2] - fx[0]) * (fy[1] - fy[0]);
+    if (area == 0)
+    {
+        range->culled++;
+        return 1;
+    }
+    // both windings are drawn; clockwise ones are turned around so inside is always >= 0
+    if (area < 0)
+    {
+        int32_t t;
+        float f;
+
+        area = -area;
+        t = fx[1]; fx[1] = fx[2]; fx[2] = t;
+        t = fy[1]; fy[1] = fy[2]; fy[2] = t;
+        f = z[1]; z[1] = z[2]; z[2] = f;
+        f = inv_w[1]; inv_w[1] = inv_w[2]; inv_w[2] = f;
+        f = intensity[1]; intensity[1] = intensity[2]; intensity[2] = f;
+    }
+
+    // pixels with a center, or a sample when multisampled, inside the triangle's bounds
+    int min_fx = fx[0] < fx[1] ? fx[0] : fx[1], max_fx = fx[0] > fx[1] ? fx[0] : fx[1];
+    int min_fy = fy[0] < fy[1] ? fy[0] : fy[1], max_fy = fy[0] > fy[1] ? fy[0] : fy[1];
+    min_fx = fx[2] < min_fx ? fx[2] : min_fx;
+    max_fx = fx[2] > max_fx ? fx[2] : max_fx;
+    min_fy = fy[2] < min_fy ? fy[2] : min_fy;
+    max_fy = fy[2] > max_fy ? fy[2] : max_fy;
+    int min_x = (min_fx - SUBPIXELS / 2 - k->sample_reach + SUBPIXELS - 1) >> RASTER_SUBPIXEL_BITS;
+    int min_y = (min_fy - SUBPIXELS / 2 - k->sample_reach + SUBPIXELS - 1) >> RASTER_SUBPIXEL_BITS;
+    int max_x = (max_fx - SUBPIXELS / 2 + k->sample_reach) >> RASTER_SUBPIXEL_BITS;
+    int max_y = (max_fy - SUBPIXELS / 2 + k->sample_reach) >> RASTER_SUBPIXEL_BITS;
+    min_x = min_x < 0 ? 0 : min_x;
+    min_y = min_y < 0 ? 0 : min_y;
+    max_x = max_x >= (int)k->width ? (int)k->width - 1 : max_x;
+    max_y = max_y >= (int)k->height ? (int)k->height - 1 : max_y;
+    if (min_x > max_x || min_y > max_y)
+    {
+        range->culled++;
+        return 1;
+    }
+
+    if (range->triangle_count == range->triangle_capacity)
+    {
+        unsigned int capacity = range->triangle_capacity ? range->triangle_capacity * 2 : 256;
+        struct raster_triangle *triangles =
+            (struct raster_triangle *)realloc(range->triangles, sizeof(*triangles) * capacity);
+        if (triangles == NULL)
+            return 0;
+        range->triangles = triangles;
+        range->triangle_capacity = capacity;
+    }
+    triangle = &range->triangles[range->triangle_count++];
+    for (i = 0; i < 3; i++)
+    {
+        int j = (i + 1) % 3;
+
+        triangle->edge_a[i] = fy[i] - fy[j];
+        triangle->edge_b[i] = fx[j] - fx[i];
+        triangle->edge_c[i] = -((int64_t)triangle->edge_a[i] * fx[i] + (int64_t)triangle->edge_b[i] * fy[i]);
+        // top-left fill rule: samples exactly on any other edge belong to the neighbour
+        if (!(triangle->edge_a[i] > 0 || (triangle->edge_a[i] == 0 && triangle->edge_b[i] < 0)))
+            triangle->edge_c[i]--;
+        x[i] = (float)fx[i] / SUBPIXELS;
+        y[i] = (float)fy[i] / SUBPIXELS;
+    }
+    float pixel_area = (float)area / (SUBPIXELS * SUBPIXELS);
+    setup_plane(triangle->depth, x, y, z, pixel_area);
+    triangle->depth_min = z[0] < z[1] ? (z[0] < z[2] ? z[0] : z[2]) : (z[1] < z[2] ? z[1] : z[2]);
+    triangle->depth_max = z[0] > z[1] ? (z[0] > z[2] ? z[0] : z[2]) : (z[1] > z[2] ? z[1] : z[2]);
+    if (pipeline->shader == RASTER_SHADER_LIT)
+    {
+        setup_plane(triangle->inv_w, x, y, inv_w, pixel_area);
+        setup_plane(triangle->intensity, x, y, intensity, pixel_area);
+    }
+    triangle->min_x = min_x;
+    triangle->min_y = min_y;
+    triangle->max_x = max_x;
+    triangle->max_y = max_y;
+    triangle->color = pack_color(rgba);
+    memcpy(triangle->rgba, rgba, sizeof(triangle->rgba));
+    triangle->pipeline = *pipeline;
+    return 1;
+}
+
+// distance of a clip-space vertex inside plane (a, b, c, d) . (x, y, z, w) >= 0
+static float plane_distance(const float *plane, const struct clip_vertex *v)
+{
+    return plane[0] * v->position[0] + plane[1] * v->position[1] + plane[2] * v->position[2] +
+        plane[3] * v->position[3];
+}
+
+// Sutherland-Hodgman against the near plane and the guard band. the polygon's vertices are
+// projected into spare slots past the range's transformed ones and fanned into triangles.
+static int clip_triangle(struct raster_vertex_range *range, const struct vertex_constants *k, const uint32_t *slots,
+    uint32_t spare, const float *rgba, const struct raster_pipeline *pipeline)
+{
+    const float planes[5][4] = {
+        { 0.0f, 0.0f, -1.0f, 1.0f },
+        { -1.0f, 0.0f, 0.0f, k->guard_x },
+        { 1.0f, 0.0f, 0.0f, k->guard_x },
+        { 0.0f, -1.0f, 0.0f, k->guard_y },
+        { 0.0f, 1.0f, 0.0f, k->guard_y },
+    };
+    struct raster_vertices *vertices = &range->vertices;
+    struct clip_vertex buffers[2][CLIP_MAX_VERTICES + 1];
+    struct clip_vertex *in = buffers[0], *out = buffers[1], *swap;
+    unsigned int count = 3, i, p;
+
+    for (i = 0; i < 3; i++)
+    {
+        for (p = 0; p < 4; p++)
+            in[i].position[p] = vertices->clip[p][slots[i]];
+        in[i].intensity = vertices->intensity[slots[i]];
+    }
+    for (p = 0; p < 5 && count >= 3; p++)
+    {
+        unsigned int out_count = 0;
+
+        for (i = 0; i < count; i++)
+        {
+            const struct clip_vertex *a = &in[i], *b = &in[(i + 1) % count];
+            float da = plane_distance(planes[p], a), db = plane_distance(planes[p], b);
+
+            if (da >= 0.0f)
+                out[out_count++] = *a;
+            if ((da >= 0.0f) != (db >= 0.0f))
+            {
+                float t = da / (da - db);
+                unsigned int c;
+
+                for (c = 0; c < 4; c++)
+                    out[out_count].position[c] = a->position[c] + (b->position[c] - a->position[c]) * t;
+                out[out_count].intensity = a->intensity + (b->intensity - a->intensity) * t;
+                out_count++;
+            }
+        }
+        swap = in;
+        in = out;
+        out = swap;
+        count = out_count;
+    }
+    if (count < 3)
+    {
+        range->culled++;
+        return 1;
+    }
+    for (i = 0; i < count; i++)
+    {
+        for (p = 0; p < 4; p++)
+            vertices->clip[p][spare + i] = in[i].position[p];
+        vertices->intensity[spare + i] = in[i].intensity;
+        project_vertex(k, vertices, spare + i);
+    }
+    for (i = 2; i < count; i++)
+    {
+        const uint32_t fan[3] = { spare, spare + i - 1, spare + i };
+
+        if (!setup_triangle(range, k, fan, rgba, pipeline))
+            return 0;
+    }
+    return 1;
+}
+
+static int grow(void **array, size_t element, uint32_t capacity)
+{
+    void *grown = realloc(*array, element * capacity);
+
+    if (grown == NULL)
+        return 0;
+    *array = grown;
+    return 1;
+}
+
+// room for a range's post-transform cache and for capacity transformed vertices
+static int reserve_range(struct raster_vertex_range *range, uint32_t vertex_count, uint32_t capacity)
+{
+    struct raster_vertices *v = &range->vertices;
+    int ok = 1, i;
+
+    if (range->cache_capacity < vertex_count)
+    {
+        ok &= grow((void **)&range->cache_stamp, sizeof(uint32_t), vertex_count);
+        ok &= grow((void **)&range->cache_slot, sizeof(uint32_t), vertex_count);
+        if (!ok)
+            return 0;
+        // new entries must not look transformed for any stamp; restamping from 1 clears the rest
+        memset(range->cache_stamp, 0, sizeof(uint32_t) * vertex_count);
+        range->stamp = 0;
+        range->cache_capacity = vertex_count;
+    }
+    // whole batches, plus the vertices a clipped polygon can have
+    capacity = (capacity + RASTER_VERTEX_BATCH - 1) / RASTER_VERTEX_BATCH * RASTER_VERTEX_BATCH + CLIP_MAX_VERTICES + 1;
+    if (v->capacity < capacity)
+    {
+        for (i = 0; i < 4; i++)
+            ok &= grow((void **)&v->clip[i], sizeof(float), capacity);
+        ok &= grow((void **)&v->intensity, sizeof(float), capacity);
+        ok &= grow((void **)&v->window_x, sizeof(int32_t), capacity);
+        ok &= grow((void **)&v->window_y, sizeof(int32_t), capacity);
+        ok &= grow((void **)&v->window_z, sizeof(float), capacity);
+        ok &= grow((void **)&v->inv_w, sizeof(float), capacity);
+        ok &= grow((void **)&v->intensity_w, sizeof(float), capacity);
+        ok &= grow((void **)&v->outcode, sizeof(uint32_t), capacity);
+        ok &= grow((void **)&range->sources, sizeof(uint32_t), capacity);
+        if (!ok)
+            return 0;
+        v->capacity = capacity;
+    }
+    return 1;
+}
+
+// the vertex stage for one slice of a draw's triangles
+static void process_range(void *arg, unsigned int index)
+{
+    const struct draw_job *job = (const struct draw_job *)arg;
+    const struct vertex_constants *k = job->constants;
+    const struct raster_vertex_array *array = job->array;
+    const struct raster_attribute *positions = &array->attributes[RASTER_POSITION_LOCATION];
+    const struct raster_attribute *normals = &array->attributes[RASTER_NORMAL_LOCATION];
+    struct raster_vertex_range *range = &job->target->ranges[index];
+    uint32_t first = (uint32_t)((uint64_t)job->triangle_count * index / job->range_count);
+    uint32_t last = (uint32_t)((uint64_t)job->triangle_count * (index + 1) / job->range_count);
+    uint32_t count = 0, i, t;
+    int lane;
+
+    range->triangle_count = 0;
+    range->vertex_count = 0;
+    range->culled = 0;
+    range->failed = 0;
+    if (!reserve_range(range, array->vertex_count, (last - first) * 3 < array->vertex_count ?
+        (last - first) * 3 : array->vertex_count))
+    {
+        range->failed = 1;
+        return;
+    }
+    if (++range->stamp == 0)
+    {
+        memset(range->cache_stamp, 0, sizeof(uint32_t) * range->cache_capacity);
+        range->stamp = 1;
+    }
+
+    // the vertices the range uses, each once, in the order they are first used
+    for (i = first * 3; i < last * 3; i++)
+    {
+        uint32_t vertex = array->indices[i];
+
+        if (vertex < array->vertex_count && range->cache_stamp[vertex] != range->stamp)
+        {
+            range->cache_stamp[vertex] = range->stamp;
+            range->cache_slot[vertex] = count;
+            range->sources[count++] = vertex;
+        }
+    }
+    range->vertex_count = count;
+
+    for (i = 0; i < count; i += RASTER_VERTEX_BATCH)
+    {
+        float position[4][RASTER_VERTEX_BATCH], normal[3][RASTER_VERTEX_BATCH];
+
+        for (lane = 0; lane < RASTER_VERTEX_BATCH; lane++)
+        {
+            // a short last batch repeats its last vertex
+            uint32_t vertex = range->sources[i + lane < count ? i + lane : count - 1];
+            float value[4];
+            int c;
+
+            fetch_attribute(positions, vertex, value);
+            for (c = 0; c < 4; c++)
+                position[c][lane] = value[c];
+            fetch_attribute(normals, vertex, value);
+            for (c = 0; c < 3; c++)
+                normal[c][lane] = value[c];
+        }
+#ifdef RASTER_X86
+        if (job->simd)
+        {
+            transform_avx2(k, position, normal, &range->vertices, i);
+            continue;
+        }
+#endif
+        transform_scalar(k, position, normal, &range->vertices, i);
+    }
+
+    // assembly: trivially rejected, clipped or set up straight from the projected vertices
+    uint32_t spare = (count + RASTER_VERTEX_BATCH - 1) / RASTER_VERTEX_BATCH * RASTER_VERTEX_BATCH;
+    for (t = first; t < last; t++)
+    {
+        const uint32_t *indices = &array->indices[t * 3];
+        uint32_t slots[3], code_and = ~0u, code_or = 0;
+        int ok;
+
+        if (indices[0] >= array->vertex_count || indices[1] >= array->vertex_count || indices[2] >= array->vertex_count)
+        {
+            range->culled++;
+            continue;
+        }
+        for (lane = 0; lane < 3; lane++)
+        {
+            slots[lane] = range->cache_slot[indices[lane]];
+            code_and &= range->vertices.outcode[slots[lane]];
+            code_or |= range->vertices.outcode[slots[lane]];
+        }
+        if (code_and & OUTSIDE_VIEW)
+        {
+            range->culled++;
+            continue;
+        }
+        if (code_or & NEEDS_CLIP)
+            ok = clip_triangle(range, k, slots, spare, job->rgba, job->pipeline);
+        else
+            ok = setup_triangle(range, k, slots, job->rgba, job->pipeline);
+        if (!ok)
+        {
+            range->failed = 1;
+            return;
+        }
+    }
+}
+
+int raster_draw(struct raster_target *target, const float *view_projection, const float *model,
+    const struct raster_vertex_array *array, const float *color, const struct raster_pipeline *pipeline)
+{
+    struct vertex_constants constants;
+    struct draw_job job;
+    unsigned int r, i;
+    int bx, by;
+
+    memset(&constants, 0, sizeof(constants));
+    mat4_multiply(constants.matrix, view_projection, model);
+    constants.model = model;
+    memcpy(constants.light, target->light, sizeof(constants.light));
+    vec3_normalize(constants.light);
+    constants.width = (float)target->width;
+    constants.height = (float)target->height;
+    constants.guard_x = 1.0f + 2.0f * RASTER_GUARD_BAND / (float)target->width;
+    constants.guard_y = 1.0f + 2.0f * RASTER_GUARD_BAND / (float)target->height;
+    constants.sample_reach = target->samples > 1 ? SAMPLE_REACH : 0;
+    constants.zero_to_one = target->zero_to_one;
+    constants.lit = pipeline->shader == RASTER_SHADER_LIT;
+
+    job.target = target;
+    job.constants = &constants;
+    job.array = array;
+    job.rgba = color;
+    job.pipeline = pipeline;
+    job.triangle_count = array->index_count / 3;
+    job.range_count = (job.triangle_count + RASTER_MIN_RANGE - 1) / RASTER_MIN_RANGE;
+    job.range_count = job.range_count < 1 ? 1 : job.range_count > target->range_count ? target->range_count :
+        job.range_count;
+    job.simd = target->simd;
+    if (job.triangle_count == 0)
+        return 1;
+    if (job.range_count > 1)
+        thread_pool_parallel_for(target->pool, job.range_count, process_range, &job);
+    else
+        process_range(&job, 0);
+
+    // ranges are binned in order, so every bin sees the draw's triangles in index order
+    for (r = 0; r < job.range_count; r++)
+    {
+        struct raster_vertex_range *range = &target->ranges[r];
+
+        if (range->failed)
+            return 0;
+        if (target->triangle_count + range->triangle_count > target->triangle_capacity)
+        {
+            unsigned int capacity = target->triangle_capacity ? target->triangle_capacity : 256;
+            while (capacity < target->triangle_count + range->triangle_count)
+                capacity *= 2;
+            if (!grow((void **)&target->triangles, sizeof(struct raster_triangle), capacity))
+                return 0;
+            target->triangle_capacity = capacity;
+        }
+        memcpy(&target->triangles[target->triangle_count], range->triangles,
+            sizeof(struct raster_triangle) * range->triangle_count);
+        for (i = 0; i < range->triangle_count; i++)
+        {
+            const struct raster_triangle *triangle = &range->triangles[i];
+
+            for (by = triangle->min_y / RASTER_BIN_SIZE; by <= triangle->max_y / RASTER_BIN_SIZE; by++)
+            {
+                for (bx = triangle->min_x / RASTER_BIN_SIZE; bx <= triangle->max_x / RASTER_BIN_SIZE; bx++)
+                {
+                    if (!bin_add(&target->bins[by * target->bins_x + bx], target->triangle_count + i))
+                        return 0;
+                }
+            }
+        }
+        target->triangle_count += range->triangle_count;
+        target->stats.vertices += range->vertex_count;
+        target->stats.triangles += range->triangle_count;
+        target->stats.triangles_culled += range->culled;
+    }
+    return 1;
+}
+
+// one triangle's work in one tile, once the tile level decisions are made
+struct tile_work
+{
+    const struct raster_triangle *triangle;
+    uint32_t *color;
+    float *depth;
+    int x0, y0;                 // the tile's lower-left pixel
+    int width, height;          // less than a tile at the target's right and top edges
+    int32_t edge[3];            // at the tile's first pixel center; 0 for edges it is wholly inside
+    int32_t step_x[3];
+    int32_t step_y[3];
+    float depth_low, depth_high;
+    // multisampled targets only
+    int simd;
+    uint64_t edges;             // the tile's edge pixels, updated by the kernel
+    uint32_t *sample_color;
+    float *sample_depth;
+    int32_t sample_edge[3][RASTER_MSAA_SAMPLES];    // edge offsets from a pixel's center to its samples
+    float sample_z[RASTER_MSAA_SAMPLES];            // ... and depth offsets
+    uint32_t fragments;
+    uint32_t pixels_tested;
+    uint32_t pixels_rejected;
+};
+
+// src over dst by src's alpha, in 8 bits per channel
+static FORCE_INLINE uint32_t blend_alpha(uint32_t src, uint32_t dst)
+{
+    uint32_t alpha = src >> 24, out = 0;
+    int shift;
+
+    for (shift = 0; shift < 32; shift += 8)
+    {
+        uint32_t c = (((src >> shift) & 0xff) * alpha + ((dst >> shift) & 0xff) * (255 - alpha) + 127) / 255;
+        out |= c << shift;
+    }
+    return out;
+}
+
+// which samples of every pixel of the tile the triangle covers, a bit per sample
+static void coverage_scalar(const struct tile_work *work, int32_t *masks)
+{
+    int x, y, s, i;
+
+    for (y = 0; y < RASTER_TILE_SIZE; y++)
+    {
+        for (x = 0; x < RASTER_TILE_SIZE; x++)
+        {
+            int32_t mask = 0;
+
+            for (s = 0; s < RASTER_MSAA_SAMPLES; s++)
+            {
+                int32_t inside = 0;
+
+                for (i = 0; i < 3; i++)
+                    inside |= work->edge[i] + work->step_y[i] * y + work->step_x[i] * x + work->sample_edge[i][s];
+                mask |= (inside >= 0) << s;
+            }
+            masks[y * RASTER_TILE_SIZE + x] = mask;
+        }
+    }
+}
+
+#ifdef RASTER_X86
+// a row of pixels a sample at a time: the three edge functions in eight lanes, or'd so the sign
+// says whether any of them is outside
+__attribute__((target("avx2"))) static void coverage_avx2(const struct tile_work *work, int32_t *masks)
+{
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), minus_one = _mm256_set1_epi32(-1);
+    __m256i step_x[3];
+    int y, s, i;
+
+    for (i = 0; i < 3; i++)
+        step_x[i] = _mm256_mullo_epi32(lanes, _mm256_set1_epi32(work->step_x[i]));
+    for (y = 0; y < RASTER_TILE_SIZE; y++)
+    {
+        __m256i mask = _mm256_setzero_si256();
+
+        for (s = 0; s < RASTER_MSAA_SAMPLES; s++)
+        {
+            __m256i inside = _mm256_setzero_si256();
+
+            for (i = 0; i < 3; i++)
+                inside = _mm256_or_si256(inside, _mm256_add_epi32(step_x[i],
+                    _mm256_set1_epi32(work->edge[i] + work->step_y[i] * y + work->sample_edge[i][s])));
+            inside = _mm256_cmpgt_epi32(inside, minus_one);
+            mask = _mm256_or_si256(mask, _mm256_and_si256(inside, _mm256_set1_epi32(1 << s)));
+        }
+        _mm256_storeu_si256((__m256i *)(masks + y * RASTER_TILE_SIZE), mask);
+    }
+}
+#endif
+
+static FORCE_INLINE uint32_t shade_pixel(const struct raster_triangle *triangle, enum raster_shader shader, float w_row,
+    float i_row, float px)
+{
+    if (shader == RASTER_SHADER_LIT)
+    {
+        float intensity = (i_row + triangle->intensity[1] * px) / (w_row + triangle->inv_w[1] * px), lit[4];
+
+        lit[0] = triangle->rgba[0] * intensity;
+        lit[1] = triangle->rgba[1] * intensity;
+        lit[2] = triangle->rgba[2] * intensity;
+        lit[3] = triangle->rgba[3];
+        return pack_color(lit);
+    }
+    return triangle->color;
+}
+
+// the pixel loop of a tile. the last five arguments are constants in every kernel below, so the
+// compiler drops the branches on them and each pipeline gets a loop of its own; shade_generic
+// calls it with them as variables
+static FORCE_INLINE void shade_tile(struct tile_work *work, enum raster_shader shader, enum raster_blend blend,
+    int msaa, int depth_test, int partial)
+{
+    const struct raster_triangle *triangle = work->triangle;
+    uint32_t fragments = 0, tested = 0, rejected = 0;
+    uint64_t edges = work->edges;
+    int32_t masks[TILE_PIXELS];
+    int x, y, s;
+
+    if (msaa && partial)
+    {
+#ifdef RASTER_X86
+        if (work->simd)
+            coverage_avx2(work, masks);
+        else
+#endif
+            coverage_scalar(work, masks);
+    }
+    for (y = 0; y < work->height; y++)
+    {
+        int32_t e0 = work->edge[0] + work->step_y[0] * y, e1 = work->edge[1] + work->step_y[1] * y,
+            e2 = work->edge[2] + work->step_y[2] * y;
+        float py = (float)(work->y0 + y);
+        float z_row = triangle->depth[0] + triangle->depth[2] * py;
+        float w_row = 0.0f, i_row = 0.0f;
+
+        if (shader == RASTER_SHADER_LIT)
+        {
+            w_row = triangle->inv_w[0] + triangle->inv_w[2] * py;
+            i_row = triangle->intensity[0] + triangle->intensity[2] * py;
+        }
+
+        for (x = 0; x < work->width; x++, e0 += work->step_x[0], e1 += work->step_x[1], e2 += work->step_x[2])
+        {
+            int k = y * RASTER_TILE_SIZE + x;
+            float px = (float)(work->x0 + x);
+            int32_t mask = msaa && partial ? masks[k] : FULL_COVERAGE;
+            uint64_t bit = (uint64_t)1 << k;
+            uint32_t c;
+
+            if (msaa ? mask == 0 : partial && (e0 | e1 | e2) < 0)
+                continue;
+            float z_center = z_row + triangle->depth[1] * px;
+            float z = z_center < work->depth_low ? work->depth_low : z_center > work->depth_high ? work->depth_high :
+                z_center;
+
+            // every sample of a pixel without samples of its own covered: one depth, as without msaa
+            if (!msaa || (mask == FULL_COVERAGE && !(edges & bit)))
+            {
+                if (depth_test)
+                {
+                    tested++;
+                    if (z <= work->depth[k])
+                    {
+                        rejected++;
+                        continue;
+                    }
+                }
+                c = shade_pixel(triangle, shader, w_row, i_row, px);
+                if (blend == RASTER_BLEND_ALPHA)
+                {
+                    c = blend_alpha(c, work->color[k]);
+                }
+                else
+                {
+                    work->depth[k] = z;
+                }
+                work->color[k] = c;
+                fragments++;
+                continue;
+            }
+
+            // an edge pixel: depth tested and written sample by sample, shaded once
+            uint32_t *sample_color = work->sample_color + k * RASTER_MSAA_SAMPLES;
+            float *sample_depth = work->sample_depth + k * RASTER_MSAA_SAMPLES;
+            float sample_z[RASTER_MSAA_SAMPLES];
+            int32_t passed = 0;
+
+            for (s = 0; s < RASTER_MSAA_SAMPLES; s++)
+            {
+                if (!(mask & (1 << s)))
+                    continue;
+                float zs = z_center + work->sample_z[s];
+                sample_z[s] = zs < work->depth_low ? work->depth_low : zs > work->depth_high ? work->depth_high : zs;
+                if (depth_test && sample_z[s] <= (edges & bit ? sample_depth[s] : work->depth[k]))
+                    continue;
+                passed |= 1 << s;
+            }
+            if (depth_test)
+            {
+                tested++;
+                if (passed == 0)
+                {
+                    rejected++;
+                    continue;
+                }
+            }
+            if (!(edges & bit))
+            {
+                for (s = 0; s < RASTER_MSAA_SAMPLES; s++)
+                {
+                    sample_color[s] = work->color[k];
+                    sample_depth[s] = work->depth[k];
+                }
+                edges |= bit;
+            }
+            c = shade_pixel(triangle, shader, w_row, i_row, px);
+            for (s = 0; s < RASTER_MSAA_SAMPLES; s++)
+            {
+                if (!(passed & (1 << s)))
+                    continue;
+                if (blend == RASTER_BLEND_ALPHA)
+                {
+                    sample_color[s] = blend_alpha(c, sample_color[s]);
+                }
+                else
+                {
+                    sample_color[s] = c;
+                    sample_depth[s] = sample_z[s];
+                }
+            }
+            // written over whole, it goes back to one color and depth
+            if (blend == RASTER_BLEND_NONE && passed == FULL_COVERAGE)
+            {
+                work->color[k] = c;
+                work->depth[k] = z;
+                edges &= ~bit;
+            }
+            fragments++;
+        }
+    }
+    work->edges = edges;
+    work->fragments = fragments;
+    work->pixels_tested = tested;
+    work->pixels_rejected = rejected;
+}
+
+typedef void (*tile_kernel)(struct tile_work *work);
+
+// every pipeline, in enum order: shader, then blend
+#define RASTER_PIPELINES(X) \
+    X(FLAT, NONE) \
+    X(FLAT, ALPHA) \
+    X(LIT, NONE) \
+    X(LIT, ALPHA)
+
+#define DEFINE_KERNEL(shader, blend, name, msaa, depth_test, partial) \
+    static void kernel_##shader##_##blend##_##name(struct tile_work *work) \
+    { shade_tile(work, RASTER_SHADER_##shader, RASTER_BLEND_##blend, msaa, depth_test, partial); }
+// eight kernels a pipeline: single or multisampled, depth tested or accepted by the tile, tile
+// partly or wholly covered
+#define DEFINE_KERNELS(shader, blend) \
+    DEFINE_KERNEL(shader, blend, accepted_full, 0, 0, 0) \
+    DEFINE_KERNEL(shader, blend, accepted_partial, 0, 0, 1) \
+    DEFINE_KERNEL(shader, blend, tested_full, 0, 1, 0) \
+    DEFINE_KERNEL(shader, blend, tested_partial, 0, 1, 1) \
+    DEFINE_KERNEL(shader, blend, msaa_accepted_full, 1, 0, 0) \
+    DEFINE_KERNEL(shader, blend, msaa_accepted_partial, 1, 0, 1) \
+    DEFINE_KERNEL(shader, blend, msaa_tested_full, 1, 1, 0) \
+    DEFINE_KERNEL(shader, blend, msaa_tested_partial, 1, 1, 1)
+RASTER_PIPELINES(DEFINE_KERNELS)
+
+#define KERNEL_ENTRIES(shader, blend) \
+    kernel_##shader##_##blend##_accepted_full, kernel_##shader##_##blend##_accepted_partial, \
+    kernel_##shader##_##blend##_tested_full, kernel_##shader##_##blend##_tested_partial, \
+    kernel_##shader##_##blend##_msaa_accepted_full, kernel_##shader##_##blend##_msaa_accepted_partial, \
+    kernel_##shader##_##blend##_msaa_tested_full, kernel_##shader##_##blend##_msaa_tested_partial,
+// indexed by (((shader * 2 + blend) * 2 + msaa) * 2 + depth_test) * 2 + partial
+static const tile_kernel kernels[] = { RASTER_PIPELINES(KERNEL_ENTRIES) };
+
+// the unspecialized loop, branching on the pipeline for every pixel
+static NO_INLINE void shade_generic(struct tile_work *work, enum raster_shader shader, enum raster_blend blend,
+    int msaa, int depth_test, int partial)
+{
+    shade_tile(work, shader, blend, msaa, depth_test, partial);
+}
+
+// one triangle over one tile; x0, y0 is the tile's lower-left pixel
+static void rasterize_tile(struct raster_target *target, const struct raster_triangle *triangle, int tile, int x0,
+    int y0, struct raster_stats *stats)
+{
+    const int msaa = target->samples > 1, reach = msaa ? SAMPLE_REACH : 0;
+    const int64_t span = (RASTER_TILE_SIZE - 1) * SUBPIXELS + 2 * reach;
+    int64_t corner_x = (int64_t)x0 * SUBPIXELS + SUBPIXELS / 2, corner_y = (int64_t)y0 * SUBPIXELS + SUBPIXELS / 2;
+    struct tile_work work;
+    int partial = 0, i, s, x, y;
+
+    // edges the whole tile (every sample in it) is inside of are left at 0 below; one it is wholly
+    // outside of drops it
+    memset(&work, 0, sizeof(work));
+    for (i = 0; i < 3; i++)
+    {
+        int64_t a = triangle->edge_a[i], b = triangle->edge_b[i];
+        int64_t e = a * corner_x + b * corner_y + triangle->edge_c[i];
+        int64_t corner = e - a * reach - b * reach;
+        int64_t low = corner + (a < 0 ? a * span : 0) + (b < 0 ? b * span : 0);
+        int64_t high = corner + (a > 0 ? a * span : 0) + (b > 0 ? b * span : 0);
+
+        if (high < 0)
+            return;
+        if (low < 0)
+        {
+            // the edge crosses the tile, so its values in it are small enough for 32 bits
+            work.edge[i] = (int32_t)e;
+            work.step_x[i] = (int32_t)(a * SUBPIXELS);
+            work.step_y[i] = (int32_t)(b * SUBPIXELS);
+            for (s = 0; msaa && s < RASTER_MSAA_SAMPLES; s++)
+                work.sample_edge[i][s] = (int32_t)(a * sample_offsets[s][0] + b * sample_offsets[s][1]);
+            partial = 1;
+        }
+    }
+    stats->tiles_tested++;
+
+    // the triangle's depth range over the tile's samples. sample depths are clamped into it, so
+    // the tile decisions below agree exactly with what testing every sample would decide
+    float margin = (float)reach / SUBPIXELS;
+    float center = triangle->depth[0] + triangle->depth[1] * (x0 - margin) + triangle->depth[2] * (y0 - margin);
+    float dx = triangle->depth[1] * (RASTER_TILE_SIZE - 1 + 2.0f * margin),
+        dy = triangle->depth[2] * (RASTER_TILE_SIZE - 1 + 2.0f * margin);
+    float low = center + (dx < 0.0f ? dx : 0.0f) + (dy < 0.0f ? dy : 0.0f);
+    float high = center + (dx > 0.0f ? dx : 0.0f) + (dy > 0.0f ? dy : 0.0f);
+    low = low > triangle->depth_min ? low : triangle->depth_min;
+    high = high < triangle->depth_max ? high : triangle->depth_max;
+    low = low < high ? low : high;
+    int depth_test = 1;
+    if (target->hierarchical_z)
+    {
+        if (high <= target->tile_far[tile])
+        {
+            stats->tiles_rejected++;
+            return;
+        }
+        depth_test = !(low > target->tile_near[tile]);
+        stats->tiles_accepted += !depth_test;
+    }
+
+    work.triangle = triangle;
+    work.color = target->color + (size_t)tile * TILE_PIXELS;
+    work.depth = target->depth + (size_t)tile * TILE_PIXELS;
+    work.x0 = x0;
+    work.y0 = y0;
+    work.width = target->width - x0 < RASTER_TILE_SIZE ? target->width - x0 : RASTER_TILE_SIZE;
+    work.height = target->height - y0 < RASTER_TILE_SIZE ? target->height - y0 : RASTER_TILE_SIZE;
+    work.depth_low = low;
+    work.depth_high = high;
+    if (msaa)
+    {
+        work.simd = target->simd;
+        work.edges = target->tile_edges[tile];
+        work.sample_color = target->sample_color + (size_t)tile * TILE_PIXELS * RASTER_MSAA_SAMPLES;
+        work.sample_depth = target->sample_depth + (size_t)tile * TILE_PIXELS * RASTER_MSAA_SAMPLES;
+        for (s = 0; s < RASTER_MSAA_SAMPLES; s++)
+            work.sample_z[s] = (triangle->depth[1] * sample_offsets[s][0] + triangle->depth[2] * sample_offsets[s][1]) /
+                SUBPIXELS;
+    }
+    if (target->specialized)
+        kernels[(((triangle->pipeline.shader * 2 + triangle->pipeline.blend) * 2 + msaa) * 2 + depth_test) * 2 +
+            partial](&work);
+    else
+        shade_generic(&work, triangle->pipeline.shader, triangle->pipeline.blend, msaa, depth_test, partial);
+    stats->pixels_tested += work.pixels_tested;
+    stats->pixels_rejected += work.pixels_rejected;
+    stats->fragments += work.fragments;
+    if (msaa)
+        target->tile_edges[tile] = work.edges;
+
+    if (work.fragments && triangle->pipeline.blend == RASTER_BLEND_NONE)
+    {
+        float nearest = 0.0f, farthest = 1.0f;
+        uint64_t edges = work.edges;
+
+        for (y = 0; y < work.height; y++)
+        {
+            for (x = 0; x < work.width; x++)
+            {
+                float z = work.depth[y * RASTER_TILE_SIZE + x];
+                nearest = z > nearest ? z : nearest;
+                farthest = z < farthest ? z : farthest;
+            }
+        }
+        // an edge pixel's own depth is stale, which only makes the range wider than it needs to be
+        while (edges)
+        {
+            const float *z = &work.sample_depth[__builtin_ctzll(edges) * RASTER_MSAA_SAMPLES];
+
+            for (s = 0; s < RASTER_MSAA_SAMPLES; s++)
+            {
+                nearest = z[s] > nearest ? z[s] : nearest;
+                farthest = z[s] < farthest ? z[s] : farthest;
+            }
+            edges &= edges - 1;
+        }
+        target->tile_near[tile] = nearest;
+        target->tile_far[tile] = farthest;
+    }
+}
+
+static void rasterize_bin(void *arg, unsigned int index)
+{
+    struct raster_target *target = (struct raster_target *)arg;
+    unsigned int i;
+
+    if (target->reverse_bins)
+        index = (unsigned int)(target->bins_x * target->bins_y) - 1 - index;
+    struct raster_bin *bin = &target->bins[index];
+    int bin_x0 = (int)(index % target->bins_x) * RASTER_BIN_SIZE, bin_y0 = (int)(index / target->bins_x) * RASTER_BIN_SIZE;
+    memset(&bin->stats, 0, sizeof(bin->stats));
+    for (i = 0; i < bin->count; i++)
+    {
+        const struct raster_triangle *triangle = &target->triangles[bin->triangles[i]];
+        int min_x = triangle->min_x > bin_x0 ? triangle->min_x : bin_x0;
+        int min_y = triangle->min_y > bin_y0 ? triangle->min_y : bin_y0;
+        int max_x = triangle->max_x < bin_x0 + RASTER_BIN_SIZE - 1 ? triangle->max_x : bin_x0 + RASTER_BIN_SIZE - 1;
+        int max_y = triangle->max_y < bin_y0 + RASTER_BIN_SIZE - 1 ? triangle->max_y : bin_y0 + RASTER_BIN_SIZE - 1;
+        int tx, ty;
+
+        for (ty = min_y / RASTER_TILE_SIZE; ty <= max_y / RASTER_TILE_SIZE; ty++)
+        {
+            for (tx = min_x / RASTER_TILE_SIZE; tx <= max_x / RASTER_TILE_SIZE; tx++)
+                rasterize_tile(target, triangle, ty * target->tiles_x + tx, tx * RASTER_TILE_SIZE,
+                    ty * RASTER_TILE_SIZE, &bin->stats);
+        }
+    }
+    bin->count = 0;
+}
+
+void raster_flush(struct raster_target *target)
+{
+    unsigned int bin_count = (unsigned int)(target->bins_x * target->bins_y), i;
+
+    if (target->triangle_count == 0)
+        return;
+    if (target->pool != NULL)
+        thread_pool_parallel_for(target->pool, bin_count, rasterize_bin, target);
+    else
+    {
+        for (i = 0; i < bin_count; i++)
+            rasterize_bin(target, i);
+    }
+    for (i = 0; i < bin_count; i++)
+    {
+        const struct raster_stats *stats = &target->bins[i].stats;
+
+        target->stats.tiles_tested += stats->tiles_tested;
+        target->stats.tiles_rejected += stats->tiles_rejected;
+        target->stats.tiles_accepted += stats->tiles_accepted;
+        target->stats.pixels_tested += stats->pixels_tested;
+        target->stats.pixels_rejected += stats->pixels_rejected;
+        target->stats.fragments += stats->fragments;
+    }
+    target->triangle_count = 0;
+}
+
+// the average of an edge pixel's samples, channel by channel
+static uint32_t resolve_samples(const uint32_t *samples)
+{
+    uint32_t out = 0;
+    int shift, s;
+
+    for (shift = 0; shift < 32; shift += 8)
+    {
+        uint32_t sum = RASTER_MSAA_SAMPLES / 2;
+
+        for (s = 0; s < RASTER_MSAA_SAMPLES; s++)
+            sum += (samples[s] >> shift) & 0xff;
+        out |= sum / RASTER_MSAA_SAMPLES << shift;
+    }
+    return out;
+}
+
+void raster_read_pixels(const struct raster_target *target, unsigned char *rgba)
+{
+    int x, y;
+
+    for (y = 0; y < target->height; y++)
+    {
+        for (x = 0; x < target->width; x++)
+        {
+            int tile = (y / RASTER_TILE_SIZE) * target->tiles_x + x / RASTER_TILE_SIZE;
+            int k = (y % RASTER_TILE_SIZE) * RASTER_TILE_SIZE + x % RASTER_TILE_SIZE;
+            uint32_t c = target->color[(size_t)tile * TILE_PIXELS + k];
+            unsigned char *out = rgba + ((size_t)y * target->width + x) * 4;
+
+            if (target->tile_edges != NULL && (target->tile_edges[tile] & ((uint64_t)1 << k)))
+                c = resolve_samples(target->sample_color + ((size_t)tile * TILE_PIXELS + k) * RASTER_MSAA_SAMPLES);
+
+            out[0] = (unsigned char)c;
+            out[1] = (unsigned char)(c >> 8);
+            out[2] = (unsigned char)(c >> 16);
+            out[3] = (unsigned char)(c >> 24);
+        }
+    }
+}
@@ -0,0 +1,296 @@
+#include <glad/glad.h>
+#include <render_pool.h>
+#include <thread_pool.h>
+
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <string.h>
+
+// the part of EGL 1.5 the pool uses, declared here since EGL is only opened at run time
+typedef void *EGLDisplay;
+typedef void *EGLContext;
+typedef void *EGLConfig;
+typedef void *EGLSurface;
+typedef int EGLint;
+typedef unsigned int EGLBoolean;
+typedef unsigned int EGLenum;
+
+#define EGL_NONE 0x3038
+#define EGL_OPENGL_API 0x30A2
+#define EGL_CONTEXT_MAJOR_VERSION 0x3098
+#define EGL_CONTEXT_MINOR_VERSION 0x30FB
+#define EGL_CONTEXT_OPENGL_PROFILE_MASK 0x30FD
+#define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT 0x1
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+
+struct egl
+{
+    void *library;
+    void *(*GetProcAddress)(const char *name);
+    EGLDisplay (*GetDisplay)(void *native);
+    EGLDisplay (*GetPlatformDisplayEXT)(EGLenum platform, void *native, const EGLint *attributes);
+    EGLBoolean (*Initialize)(EGLDisplay display, EGLint *major, EGLint *minor);
+    EGLBoolean (*BindAPI)(EGLenum api);
+    EGLContext (*CreateContext)(EGLDisplay display, EGLConfig config, EGLContext share, const EGLint *attributes);
+    EGLBoolean (*DestroyContext)(EGLDisplay display, EGLContext context);
+    EGLBoolean (*MakeCurrent)(EGLDisplay display, EGLSurface draw, EGLSurface read, EGLContext context);
+    EGLBoolean (*ReleaseThread)(void);
+};
+
+// opened once per process and never closed: glad keeps calling through eglGetProcAddress
+static struct egl egl;
+static pthread_once_t egl_once = PTHREAD_ONCE_INIT;
+
+static void open_egl(void)
+{
+    void *library = dlopen("libEGL.so.1", RTLD_NOW | RTLD_GLOBAL);
+
+    if (library == NULL)
+        library = dlopen("libEGL.so", RTLD_NOW | RTLD_GLOBAL);
+    if (library == NULL)
+        return;
+    *(void **)&egl.GetProcAddress = dlsym(library, "eglGetProcAddress");
+    *(void **)&egl.GetDisplay = dlsym(library, "eglGetDisplay");
+    *(void **)&egl.Initialize = dlsym(library, "eglInitialize");
+    *(void **)&egl.BindAPI = dlsym(library, "eglBindAPI");
+    *(void **)&egl.CreateContext = dlsym(library, "eglCreateContext");
+    *(void **)&egl.DestroyContext = dlsym(library, "eglDestroyContext");
+    *(void **)&egl.MakeCurrent = dlsym(library, "eglMakeCurrent");
+    *(void **)&egl.ReleaseThread = dlsym(library, "eglReleaseThread");
+    if (egl.GetProcAddress == NULL || egl.GetDisplay == NULL || egl.Initialize == NULL || egl.BindAPI == NULL ||
+        egl.CreateContext == NULL || egl.DestroyContext == NULL || egl.MakeCurrent == NULL ||
+        egl.ReleaseThread == NULL)
+        return;
+    *(void **)&egl.GetPlatformDisplayEXT = egl.GetProcAddress("eglGetPlatformDisplayEXT");
+    egl.library = library;
+}
+
+// a 3.3 core context sharing objects with share, without a config (EGL_KHR_no_config_context) or
+// a surface (EGL_KHR_surfaceless_context): workers only draw into framebuffer objects
+static EGLContext create_context(EGLDisplay display, EGLContext share)
+{
+    static const EGLint attributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+
+    return egl.CreateContext(display, NULL, share, attributes);
+}
+
+static int create_framebuffer(struct render_worker *worker)
+{
+    const struct render_pool *pool = worker->pool;
+
+    glGenRenderbuffers(1, &worker->color);
+    glBindRenderbuffer(GL_RENDERBUFFER, worker->color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, pool->width, pool->height);
+    glGenRenderbuffers(1, &worker->depth);
+    glBindRenderbuffer(GL_RENDERBUFFER, worker->depth);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT32F, pool->width, pool->height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    glGenFramebuffers(1, &worker->framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, worker->framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, worker->color);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, worker->depth);
+    return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+}
+
+static void *worker_main(void *arg)
+{
+    struct render_worker *worker = (struct render_worker *)arg;
+    struct render_pool *pool = worker->pool;
+    unsigned int batch = 0;
+    int started;
+
+    started = egl.BindAPI(EGL_OPENGL_API) && egl.MakeCurrent(pool->display, NULL, NULL, worker->context) &&
+        create_framebuffer(worker);
+
+    pthread_mutex_lock(&pool->lock);
+    worker->started = started ? 1 : -1;
+    pthread_cond_broadcast(&pool->finished);
+    for (;;)
+    {
+        while (pool->batch == batch && !pool->quit)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        if (pool->quit)
+            break;
+        batch = pool->batch;
+
+        if (pool->each)
+        {
+            pthread_mutex_unlock(&pool->lock);
+            pool->fn(worker, pool->arg, worker->index);
+            pthread_mutex_lock(&pool->lock);
+            pool->done++;
+        }
+        while (!pool->each && pool->next < pool->count)
+        {
+            unsigned int index = pool->next++;
+
+            pthread_mutex_unlock(&pool->lock);
+            glBindFramebuffer(GL_FRAMEBUFFER, worker->framebuffer);
+            glViewport(0, 0, pool->width, pool->height);
+            pool->fn(worker, pool->arg, index);
+            pthread_mutex_lock(&pool->lock);
+            pool->done++;
+        }
+        if (pool->done == pool->count)
+            pthread_cond_broadcast(&pool->finished);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    if (started)
+    {
+        glDeleteFramebuffers(1, &worker->framebuffer);
+        glDeleteRenderbuffers(1, &worker->color);
+        glDeleteRenderbuffers(1, &worker->depth);
+    }
+    egl.MakeCurrent(pool->display, NULL, NULL, NULL);
+    egl.ReleaseThread();
+    return NULL;
+}
+
+int render_pool_init(struct render_pool *pool, unsigned int worker_count, int width, int height)
+{
+    unsigned int i;
+    int ok = 1;
+
+    memset(pool, 0, sizeof(*pool));
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->finished, NULL);
+    pool->width = width;
+    pool->height = height;
+    if (width < 1 || height < 1)
+    {
+        render_pool_shutdown(pool);
+        return 0;
+    }
+    pthread_once(&egl_once, open_egl);
+    if (egl.library == NULL)
+    {
+        render_pool_shutdown(pool);
+        return 0;
+    }
+
+    // surfaceless where Mesa offers it, so no X server or GPU device is needed
+    if (egl.GetPlatformDisplayEXT != NULL)
+        pool->display = egl.GetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, NULL, NULL);
+    if (pool->display == NULL)
+        pool->display = egl.GetDisplay(NULL);
+    if (pool->display == NULL || !egl.Initialize(pool->display, NULL, NULL) || !egl.BindAPI(EGL_OPENGL_API))
+    {
+        render_pool_shutdown(pool);
+        return 0;
+    }
+    pool->shared_context = create_context(pool->display, NULL);
+    if (pool->shared_context == NULL || !egl.MakeCurrent(pool->display, NULL, NULL, pool->shared_context))
+    {
+        render_pool_shutdown(pool);
+        return 0;
+    }
+    ok = gladLoadGLLoaderLazy((GLADloadproc)egl.GetProcAddress);
+    egl.MakeCurrent(pool->display, NULL, NULL, NULL);
+
+    if (worker_count == 0)
+        worker_count = thread_pool_cpu_count();
+    pool->workers = (struct render_worker *)calloc(worker_count, sizeof(*pool->workers));
+    for (i = 0; ok && pool->workers != NULL && i < worker_count; i++)
+    {
+        struct render_worker *worker = &pool->workers[i];
+
+        worker->pool = pool;
+        worker->index = i;
+        worker->context = create_context(pool->display, pool->shared_context);
+        if (worker->context == NULL)
+            break;
+        if (pthread_create(&worker->thread, NULL, worker_main, worker) != 0)
+        {
+            egl.DestroyContext(pool->display, worker->context);
+            worker->context = NULL;
+            break;
+        }
+    }
+    pool->worker_count = i;
+
+    // every worker has to be up before the first batch; one that couldn't start fails the pool
+    pthread_mutex_lock(&pool->lock);
+    for (i = 0; i < pool->worker_count; i++)
+    {
+        while (pool->workers[i].started == 0)
+            pthread_cond_wait(&pool->finished, &pool->lock);
+        ok = ok && pool->workers[i].started > 0;
+    }
+    pthread_mutex_unlock(&pool->lock);
+    if (!ok || pool->worker_count < worker_count)
+    {
+        render_pool_shutdown(pool);
+        return 0;
+    }
+    return 1;
+}
+
+void render_pool_shutdown(struct render_pool *pool)
+{
+    unsigned int i;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (i = 0; i < pool->worker_count; i++)
+    {
+        pthread_join(pool->workers[i].thread, NULL);
+        egl.DestroyContext(pool->display, pool->workers[i].context);
+    }
+    if (pool->shared_context != NULL)
+        egl.DestroyContext(pool->display, pool->shared_context);
+    // the display stays initialized: EGL hands every pool in the process the same one
+
+    free(pool->workers);
+    pthread_cond_destroy(&pool->finished);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    memset(pool, 0, sizeof(*pool));
+}
+
+int render_pool_begin_shared(struct render_pool *pool)
+{
+    return egl.MakeCurrent(pool->display, NULL, NULL, pool->shared_context) != 0;
+}
+
+void render_pool_end_shared(struct render_pool *pool)
+{
+    glFinish();
+    egl.MakeCurrent(pool->display, NULL, NULL, NULL);
+}
+
+static void run_batch(struct render_pool *pool, unsigned int count, render_pool_fn fn, void *arg, int each)
+{
+    if (count == 0)
+        return;
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->arg = arg;
+    pool->count = count;
+    pool->next = 0;
+    pool->done = 0;
+    pool->each = each;
+    pool->batch++;
+    pthread_cond_broadcast(&pool->wake);
+    while (pool->done < pool->count)
+        pthread_cond_wait(&pool->finished, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void render_pool_run(struct render_pool *pool, unsigned int count, render_pool_fn fn, void *arg)
+{
+    run_batch(pool, count, fn, arg, 0);
+}
+
+void render_pool_each(struct render_pool *pool, render_pool_fn fn, void *arg)
+{
+    run_batch(pool, pool->worker_count, fn, arg, 1);
+}
@@ -0,0 +1,263 @@
+#include <render_queue.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct sort_entry
+{
+    unsigned int program;
+    unsigned int vao;
+    unsigned int texture;
+    float distance;
+    unsigned int index;
+};
+
+void render_mesh_create(struct render_mesh *mesh, const struct mesh_data *data)
+{
+    const GLsizei stride = sizeof(struct mesh_vertex);
+
+    memset(mesh, 0, sizeof(*mesh));
+    mesh->index_count = data->index_count;
+    glGenVertexArrays(1, &mesh->vao);
+    glGenBuffers(1, &mesh->vertex_buffer);
+    glGenBuffers(1, &mesh->index_buffer);
+    glBindVertexArray(mesh->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->vertex_buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(struct mesh_vertex) * data->vertex_count, data->vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->index_buffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * data->index_count, data->indices, GL_STATIC_DRAW);
+    glVertexAttribPointer(RENDER_MESH_POSITION_LOCATION, 3, GL_FLOAT, GL_FALSE, stride,
+        (const void *)offsetof(struct mesh_vertex, position));
+    glEnableVertexAttribArray(RENDER_MESH_POSITION_LOCATION);
+    glVertexAttribPointer(RENDER_MESH_UV_LOCATION, 2, GL_FLOAT, GL_FALSE, stride,
+        (const void *)offsetof(struct mesh_vertex, uv));
+    glEnableVertexAttribArray(RENDER_MESH_UV_LOCATION);
+    glVertexAttribPointer(RENDER_MESH_NORMAL_LOCATION, 3, GL_FLOAT, GL_FALSE, stride,
+        (const void *)offsetof(struct mesh_vertex, normal));
+    glEnableVertexAttribArray(RENDER_MESH_NORMAL_LOCATION);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void render_mesh_destroy(struct render_mesh *mesh)
+{
+    glDeleteVertexArrays(1, &mesh->vao);
+    glDeleteBuffers(1, &mesh->vertex_buffer);
+    glDeleteBuffers(1, &mesh->index_buffer);
+    memset(mesh, 0, sizeof(*mesh));
+}
+
+void render_queue_init(struct render_queue *queue, struct ring_buffer *stream)
+{
+    memset(queue, 0, sizeof(*queue));
+    queue->stream = stream;
+}
+
+void render_queue_shutdown(struct render_queue *queue)
+{
+    free(queue->items);
+    free(queue->runs);
+    memset(queue, 0, sizeof(*queue));
+}
+
+void render_queue_set_eye(struct render_queue *queue, const float *eye)
+{
+    memcpy(queue->eye, eye, sizeof(queue->eye));
+}
+
+int render_queue_submit(struct render_queue *queue, unsigned int program, const struct render_mesh *mesh,
+    unsigned int texture, const struct render_instance *instance)
+{
+    if (program == 0)
+        return 1;
+    if (queue->count == queue->capacity)
+    {
+        unsigned int capacity = queue->capacity ? queue->capacity * 2 : 64;
+        struct render_item *items = (struct render_item *)realloc(queue->items, sizeof(*items) * capacity);
+        if (items == NULL)
+            return 0;
+        queue->items = items;
+        queue->capacity = capacity;
+    }
+    queue->items[queue->count].program = program;
+    queue->items[queue->count].texture = texture;
+    queue->items[queue->count].mesh = mesh;
+    queue->items[queue->count].instance = *instance;
+    float dx = instance->model[12] - queue->eye[0], dy = instance->model[13] - queue->eye[1],
+        dz = instance->model[14] - queue->eye[2];
+    queue->items[queue->count].distance = dx * dx + dy * dy + dz * dz;
+    queue->count++;
+    return 1;
+}
+
+// program changes cost the most, then vertex layouts, then textures; nearest first inside a run
+static int compare_entries(const void *a, const void *b)
+{
+    const struct sort_entry *ea = (const struct sort_entry *)a, *eb = (const struct sort_entry *)b;
+
+    if (ea->program != eb->program)
+        return ea->program < eb->program ? -1 : 1;
+    if (ea->vao != eb->vao)
+        return ea->vao < eb->vao ? -1 : 1;
+    if (ea->texture != eb->texture)
+        return ea->texture < eb->texture ? -1 : 1;
+    if (ea->distance != eb->distance)
+        return ea->distance < eb->distance ? -1 : 1;
+    // keep submission order among equals
+    return ea->index < eb->index ? -1 : ea->index > eb->index;
+}
+
+// points the instance attributes of the bound VAO at offset in the stream buffer
+static void bind_instances(struct ring_buffer *stream, size_t offset)
+{
+    const GLsizei stride = sizeof(struct render_instance);
+    unsigned int column;
+
+    glBindBuffer(GL_ARRAY_BUFFER, stream->buffer);
+    for (column = 0; column < 4; column++)
+    {
+        glVertexAttribPointer(RENDER_INSTANCE_LOCATION + column, 4, GL_FLOAT, GL_FALSE, stride,
+            (const void *)(offset + offsetof(struct render_instance, model) + column * 4 * sizeof(float)));
+        glVertexAttribDivisor(RENDER_INSTANCE_LOCATION + column, 1);
+        glEnableVertexAttribArray(RENDER_INSTANCE_LOCATION + column);
+    }
+    glVertexAttribIPointer(RENDER_INSTANCE_LOCATION + 4, 1, GL_UNSIGNED_INT, stride,
+        (const void *)(offset + offsetof(struct render_instance, material)));
+    glVertexAttribDivisor(RENDER_INSTANCE_LOCATION + 4, 1);
+    glEnableVertexAttribArray(RENDER_INSTANCE_LOCATION + 4);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+static int add_run(struct render_queue *queue, const struct render_item *first, size_t offset)
+{
+    if (queue->run_count == queue->run_capacity)
+    {
+        unsigned int capacity = queue->run_capacity ? queue->run_capacity * 2 : 16;
+        struct render_run *runs = (struct render_run *)realloc(queue->runs, sizeof(*runs) * capacity);
+        if (runs == NULL)
+            return 0;
+        queue->runs = runs;
+        queue->run_capacity = capacity;
+    }
+    queue->runs[queue->run_count].program = first->program;
+    queue->runs[queue->run_count].mesh = first->mesh;
+    queue->runs[queue->run_count].texture = first->texture;
+    queue->runs[queue->run_count].offset = offset;
+    queue->runs[queue->run_count].instance_count = 0;
+    queue->run_count++;
+    return 1;
+}
+
+// program overrides the runs' own and skips their textures when nonzero
+static void draw_runs(struct render_queue *queue, unsigned int program)
+{
+    unsigned int current_program = 0, vao = 0, texture = 0, i;
+
+    for (i = 0; i < queue->run_count; i++)
+    {
+        const struct render_run *run = &queue->runs[i];
+        unsigned int run_program = program ? program : run->program;
+
+        if (run_program != current_program)
+        {
+            current_program = run_program;
+            glUseProgram(current_program);
+        }
+        if (run->mesh->vao != vao)
+        {
+            vao = run->mesh->vao;
+            glBindVertexArray(vao);
+        }
+        if (program == 0 && run->texture != texture)
+        {
+            texture = run->texture;
+            glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+            queue->texture_binds++;
+        }
+        bind_instances(queue->stream, run->offset);
+        glDrawElementsInstanced(GL_TRIANGLES, (GLsizei)run->mesh->index_count, GL_UNSIGNED_INT, 0,
+            (GLsizei)run->instance_count);
+        queue->draw_calls++;
+    }
+}
+
+void render_queue_flush(struct render_queue *queue)
+{
+    struct sort_entry *entries;
+    struct render_instance *instances;
+    size_t offset;
+    unsigned int i;
+
+    queue->draw_calls = 0;
+    queue->texture_binds = 0;
+    queue->run_count = 0;
+    if (queue->count == 0)
+        return;
+    entries = (struct sort_entry *)malloc(sizeof(*entries) * queue->count);
+    if (entries == NULL)
+    {
+        queue->count = 0;
+        return;
+    }
+    for (i = 0; i < queue->count; i++)
+    {
+        entries[i].program = queue->items[i].program;
+        entries[i].vao = queue->items[i].mesh->vao;
+        entries[i].texture = queue->items[i].texture;
+        entries[i].distance = queue->items[i].distance;
+        entries[i].index = i;
+    }
+    qsort(entries, queue->count, sizeof(*entries), compare_entries);
+
+    // every instance of the frame in one allocation, sorted; runs are slices of it
+    instances = (struct render_instance *)ring_buffer_map(queue->stream,
+        sizeof(struct render_instance) * queue->count, sizeof(float) * 4, &offset);
+    if (instances == NULL)
+    {
+        free(entries);
+        queue->count = 0;
+        return;
+    }
+    for (i = 0; i < queue->count; i++)
+    {
+        const struct render_item *item = &queue->items[entries[i].index];
+        const struct render_run *run = queue->run_count ? &queue->runs[queue->run_count - 1] : NULL;
+
+        if (run == NULL || item->program != run->program || item->mesh->vao != run->mesh->vao ||
+            item->texture != run->texture)
+        {
+            if (!add_run(queue, item, offset + sizeof(struct render_instance) * i))
+                break;
+        }
+        instances[i] = item->instance;
+        queue->runs[queue->run_count - 1].instance_count++;
+    }
+    ring_buffer_unmap(queue->stream);
+    free(entries);
+    queue->count = 0;
+
+    if (queue->prepass_program)
+    {
+        GLint depth_func;
+
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        draw_runs(queue, queue->prepass_program);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glGetIntegerv(GL_DEPTH_FUNC, &depth_func);
+        glDepthFunc(GL_EQUAL);
+        glDepthMask(GL_FALSE);
+        draw_runs(queue, 0);
+        glDepthMask(GL_TRUE);
+        glDepthFunc((GLenum)depth_func);
+    }
+    else
+    {
+        draw_runs(queue, 0);
+    }
+}
+
+void render_queue_replay(struct render_queue *queue, unsigned int program)
+{
+    draw_runs(queue, program);
+}
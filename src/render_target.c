@@ -0,0 +1,74 @@
+#include <glad/glad.h>
+#include <render_target.h>
+
+#include <string.h>
+
+static int allocate(struct render_target *target, int width, int height)
+{
+    target->width = width > 0 ? width : 1;
+    target->height = height > 0 ? height : 1;
+    glBindTexture(GL_TEXTURE_2D, target->color);
+    glTexImage2D(GL_TEXTURE_2D, 0, (GLint)target->color_format, target->width, target->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glBindTexture(GL_TEXTURE_2D, target->depth);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32F, target->width, target->height, 0, GL_DEPTH_COMPONENT,
+        GL_FLOAT, NULL);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target->color, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, target->depth, 0);
+    int complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return complete;
+}
+
+static void set_sampling(unsigned int texture)
+{
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+}
+
+int render_target_init(struct render_target *target, int width, int height, unsigned int color_format)
+{
+    memset(target, 0, sizeof(*target));
+    target->color_format = color_format;
+    glGenFramebuffers(1, &target->framebuffer);
+    glGenTextures(1, &target->color);
+    glGenTextures(1, &target->depth);
+    set_sampling(target->color);
+    set_sampling(target->depth);
+    return allocate(target, width, height);
+}
+
+void render_target_destroy(struct render_target *target)
+{
+    glDeleteFramebuffers(1, &target->framebuffer);
+    glDeleteTextures(1, &target->color);
+    glDeleteTextures(1, &target->depth);
+    memset(target, 0, sizeof(*target));
+}
+
+int render_target_resize(struct render_target *target, int width, int height)
+{
+    if (width == target->width && height == target->height)
+        return 1;
+    return allocate(target, width, height);
+}
+
+void render_target_bind(const struct render_target *target)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+    glViewport(0, 0, target->width, target->height);
+}
+
+void render_target_present(const struct render_target *target, int width, int height)
+{
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, target->framebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, target->width, target->height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, width, height);
+}
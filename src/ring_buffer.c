@@ -0,0 +1,131 @@
+#include <ring_buffer.h>
+
+#include <string.h>
+
+// creates the buffer: with ARB_buffer_storage it is allocated immutable and mapped once, persistently
+// and coherently, so writes need no driver call at all. on plain 3.3 each range is mapped unsynchronized
+// which skips the implicit wait, the fences take over that job.
+int ring_buffer_create(struct ring_buffer *ring, size_t partition_size)
+{
+    size_t total = partition_size * RING_BUFFER_PARTITIONS;
+
+    memset(ring, 0, sizeof(*ring));
+    ring->partition_size = partition_size;
+
+    glGenBuffers(1, &ring->buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+
+    if (GLAD_GL_ARB_buffer_storage)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_COPY_WRITE_BUFFER, (GLsizeiptr)total, NULL, flags);
+        ring->persistent_ptr = (unsigned char *)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, (GLsizeiptr)total, flags);
+        ring->persistent = ring->persistent_ptr != NULL;
+    }
+    if (!ring->persistent)
+    {
+        // buffer storage is immutable, so a failed persistent map needs a fresh buffer
+        if (GLAD_GL_ARB_buffer_storage)
+        {
+            glDeleteBuffers(1, &ring->buffer);
+            glGenBuffers(1, &ring->buffer);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+        }
+        glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)total, NULL, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    return ring->buffer != 0;
+}
+
+void ring_buffer_destroy(struct ring_buffer *ring)
+{
+    unsigned int i;
+
+    for (i = 0; i < RING_BUFFER_PARTITIONS; i++)
+    {
+        if (ring->fences[i])
+            glDeleteSync(ring->fences[i]);
+    }
+    if (ring->persistent || ring->mapped)
+    {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+    glDeleteBuffers(1, &ring->buffer);
+    memset(ring, 0, sizeof(*ring));
+}
+
+void ring_buffer_begin_frame(struct ring_buffer *ring)
+{
+    GLsync fence = ring->fences[ring->partition];
+
+    ring->head = 0;
+    if (!fence)
+        return;
+
+    // with three partitions in flight this is normally already signaled; the first wait flushes
+    // so we can never block on commands that have not been submitted yet
+    GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+    for (;;)
+    {
+        GLenum status = glClientWaitSync(fence, flags, 1000000);
+        if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED || status == GL_WAIT_FAILED)
+            break;
+        flags = 0;
+    }
+    glDeleteSync(fence);
+    ring->fences[ring->partition] = NULL;
+}
+
+void ring_buffer_end_frame(struct ring_buffer *ring)
+{
+    ring_buffer_unmap(ring);
+    ring->fences[ring->partition] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ring->partition = (ring->partition + 1) % RING_BUFFER_PARTITIONS;
+}
+
+void *ring_buffer_map(struct ring_buffer *ring, size_t size, size_t alignment, size_t *offset)
+{
+    size_t head = ring->head;
+    size_t base = ring->partition * ring->partition_size;
+
+    if (alignment > 1)
+        head = (head + alignment - 1) / alignment * alignment;
+    if (head + size > ring->partition_size)
+        return NULL;
+
+    if (ring->persistent)
+    {
+        ring->head = head + size;
+        *offset = base + head;
+        return ring->persistent_ptr + base + head;
+    }
+
+    // only one range may be mapped at a time on the 3.3 path
+    ring_buffer_unmap(ring);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+    void *ptr = glMapBufferRange(GL_COPY_WRITE_BUFFER, (GLintptr)(base + head), (GLsizeiptr)size,
+        GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    ring->mapped = ptr != NULL;
+    // the space is only taken once the map succeeded, so a failed one can be retried
+    if (ptr != NULL)
+    {
+        ring->head = head + size;
+        *offset = base + head;
+    }
+    return ptr;
+}
+
+void ring_buffer_unmap(struct ring_buffer *ring)
+{
+    if (!ring->mapped)
+        return;
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    ring->mapped = 0;
+}
@@ -0,0 +1,69 @@
+#include <glad/glad.h>
+#include <shader.h>
+
+static unsigned int create_stage(GLenum type, const char *source)
+{
+    unsigned int shader = glCreateShader(type);
+
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    return shader;
+}
+
+unsigned int shader_begin_program(const char *vertex_source, const char *fragment_source, int retrievable)
+{
+    unsigned int program = glCreateProgram();
+
+    if (retrievable && GLAD_GL_ARB_get_program_binary)
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glAttachShader(program, create_stage(GL_VERTEX_SHADER, vertex_source));
+    glAttachShader(program, create_stage(GL_FRAGMENT_SHADER, fragment_source));
+    glLinkProgram(program);
+    return program;
+}
+
+unsigned int shader_end_program(unsigned int program, char *info_log, size_t log_size)
+{
+    int success = 1, linked;
+    unsigned int shaders[2];
+    GLsizei count = 0, i;
+
+    if (log_size > 0)
+        info_log[0] = '\0';
+
+    // check for shader compile errors; the compile log says more than the link log would
+    glGetAttachedShaders(program, 2, &count, shaders);
+    for (i = 0; i < count; i++)
+    {
+        int compiled;
+        glGetShaderiv(shaders[i], GL_COMPILE_STATUS, &compiled);
+        if (!compiled && success)
+        {
+            glGetShaderInfoLog(shaders[i], (GLsizei)log_size, NULL, info_log);
+            success = 0;
+        }
+        glDetachShader(program, shaders[i]);
+        glDeleteShader(shaders[i]);
+    }
+
+    // check for linking errors
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (success && !linked)
+    {
+        glGetProgramInfoLog(program, (GLsizei)log_size, NULL, info_log);
+        success = 0;
+    }
+    if (!success)
+    {
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+unsigned int shader_build_program(const char *vertex_source, const char *fragment_source,
+    int retrievable, char *info_log, size_t log_size)
+{
+    return shader_end_program(shader_begin_program(vertex_source, fragment_source, retrievable),
+        info_log, log_size);
+}
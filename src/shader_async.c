@@ -0,0 +1,242 @@
+#include <shader.h>
+#include <shader_async.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+static char *copy_string(const char *str)
+{
+    size_t len = strlen(str ? str : "") + 1;
+    char *copy = (char *)malloc(len);
+
+    if (copy != NULL)
+        memcpy(copy, str ? str : "", len);
+    return copy;
+}
+
+static void *worker_main(void *arg)
+{
+    struct shader_compiler *compiler = (struct shader_compiler *)arg;
+
+    compiler->make_current(compiler->worker_context);
+    for (;;)
+    {
+        struct shader_job *job;
+
+        pthread_mutex_lock(&compiler->lock);
+        while (compiler->queue_head == NULL && !compiler->quit)
+            pthread_cond_wait(&compiler->wake, &compiler->lock);
+        if (compiler->quit)
+        {
+            pthread_mutex_unlock(&compiler->lock);
+            break;
+        }
+        job = compiler->queue_head;
+        compiler->queue_head = job->queue_next;
+        if (compiler->queue_head == NULL)
+            compiler->queue_tail = NULL;
+        pthread_mutex_unlock(&compiler->lock);
+
+        // a copy of the cache's settings, so the hit and miss counters this bumps are the job's;
+        // the render thread adds them to the real ones when it retires the job
+        struct shader_cache cache;
+        memset(&cache, 0, sizeof(cache));
+        memcpy(cache.directory, compiler->cache->directory, sizeof(cache.directory));
+        cache.driver_hash = compiler->cache->driver_hash;
+        cache.enabled = compiler->cache->enabled;
+        unsigned int program = shader_cache_program(&cache, job->vertex_source,
+            job->fragment_source, job->defines, job->info_log, sizeof(job->info_log));
+        // sync objects are shared, so the render thread can tell when the link really finished
+        GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        pthread_mutex_lock(&compiler->lock);
+        job->program = program;
+        job->fence = fence;
+        job->cache_hits = cache.hits;
+        job->cache_misses = cache.misses;
+        job->worker_done = 1;
+        pthread_mutex_unlock(&compiler->lock);
+    }
+    compiler->make_current(NULL);
+    return NULL;
+}
+
+void shader_compiler_init(struct shader_compiler *compiler, struct shader_cache *cache,
+    void *worker_context, shader_context_fn make_current, void (*on_ready)(unsigned int program))
+{
+    memset(compiler, 0, sizeof(*compiler));
+    compiler->cache = cache;
+    compiler->on_ready = on_ready;
+    pthread_mutex_init(&compiler->lock, NULL);
+    pthread_cond_init(&compiler->wake, NULL);
+
+    if (GLAD_GL_KHR_parallel_shader_compile)
+    {
+        // let the driver use as many threads as it likes
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+        compiler->parallel = 1;
+    }
+    else if (GLAD_GL_ARB_parallel_shader_compile)
+    {
+        glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
+        compiler->parallel = 1;
+    }
+    else if (worker_context != NULL && make_current != NULL)
+    {
+        compiler->worker_context = worker_context;
+        compiler->make_current = make_current;
+        compiler->threaded = pthread_create(&compiler->thread, NULL, worker_main, compiler) == 0;
+    }
+}
+
+static void free_job(struct shader_job *job)
+{
+    if (job->fence)
+        glDeleteSync(job->fence);
+    if (job->program)
+        glDeleteProgram(job->program);
+    free(job->vertex_source);
+    free(job->fragment_source);
+    free(job->defines);
+    free(job);
+}
+
+void shader_compiler_shutdown(struct shader_compiler *compiler)
+{
+    struct shader_job *job, *next;
+
+    if (compiler->threaded)
+    {
+        pthread_mutex_lock(&compiler->lock);
+        compiler->quit = 1;
+        pthread_cond_signal(&compiler->wake);
+        pthread_mutex_unlock(&compiler->lock);
+        pthread_join(compiler->thread, NULL);
+    }
+
+    for (job = compiler->jobs; job != NULL; job = next)
+    {
+        next = job->next;
+        free_job(job);
+    }
+    pthread_cond_destroy(&compiler->wake);
+    pthread_mutex_destroy(&compiler->lock);
+    memset(compiler, 0, sizeof(*compiler));
+}
+
+static void finish_job(struct shader_compiler *compiler, struct shader_job *job)
+{
+    job->state = job->program ? SHADER_JOB_READY : SHADER_JOB_FAILED;
+    compiler->pending--;
+    if (job->program && compiler->on_ready != NULL)
+        compiler->on_ready(job->program);
+}
+
+struct shader_job *shader_compiler_submit(struct shader_compiler *compiler, const char *vertex_source,
+    const char *fragment_source, const char *defines)
+{
+    struct shader_job *job = (struct shader_job *)calloc(1, sizeof(*job));
+
+    if (job == NULL)
+        return NULL;
+    job->vertex_source = copy_string(vertex_source);
+    job->fragment_source = copy_string(fragment_source);
+    job->defines = copy_string(defines);
+    job->state = SHADER_JOB_PENDING;
+    job->next = compiler->jobs;
+    compiler->jobs = job;
+    compiler->pending++;
+
+    if (compiler->threaded)
+    {
+        pthread_mutex_lock(&compiler->lock);
+        if (compiler->queue_tail != NULL)
+            compiler->queue_tail->queue_next = job;
+        else
+            compiler->queue_head = job;
+        compiler->queue_tail = job;
+        pthread_cond_signal(&compiler->wake);
+        pthread_mutex_unlock(&compiler->lock);
+    }
+    else if (compiler->parallel)
+    {
+        // a cached binary loads quickly enough to take on the spot
+        job->key = shader_cache_key(compiler->cache, job->vertex_source, job->fragment_source, job->defines);
+        job->program = shader_cache_load(compiler->cache, job->key);
+        if (job->program)
+            finish_job(compiler, job);
+        else
+            job->program = shader_begin_program(job->vertex_source, job->fragment_source, compiler->cache->enabled);
+    }
+    else
+    {
+        job->program = shader_cache_program(compiler->cache, job->vertex_source, job->fragment_source,
+            job->defines, job->info_log, sizeof(job->info_log));
+        finish_job(compiler, job);
+    }
+    return job;
+}
+
+unsigned int shader_compiler_poll(struct shader_compiler *compiler)
+{
+    struct shader_job *job;
+
+    for (job = compiler->jobs; job != NULL && compiler->pending > 0; job = job->next)
+    {
+        if (job->state != SHADER_JOB_PENDING)
+            continue;
+
+        if (compiler->parallel)
+        {
+            int complete = 0;
+            glGetProgramiv(job->program, GL_COMPLETION_STATUS_KHR, &complete);
+            if (!complete)
+                continue;
+            job->program = shader_end_program(job->program, job->info_log, sizeof(job->info_log));
+            // counted and stored like shader_cache_program does, only while the cache is enabled
+            if (compiler->cache->enabled)
+            {
+                compiler->cache->misses++;
+                if (job->program)
+                    shader_cache_store(compiler->cache, job->key, job->program);
+            }
+            finish_job(compiler, job);
+        }
+        else if (compiler->threaded)
+        {
+            int done;
+            pthread_mutex_lock(&compiler->lock);
+            done = job->worker_done;
+            pthread_mutex_unlock(&compiler->lock);
+            if (!done)
+                continue;
+            GLenum status = glClientWaitSync(job->fence, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED && status != GL_WAIT_FAILED)
+                continue;
+            glDeleteSync(job->fence);
+            job->fence = NULL;
+            compiler->cache->hits += job->cache_hits;
+            compiler->cache->misses += job->cache_misses;
+            finish_job(compiler, job);
+        }
+    }
+    return compiler->pending;
+}
+
+void shader_compiler_release(struct shader_compiler *compiler, struct shader_job *job)
+{
+    struct shader_job **link;
+
+    if (job->state == SHADER_JOB_PENDING)
+        return;
+    for (link = &compiler->jobs; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == job)
+        {
+            *link = job->next;
+            free_job(job);
+            return;
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#include <glad/glad.h>
+#include <hash.h>
+#include <shader.h>
+#include <shader_cache.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#define make_directory(path) _mkdir(path)
+#else
+#define make_directory(path) mkdir(path, 0755)
+#endif
+
+#define SHADER_CACHE_MAGIC 0x42505347u    // "GSPB"
+
+// file layout: header followed by header.length bytes of driver binary
+struct cache_header
+{
+    uint32_t magic;
+    uint32_t format;
+    uint32_t length;
+    uint32_t reserved;
+    uint64_t key;
+};
+
+void shader_cache_init(struct shader_cache *cache, const char *directory)
+{
+    GLint formats = 0;
+
+    memset(cache, 0, sizeof(*cache));
+    snprintf(cache->directory, sizeof(cache->directory), "%s", directory);
+
+    cache->driver_hash = hash_string(HASH_SEED, (const char *)glGetString(GL_VENDOR));
+    cache->driver_hash = hash_string(cache->driver_hash, (const char *)glGetString(GL_RENDERER));
+    cache->driver_hash = hash_string(cache->driver_hash, (const char *)glGetString(GL_VERSION));
+
+    if (GLAD_GL_ARB_get_program_binary)
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    cache->enabled = formats > 0;
+    if (cache->enabled)
+        make_directory(cache->directory);
+}
+
+static void entry_path(const struct shader_cache *cache, uint64_t key, char *path, size_t size)
+{
+    snprintf(path, size, "%s/%016llx.bin", cache->directory, (unsigned long long)key);
+}
+
+unsigned int shader_cache_load(struct shader_cache *cache, uint64_t key)
+{
+    char path[320];
+    struct cache_header header;
+    unsigned int program = 0;
+    FILE *file;
+
+    if (!cache->enabled)
+        return 0;
+    entry_path(cache, key, path, sizeof(path));
+    file = fopen(path, "rb");
+    if (file == NULL)
+        return 0;
+
+    if (fread(&header, sizeof(header), 1, file) == 1 && header.magic == SHADER_CACHE_MAGIC && header.key == key)
+    {
+        void *binary = malloc(header.length);
+        if (binary != NULL && fread(binary, 1, header.length, file) == header.length)
+        {
+            int success;
+            program = glCreateProgram();
+            glProgramBinary(program, header.format, binary, (GLsizei)header.length);
+            glGetProgramiv(program, GL_LINK_STATUS, &success);
+            if (!success)
+            {
+                // the driver rejected it (e.g. changed internals without a version bump)
+                glDeleteProgram(program);
+                program = 0;
+            }
+        }
+        free(binary);
+    }
+    fclose(file);
+
+    if (program)
+        cache->hits++;
+    else
+        remove(path);
+    return program;
+}
+
+void shader_cache_store(struct shader_cache *cache, uint64_t key, unsigned int program)
+{
+    char path[320];
+    struct cache_header header;
+    GLint length = 0;
+    GLenum format;
+    FILE *file;
+
+    if (!cache->enabled)
+        return;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+    void *binary = malloc((size_t)length);
+    if (binary == NULL)
+        return;
+    glGetProgramBinary(program, length, NULL, &format, binary);
+
+    header.magic = SHADER_CACHE_MAGIC;
+    header.format = format;
+    header.length = (uint32_t)length;
+    header.reserved = 0;
+    header.key = key;
+
+    entry_path(cache, key, path, sizeof(path));
+    file = fopen(path, "wb");
+    if (file != NULL)
+    {
+        int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+            fwrite(binary, 1, (size_t)length, file) == (size_t)length;
+        fclose(file);
+        if (!ok)
+            remove(path);
+    }
+    free(binary);
+}
+
+uint64_t shader_cache_key(const struct shader_cache *cache, const char *vertex_source,
+    const char *fragment_source, const char *defines)
+{
+    uint64_t key = hash_string(cache->driver_hash, vertex_source);
+    key = hash_string(key, fragment_source);
+    return hash_string(key, defines);
+}
+
+unsigned int shader_cache_program(struct shader_cache *cache, const char *vertex_source,
+    const char *fragment_source, const char *defines, char *info_log, size_t log_size)
+{
+    unsigned int program;
+    uint64_t key;
+
+    if (!cache->enabled)
+        return shader_build_program(vertex_source, fragment_source, 0, info_log, log_size);
+
+    key = shader_cache_key(cache, vertex_source, fragment_source, defines);
+    program = shader_cache_load(cache, key);
+    if (program)
+        return program;
+
+    cache->misses++;
+    program = shader_build_program(vertex_source, fragment_source, 1, info_log, log_size);
+    if (program)
+        shader_cache_store(cache, key, program);
+    return program;
+}
@@ -0,0 +1,529 @@
+#include <hash.h>
+#include <shader_library.h>
+#include <vfs.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#define MAX_INCLUDE_DEPTH 16
+#define MAX_DEFINES 32
+
+// growable text buffer used while preprocessing
+struct text
+{
+    char *data;
+    size_t length;
+    size_t capacity;
+};
+
+static int text_append(struct text *text, const char *str, size_t length)
+{
+    if (text->length + length + 1 > text->capacity)
+    {
+        size_t capacity = text->capacity ? text->capacity : 1024;
+        while (text->length + length + 1 > capacity)
+            capacity *= 2;
+        char *data = (char *)realloc(text->data, capacity);
+        if (data == NULL)
+            return 0;
+        text->data = data;
+        text->capacity = capacity;
+    }
+    memcpy(text->data + text->length, str, length);
+    text->length += length;
+    text->data[text->length] = '\0';
+    return 1;
+}
+
+static char *copy_string(const char *str)
+{
+    size_t len = strlen(str) + 1;
+    char *copy = (char *)malloc(len);
+
+    if (copy != NULL)
+        memcpy(copy, str, len);
+    return copy;
+}
+
+static void free_source_set(struct shader_source_set *set)
+{
+    unsigned int i;
+
+    for (i = 0; i < set->file_count; i++)
+        free(set->files[i]);
+    free(set->files);
+    free(set);
+}
+
+static int grow(void **array, unsigned int *capacity, unsigned int count, size_t element)
+{
+    if (count < *capacity)
+        return 1;
+    unsigned int new_capacity = *capacity ? *capacity * 2 : 16;
+    void *data = realloc(*array, new_capacity * element);
+    if (data == NULL)
+        return 0;
+    *array = data;
+    *capacity = new_capacity;
+    return 1;
+}
+
+static int compare_strings(const void *a, const void *b)
+{
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+// "B, A=1  C" -> "A=1 B C" so equivalent define lists map to the same variant
+static char *normalize_defines(const char *defines)
+{
+    char *tokens[MAX_DEFINES];
+    char *scratch = copy_string(defines ? defines : "");
+    unsigned int count = 0, i;
+    struct text out = { NULL, 0, 0 };
+    char *token;
+
+    if (scratch == NULL)
+        return NULL;
+    for (token = strtok(scratch, " ,\t\n"); token != NULL && count < MAX_DEFINES; token = strtok(NULL, " ,\t\n"))
+        tokens[count++] = token;
+    qsort(tokens, count, sizeof(tokens[0]), compare_strings);
+
+    text_append(&out, "", 0);
+    for (i = 0; i < count; i++)
+    {
+        if (i > 0 && strcmp(tokens[i], tokens[i - 1]) == 0)
+            continue;
+        if (out.length > 0)
+            text_append(&out, " ", 1);
+        text_append(&out, tokens[i], strlen(tokens[i]));
+    }
+    free(scratch);
+    return out.data;
+}
+
+static int is_identifier_char(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// whether name appears as a whole identifier in source
+static int references(const char *source, const char *name, size_t length)
+{
+    const char *p = source;
+
+    while ((p = strstr(p, name)) != NULL)
+    {
+        if ((p == source || !is_identifier_char(p[-1])) && !is_identifier_char(p[length]))
+            return 1;
+        p += length;
+    }
+    return 0;
+}
+
+// splices "#define NAME VALUE" lines for a normalized define list into source at offset (just
+// after #version). defines the source never mentions cannot change the generated code, so they
+// are left out; that way variants differing only in irrelevant defines preprocess identically.
+static int inject_defines(struct text *source, size_t offset, const char *defines)
+{
+    struct text out = { NULL, 0, 0 };
+    char name[128];
+    const char *p = defines;
+
+    if (!text_append(&out, source->data, offset))
+        return 0;
+    while (*p)
+    {
+        size_t length = strcspn(p, " ");
+        size_t name_length = strcspn(p, "= ");
+        if (name_length > length)
+            name_length = length;
+        snprintf(name, sizeof(name), "%.*s", (int)name_length, p);
+        if (references(source->data + offset, name, strlen(name)))
+        {
+            text_append(&out, "#define ", 8);
+            text_append(&out, name, strlen(name));
+            if (name_length < length)
+            {
+                text_append(&out, " ", 1);
+                text_append(&out, p + name_length + 1, length - name_length - 1);
+            }
+            text_append(&out, "\n", 1);
+        }
+        p += length;
+        while (*p == ' ')
+            p++;
+    }
+    if (!text_append(&out, source->data + offset, source->length - offset))
+        return 0;
+    free(source->data);
+    *source = out;
+    return 1;
+}
+
+static void add_dependency(struct shader_source_set *set, const char *path)
+{
+    unsigned int i;
+
+    for (i = 0; i < set->file_count; i++)
+    {
+        if (strcmp(set->files[i], path) == 0)
+            return;
+    }
+    char **files = (char **)realloc(set->files, (set->file_count + 1) * sizeof(*files));
+    if (files == NULL)
+        return;
+    set->files = files;
+    set->files[set->file_count++] = copy_string(path);
+}
+
+// expands #include "file" recursively and records where the defines go (right after #version) in
+// define_offset. #line directives keep compile errors pointing at the right line; the source
+// string number is the file's index in the dependency list.
+static int preprocess(const struct shader_library *library, const char *file, size_t *define_offset,
+    int depth, struct text *out, struct shader_source_set *deps)
+{
+    char path[512];
+    char marker[64];
+    unsigned int file_index, line = 1;
+
+    if (depth > MAX_INCLUDE_DEPTH)
+    {
+        fprintf(stderr, "shader: includes nested too deep at %s\n", file);
+        return 0;
+    }
+    snprintf(path, sizeof(path), "%s/%s", library->directory, file);
+    char *source = (char *)vfs_read(path, NULL);
+    if (source == NULL)
+    {
+        fprintf(stderr, "shader: cannot read %s\n", path);
+        return 0;
+    }
+    add_dependency(deps, path);
+    for (file_index = 0; file_index + 1 < deps->file_count && strcmp(deps->files[file_index], path) != 0; file_index++)
+        ;
+
+    const char *p = source;
+    int ok = 1;
+    while (*p && ok)
+    {
+        const char *end = strchr(p, '\n');
+        size_t length = end ? (size_t)(end - p) + 1 : strlen(p);
+        const char *directive = p;
+
+        while (*directive == ' ' || *directive == '\t')
+            directive++;
+        if (strncmp(directive, "#include", 8) == 0)
+        {
+            const char *open = strchr(directive, '"');
+            const char *close = open ? strchr(open + 1, '"') : NULL;
+            if (close == NULL || close > p + length)
+            {
+                fprintf(stderr, "shader: %s:%u: malformed #include\n", path, line);
+                ok = 0;
+                break;
+            }
+            char name[256];
+            snprintf(name, sizeof(name), "%.*s", (int)(close - open - 1), open + 1);
+            ok = preprocess(library, name, NULL, depth + 1, out, deps);
+            snprintf(marker, sizeof(marker), "#line %u %u\n", line + 1, file_index);
+            text_append(out, marker, strlen(marker));
+        }
+        else
+        {
+            text_append(out, p, length);
+            if (end == NULL)
+                text_append(out, "\n", 1);
+            if (depth == 0 && strncmp(directive, "#version", 8) == 0)
+            {
+                *define_offset = out->length;
+                snprintf(marker, sizeof(marker), "#line %u %u\n", line + 1, file_index);
+                text_append(out, marker, strlen(marker));
+            }
+        }
+        p += length;
+        line++;
+    }
+    free(source);
+    return ok;
+}
+
+void shader_library_init(struct shader_library *library, const char *directory, struct shader_compiler *compiler)
+{
+    memset(library, 0, sizeof(*library));
+    snprintf(library->directory, sizeof(library->directory), "%s", directory);
+    library->compiler = compiler;
+    library->watch_fd = -1;
+}
+
+void shader_library_shutdown(struct shader_library *library)
+{
+    unsigned int i;
+
+#ifdef __linux__
+    if (library->watch_fd >= 0)
+        close(library->watch_fd);
+#endif
+    // programs belong to the compiler's jobs and are released with it
+    for (i = 0; i < library->variant_count; i++)
+    {
+        free(library->variants[i]->name);
+        free(library->variants[i]->defines);
+        free(library->variants[i]);
+    }
+    for (i = 0; i < library->source_count; i++)
+        free_source_set(library->sources[i]);
+    free(library->variants);
+    free(library->sources);
+    memset(library, 0, sizeof(*library));
+}
+
+struct shader_variant *shader_library_variant(struct shader_library *library, const char *name, const char *defines)
+{
+    char *normalized = normalize_defines(defines);
+    unsigned int i;
+
+    if (normalized == NULL)
+        return NULL;
+    uint64_t key = hash_string(hash_string(HASH_SEED, name), normalized);
+    for (i = 0; i < library->variant_count; i++)
+    {
+        struct shader_variant *variant = library->variants[i];
+        if (variant->key == key && strcmp(variant->name, name) == 0 && strcmp(variant->defines, normalized) == 0)
+        {
+            free(normalized);
+            return variant;
+        }
+    }
+
+    if (!grow((void **)&library->variants, &library->variant_capacity, library->variant_count, sizeof(*library->variants)))
+    {
+        free(normalized);
+        return NULL;
+    }
+    struct shader_variant *variant = (struct shader_variant *)calloc(1, sizeof(*variant));
+    if (variant == NULL)
+    {
+        free(normalized);
+        return NULL;
+    }
+    variant->name = copy_string(name);
+    variant->defines = normalized;
+    variant->key = key;
+    library->variants[library->variant_count++] = variant;
+    return variant;
+}
+
+static struct shader_source_set *load_variant(struct shader_library *library, struct shader_variant *variant)
+{
+    struct text vertex = { NULL, 0, 0 }, fragment = { NULL, 0, 0 };
+    struct shader_source_set *set = (struct shader_source_set *)calloc(1, sizeof(*set));
+    size_t vertex_defines = 0, fragment_defines = 0;
+    char file[256];
+    unsigned int i;
+
+    if (set == NULL)
+        return NULL;
+    snprintf(file, sizeof(file), "%s.vert", variant->name);
+    int ok = preprocess(library, file, &vertex_defines, 0, &vertex, set);
+    snprintf(file, sizeof(file), "%s.frag", variant->name);
+    ok = ok && preprocess(library, file, &fragment_defines, 0, &fragment, set);
+    ok = ok && inject_defines(&vertex, vertex_defines, variant->defines);
+    ok = ok && inject_defines(&fragment, fragment_defines, variant->defines);
+    ok = ok && grow((void **)&library->sources, &library->source_capacity, library->source_count, sizeof(*library->sources));
+
+    if (ok)
+    {
+        set->hash = hash_string(hash_string(HASH_SEED, vertex.data), fragment.data);
+        // defines that do not change the generated code land on an existing program
+        for (i = 0; i < library->source_count; i++)
+        {
+            if (library->sources[i]->hash == set->hash)
+            {
+                free_source_set(set);
+                set = library->sources[i];
+                break;
+            }
+        }
+        if (i == library->source_count)
+        {
+            set->job = shader_compiler_submit(library->compiler, vertex.data, fragment.data, "");
+            if (set->job != NULL)
+                library->sources[library->source_count++] = set;
+            else
+            {
+                free_source_set(set);
+                set = NULL;
+            }
+        }
+    }
+    else
+    {
+        free_source_set(set);
+        set = NULL;
+    }
+    free(vertex.data);
+    free(fragment.data);
+    return set;
+}
+
+unsigned int shader_variant_program(struct shader_library *library, struct shader_variant *variant, unsigned int fallback)
+{
+    if (variant == NULL || variant->load_failed)
+        return fallback;
+    if (variant->sources == NULL)
+    {
+        variant->sources = load_variant(library, variant);
+        if (variant->sources == NULL)
+        {
+            variant->load_failed = 1;
+            return fallback;
+        }
+    }
+    return shader_job_program(variant->sources->job, fallback);
+}
+
+int shader_library_watch(struct shader_library *library)
+{
+#ifdef __linux__
+    if (library->watch_fd >= 0)
+        return 1;
+    library->watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (library->watch_fd < 0)
+        return 0;
+    // watch the directory rather than each file: editors often save by writing a new file and
+    // renaming it over the old one, which would silently end a per-file watch
+    if (inotify_add_watch(library->watch_fd, library->directory, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0)
+    {
+        close(library->watch_fd);
+        library->watch_fd = -1;
+        return 0;
+    }
+    return 1;
+#else
+    (void)library;
+    return 0;
+#endif
+}
+
+// drains pending inotify events and flags every source set that depends on a changed file.
+// returns the number of events seen.
+static unsigned int collect_changes(struct shader_library *library)
+{
+    unsigned int events = 0;
+#ifdef __linux__
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    char path[512];
+    ssize_t length;
+
+    if (library->watch_fd < 0)
+        return 0;
+    while ((length = read(library->watch_fd, buffer, sizeof(buffer))) > 0)
+    {
+        char *p = buffer;
+        while (p < buffer + length)
+        {
+            const struct inotify_event *event = (const struct inotify_event *)p;
+            unsigned int i, j;
+
+            if (event->len > 0)
+            {
+                snprintf(path, sizeof(path), "%s/%s", library->directory, event->name);
+                for (i = 0; i < library->source_count; i++)
+                {
+                    for (j = 0; j < library->sources[i]->file_count; j++)
+                    {
+                        if (strcmp(library->sources[i]->files[j], path) == 0)
+                            library->sources[i]->stale = 1;
+                    }
+                }
+                events++;
+            }
+            p += sizeof(struct inotify_event) + event->len;
+        }
+    }
+#else
+    (void)library;
+#endif
+    return events;
+}
+
+static void report_failure(const struct shader_variant *variant, const struct shader_job *job)
+{
+    fprintf(stderr, "shader: %s [%s] failed to build:\n%s\n", variant->name, variant->defines, job->info_log);
+}
+
+static int is_referenced(const struct shader_library *library, const struct shader_source_set *set)
+{
+    unsigned int i;
+
+    for (i = 0; i < library->variant_count; i++)
+    {
+        if (library->variants[i]->sources == set || library->variants[i]->pending == set)
+            return 1;
+    }
+    return 0;
+}
+
+void shader_library_update(struct shader_library *library)
+{
+    unsigned int changes = collect_changes(library);
+    unsigned int i;
+
+    for (i = 0; i < library->variant_count; i++)
+    {
+        struct shader_variant *variant = library->variants[i];
+        struct shader_source_set *current = variant->pending ? variant->pending : variant->sources;
+
+        // only variants that were actually affected are preprocessed and compiled again; a missing
+        // file may have just been created, so failed loads retry on any change
+        if ((current != NULL && current->stale) || (variant->load_failed && changes > 0))
+        {
+            struct shader_source_set *rebuilt = load_variant(library, variant);
+            if (rebuilt != NULL)
+            {
+                variant->load_failed = 0;
+                if (variant->sources == NULL)
+                    variant->sources = rebuilt;
+                else
+                    variant->pending = rebuilt != variant->sources ? rebuilt : NULL;
+            }
+        }
+
+        // swap at the frame boundary, and only to a program that linked
+        if (variant->pending != NULL && variant->pending->job->state != SHADER_JOB_PENDING)
+        {
+            if (variant->pending->job->state == SHADER_JOB_READY)
+            {
+                variant->sources = variant->pending;
+                variant->reported = 0;
+                printf("shader: reloaded %s [%s]\n", variant->name, variant->defines);
+            }
+            else
+                report_failure(variant, variant->pending->job);
+            variant->pending = NULL;
+        }
+        if (variant->sources != NULL && variant->sources->job->state == SHADER_JOB_FAILED && !variant->reported)
+        {
+            report_failure(variant, variant->sources->job);
+            variant->reported = 1;
+        }
+    }
+
+    // drop programs nothing uses any more (replaced or failed rebuilds)
+    for (i = 0; i < library->source_count; i++)
+    {
+        struct shader_source_set *set = library->sources[i];
+        set->stale = 0;
+        if (!is_referenced(library, set) && set->job->state != SHADER_JOB_PENDING)
+        {
+            shader_compiler_release(library->compiler, set->job);
+            free_source_set(set);
+            library->sources[i--] = library->sources[--library->source_count];
+        }
+    }
+}
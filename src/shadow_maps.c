@@ -0,0 +1,463 @@
+#include <glad/glad.h>
+#include <math3d.h>
+#include <shadow_maps.h>
+#include <uniforms.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// where the last cascade ends, in view distance
+#define SHADOW_DISTANCE 120.0f
+// weight of the logarithmic split scheme against the uniform one
+#define SPLIT_LAMBDA 0.8f
+// slack added whenever the light-space depth range has to grow, so it does not grow every frame
+#define DEPTH_SLACK 8.0f
+
+// mirrors the Shadows block in shaders/shadows.glsl
+struct shadow_uniforms
+{
+    float matrices[SHADOW_CASCADES][16];
+    float splits[4];
+    float texel_sizes[4];
+    float direction[4];         // towards the light
+};
+
+// what one update renders a cascade's rectangles with
+struct shadow_pass
+{
+    struct shadow_maps *maps;
+    struct shadow_cascade *cascade;
+    struct ring_buffer *stream;
+    struct render_queue *queue;
+    unsigned int program;
+    const unsigned int *casters;
+    unsigned int caster_count;
+};
+
+static void invalidate_all(struct shadow_maps *maps)
+{
+    unsigned int i;
+
+    for (i = 0; i < SHADOW_CASCADES; i++)
+        maps->cascades[i].valid = 0;
+}
+
+// grows the light-space depth range to cover bounds; everything cached is then stale
+static void cover_depth(struct shadow_maps *maps, const struct aabb *bounds)
+{
+    struct aabb light;
+
+    aabb_transform(&light, bounds, maps->light_view);
+    if (light.min[2] >= maps->depth_range[0] && light.max[2] <= maps->depth_range[1])
+        return;
+    if (light.min[2] < maps->depth_range[0])
+        maps->depth_range[0] = light.min[2] - DEPTH_SLACK;
+    if (light.max[2] > maps->depth_range[1])
+        maps->depth_range[1] = light.max[2] + DEPTH_SLACK;
+    invalidate_all(maps);
+}
+
+int shadow_maps_init(struct shadow_maps *maps, int size, const float *direction, int zero_to_one)
+{
+    memset(maps, 0, sizeof(*maps));
+    maps->size = size;
+    maps->zero_to_one = zero_to_one;
+
+    glGenTextures(1, &maps->texture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, maps->texture);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT32F, size, size, SHADOW_CASCADES, 0, GL_DEPTH_COMPONENT,
+        GL_FLOAT, NULL);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    // toroidal addressing: texel coordinates are absolute and wrap
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_GEQUAL);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    glGenFramebuffers(1, &maps->framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, maps->framebuffer);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, maps->texture, 0, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+    int complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    shadow_maps_set_direction(maps, direction);
+    return complete;
+}
+
+void shadow_maps_shutdown(struct shadow_maps *maps)
+{
+    glDeleteFramebuffers(1, &maps->framebuffer);
+    glDeleteTextures(1, &maps->texture);
+    free(maps->casters);
+    free(maps->visible);
+    memset(maps, 0, sizeof(*maps));
+}
+
+void shadow_maps_set_direction(struct shadow_maps *maps, const float *direction)
+{
+    const float origin[3] = { 0.0f, 0.0f, 0.0f };
+    float up[3] = { 0.0f, 1.0f, 0.0f };
+    unsigned int i;
+
+    memcpy(maps->direction, direction, sizeof(maps->direction));
+    vec3_normalize(maps->direction);
+    if (fabsf(maps->direction[1]) > 0.99f)
+    {
+        up[1] = 0.0f;
+        up[2] = 1.0f;
+    }
+    mat4_look_to(maps->light_view, origin, maps->direction, up);
+    maps->depth_range[0] = 1e30f;
+    maps->depth_range[1] = -1e30f;
+    for (i = 0; i < maps->static_count; i++)
+        cover_depth(maps, &maps->casters[i].bounds);
+    invalidate_all(maps);
+}
+
+static int grow_casters(struct shadow_maps *maps)
+{
+    if (maps->caster_count < maps->caster_capacity)
+        return 1;
+    unsigned int capacity = maps->caster_capacity ? maps->caster_capacity * 2 : 64;
+    struct shadow_caster *casters = (struct shadow_caster *)realloc(maps->casters, sizeof(*casters) * capacity);
+    if (casters == NULL)
+        return 0;
+    maps->casters = casters;
+    unsigned int *visible = (unsigned int *)realloc(maps->visible, sizeof(*visible) * capacity * 2);
+    if (visible == NULL)
+        return 0;
+    maps->visible = visible;
+    maps->caster_capacity = capacity;
+    return 1;
+}
+
+// the texels a box covers in a cascade, with a texel around it for filtering
+static struct shadow_rect footprint(const struct shadow_maps *maps, const struct shadow_cascade *cascade,
+    const struct aabb *bounds)
+{
+    struct shadow_rect rect;
+    struct aabb light;
+
+    aabb_transform(&light, bounds, maps->light_view);
+    rect.x0 = (int)floorf(light.min[0] / cascade->texel_size) - 1;
+    rect.y0 = (int)floorf(light.min[1] / cascade->texel_size) - 1;
+    rect.x1 = (int)ceilf(light.max[0] / cascade->texel_size) + 1;
+    rect.y1 = (int)ceilf(light.max[1] / cascade->texel_size) + 1;
+    return rect;
+}
+
+// clips rect to the cascade's window; returns 0 if nothing is left
+static int clip_to_window(const struct shadow_maps *maps, const struct shadow_cascade *cascade,
+    struct shadow_rect *rect)
+{
+    if (rect->x0 < cascade->origin[0])
+        rect->x0 = cascade->origin[0];
+    if (rect->y0 < cascade->origin[1])
+        rect->y0 = cascade->origin[1];
+    if (rect->x1 > cascade->origin[0] + maps->size)
+        rect->x1 = cascade->origin[0] + maps->size;
+    if (rect->y1 > cascade->origin[1] + maps->size)
+        rect->y1 = cascade->origin[1] + maps->size;
+    return rect->x0 < rect->x1 && rect->y0 < rect->y1;
+}
+
+static void mark_dirty(const struct shadow_maps *maps, struct shadow_cascade *cascade, struct shadow_rect rect)
+{
+    if (!cascade->valid || !clip_to_window(maps, cascade, &rect))
+        return;
+    if (cascade->dirty_count == SHADOW_MAX_DIRTY)
+    {
+        cascade->valid = 0;
+        return;
+    }
+    cascade->dirty[cascade->dirty_count++] = rect;
+}
+
+int shadow_maps_add_static(struct shadow_maps *maps, const struct render_mesh *mesh, const struct render_instance *instance,
+    const struct aabb *bounds)
+{
+    unsigned int i;
+
+    if (!grow_casters(maps))
+        return 0;
+    // statics stay in front of this update's dynamic casters
+    if (maps->caster_count > maps->static_count)
+        maps->casters[maps->caster_count] = maps->casters[maps->static_count];
+    maps->caster_count++;
+    maps->casters[maps->static_count].mesh = mesh;
+    maps->casters[maps->static_count].instance = *instance;
+    maps->casters[maps->static_count].bounds = *bounds;
+    maps->static_count++;
+    cover_depth(maps, bounds);
+    for (i = 0; i < SHADOW_CASCADES; i++)
+    {
+        if (maps->cascades[i].valid)
+            mark_dirty(maps, &maps->cascades[i], footprint(maps, &maps->cascades[i], bounds));
+    }
+    return 1;
+}
+
+int shadow_maps_add_dynamic(struct shadow_maps *maps, const struct render_mesh *mesh,
+    const struct render_instance *instance, const struct aabb *bounds)
+{
+    if (!grow_casters(maps))
+        return 0;
+    maps->casters[maps->caster_count].mesh = mesh;
+    maps->casters[maps->caster_count].instance = *instance;
+    maps->casters[maps->caster_count].bounds = *bounds;
+    maps->caster_count++;
+    cover_depth(maps, bounds);
+    return 1;
+}
+
+static int wrap(int v, int size)
+{
+    return ((v % size) + size) % size;
+}
+
+// light view -> clip space over the texels of rect, reversed-Z over the depth range
+static void rect_projection(const struct shadow_maps *maps, const struct shadow_cascade *cascade,
+    const struct shadow_rect *rect, float *m)
+{
+    float l = rect->x0 * cascade->texel_size, r = rect->x1 * cascade->texel_size;
+    float b = rect->y0 * cascade->texel_size, t = rect->y1 * cascade->texel_size;
+    float z0 = maps->depth_range[0], range = maps->depth_range[1] - maps->depth_range[0];
+
+    memset(m, 0, 16 * sizeof(float));
+    m[0] = 2.0f / (r - l);
+    m[5] = 2.0f / (t - b);
+    m[12] = -(r + l) / (r - l);
+    m[13] = -(t + b) / (t - b);
+    m[15] = 1.0f;
+    // depth (z - z0) / range: 1 at the end nearest the light
+    m[10] = maps->zero_to_one ? 1.0f / range : 2.0f / range;
+    m[14] = maps->zero_to_one ? -z0 / range : -2.0f * z0 / range - 1.0f;
+}
+
+// renders the listed casters over rect, which must lie inside the window, splitting it where it
+// wraps around the edge of the map
+static void render_rect(struct shadow_pass *pass, struct shadow_rect rect, int clear)
+{
+    struct shadow_maps *maps = pass->maps;
+    int size = maps->size, tx = wrap(rect.x0, size), ty = wrap(rect.y0, size);
+    int width = rect.x1 - rect.x0, height = rect.y1 - rect.y0;
+    struct frame_uniforms frame;
+    struct frustum frustum;
+    unsigned int i;
+
+    if (tx + width > size)
+    {
+        struct shadow_rect right = rect;
+        rect.x1 = right.x0 = rect.x0 + (size - tx);
+        render_rect(pass, rect, clear);
+        render_rect(pass, right, clear);
+        return;
+    }
+    if (ty + height > size)
+    {
+        struct shadow_rect top = rect;
+        rect.y1 = top.y0 = rect.y0 + (size - ty);
+        render_rect(pass, rect, clear);
+        render_rect(pass, top, clear);
+        return;
+    }
+
+    glViewport(tx, ty, width, height);
+    glScissor(tx, ty, width, height);
+    if (clear)
+        glClear(GL_DEPTH_BUFFER_BIT);
+    memset(&frame, 0, sizeof(frame));
+    memcpy(frame.view, maps->light_view, sizeof(frame.view));
+    rect_projection(maps, pass->cascade, &rect, frame.projection);
+    mat4_multiply(frame.view_projection, frame.projection, frame.view);
+    uniforms_push(pass->stream, UNIFORM_BINDING_FRAME, &frame, sizeof(frame));
+
+    frustum_from_matrix(&frustum, frame.view_projection, maps->zero_to_one);
+    for (i = 0; i < pass->caster_count; i++)
+    {
+        const struct shadow_caster *caster = &maps->casters[pass->casters[i]];
+        if (!frustum_test_aabb(&frustum, &caster->bounds))
+            continue;
+        render_queue_submit(pass->queue, pass->program, caster->mesh, 0, &caster->instance);
+        maps->casters_drawn++;
+    }
+    render_queue_flush(pass->queue);
+    maps->texels_rendered += (unsigned int)(width * height);
+}
+
+// moves the cascade's window to cover a sphere, queueing the strips that came into view
+static void fit_cascade(struct shadow_maps *maps, struct shadow_cascade *cascade, const float *center, float radius)
+{
+    const float *v = maps->light_view;
+    // a texel of margin on either side for the snapping
+    float texel_size = 2.0f * radius / (float)(maps->size - 2);
+    float x = v[0] * center[0] + v[4] * center[1] + v[8] * center[2] + v[12];
+    float y = v[1] * center[0] + v[5] * center[1] + v[9] * center[2] + v[13];
+    int origin[2] = { (int)floorf(x / texel_size) - maps->size / 2, (int)floorf(y / texel_size) - maps->size / 2 };
+    int dx = origin[0] - cascade->origin[0], dy = origin[1] - cascade->origin[1], size = maps->size;
+    int old[2] = { cascade->origin[0], cascade->origin[1] };
+
+    if (texel_size != cascade->texel_size || abs(dx) >= size || abs(dy) >= size)
+        cascade->valid = 0;
+    cascade->texel_size = texel_size;
+    cascade->origin[0] = origin[0];
+    cascade->origin[1] = origin[1];
+    if (dx > 0)
+        mark_dirty(maps, cascade, (struct shadow_rect){ old[0] + size, origin[1], origin[0] + size, origin[1] + size });
+    if (dx < 0)
+        mark_dirty(maps, cascade, (struct shadow_rect){ origin[0], origin[1], old[0], origin[1] + size });
+    if (dy > 0)
+        mark_dirty(maps, cascade, (struct shadow_rect){ origin[0], old[1] + size, origin[0] + size, origin[1] + size });
+    if (dy < 0)
+        mark_dirty(maps, cascade, (struct shadow_rect){ origin[0], origin[1], origin[0] + size, old[1] });
+}
+
+// world -> (u, v, depth) in absolute texel units over the map size, for sampling with GL_REPEAT
+static void sampling_matrix(const struct shadow_maps *maps, struct shadow_cascade *cascade)
+{
+    float extent = cascade->texel_size * maps->size, range = maps->depth_range[1] - maps->depth_range[0];
+    float m[16];
+
+    memset(m, 0, sizeof(m));
+    m[0] = 1.0f / extent;
+    m[5] = 1.0f / extent;
+    m[10] = 1.0f / range;
+    m[14] = -maps->depth_range[0] / range;
+    m[15] = 1.0f;
+    mat4_multiply(cascade->matrix, m, maps->light_view);
+}
+
+void shadow_maps_update(struct shadow_maps *maps, const struct camera *camera, struct ring_buffer *stream,
+    struct render_queue *queue, unsigned int depth_program)
+{
+    float forward[3], right[3], previous = camera->near;
+    float k_sq = tanf(camera->fov_y * 0.5f) * tanf(camera->fov_y * 0.5f) * (1.0f + camera->aspect * camera->aspect);
+    unsigned int prepass = queue->prepass_program, i, j;
+
+    maps->texels_rendered = 0;
+    maps->casters_drawn = 0;
+    // until the program is built the cache would be filled with nothing
+    if (depth_program == 0 || maps->depth_range[0] > maps->depth_range[1])
+    {
+        maps->caster_count = maps->static_count;
+        return;
+    }
+    camera_axes(camera, forward, right);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, maps->framebuffer);
+    glEnable(GL_SCISSOR_TEST);
+    // push the stored depth away from the light (smaller, with reversed-Z) against acne
+    glEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(-1.5f, -2.0f);
+    queue->prepass_program = 0;
+
+    for (i = 0; i < SHADOW_CASCADES; i++)
+    {
+        struct shadow_cascade *cascade = &maps->cascades[i];
+        float t = (float)(i + 1) / SHADOW_CASCADES;
+        float split = SPLIT_LAMBDA * camera->near * powf(SHADOW_DISTANCE / camera->near, t) +
+            (1.0f - SPLIT_LAMBDA) * (camera->near + (SHADOW_DISTANCE - camera->near) * t);
+        float n = previous, f = split, center[3];
+        previous = split;
+
+        // the smallest sphere around the frustum slice [n, f]: its size depends only on the
+        // projection, so turning the camera never changes the texel size
+        float c = (n + f) * (1.0f + k_sq) * 0.5f;
+        c = c < f ? c : f;
+        float radius = sqrtf((f - c) * (f - c) + f * f * k_sq);
+        radius = ceilf(radius * 16.0f) / 16.0f;
+        for (j = 0; j < 3; j++)
+            center[j] = camera->position[j] + forward[j] * c;
+        cascade->split = split;
+
+        fit_cascade(maps, cascade, center, radius);
+        // restore the static depth under last update's dynamic casters
+        if (cascade->dynamic_count > SHADOW_MAX_DIRTY)
+            cascade->valid = 0;
+        for (j = 0; j < cascade->dynamic_count && j < SHADOW_MAX_DIRTY; j++)
+            mark_dirty(maps, cascade, cascade->dynamic[j]);
+        cascade->dynamic_count = 0;
+        sampling_matrix(maps, cascade);
+
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, maps->texture, 0, (GLint)i);
+        struct shadow_pass pass = { maps, cascade, stream, queue, depth_program, maps->visible, 0 };
+        if (!cascade->valid || cascade->dirty_count)
+        {
+            // statics inside the cascade's window, then per rectangle from those
+            struct shadow_rect window = { cascade->origin[0], cascade->origin[1], cascade->origin[0] + maps->size,
+                cascade->origin[1] + maps->size };
+            struct frustum frustum;
+            float projection[16], matrix[16];
+            rect_projection(maps, cascade, &window, projection);
+            mat4_multiply(matrix, projection, maps->light_view);
+            frustum_from_matrix(&frustum, matrix, maps->zero_to_one);
+            for (j = 0; j < maps->static_count; j++)
+            {
+                if (frustum_test_aabb(&frustum, &maps->casters[j].bounds))
+                    maps->visible[pass.caster_count++] = j;
+            }
+
+            if (!cascade->valid)
+            {
+                render_rect(&pass, window, 1);
+                cascade->valid = 1;
+            }
+            else
+            {
+                for (j = 0; j < cascade->dirty_count; j++)
+                {
+                    if (clip_to_window(maps, cascade, &cascade->dirty[j]))
+                        render_rect(&pass, cascade->dirty[j], 1);
+                }
+            }
+            cascade->dirty_count = 0;
+        }
+
+        // dynamic casters over the cache, each in its own footprint
+        for (j = maps->static_count; j < maps->caster_count; j++)
+        {
+            struct shadow_rect rect = footprint(maps, cascade, &maps->casters[j].bounds);
+            if (!clip_to_window(maps, cascade, &rect))
+                continue;
+            if (cascade->dynamic_count < SHADOW_MAX_DIRTY)
+                cascade->dynamic[cascade->dynamic_count] = rect;
+            cascade->dynamic_count++;
+            pass.casters = maps->visible + maps->caster_capacity;
+            maps->visible[maps->caster_capacity] = j;
+            pass.caster_count = 1;
+            render_rect(&pass, rect, 0);
+        }
+    }
+
+    queue->prepass_program = prepass;
+    glDisable(GL_POLYGON_OFFSET_FILL);
+    glDisable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    maps->caster_count = maps->static_count;
+}
+
+void shadow_maps_bind(const struct shadow_maps *maps, struct ring_buffer *stream)
+{
+    struct shadow_uniforms uniforms;
+    unsigned int i;
+
+    memset(&uniforms, 0, sizeof(uniforms));
+    for (i = 0; i < SHADOW_CASCADES; i++)
+    {
+        memcpy(uniforms.matrices[i], maps->cascades[i].matrix, sizeof(uniforms.matrices[i]));
+        // nothing rendered yet: push the cascades out of reach so nothing is shadowed
+        uniforms.splits[i] = maps->cascades[i].valid ? maps->cascades[i].split : 0.0f;
+        uniforms.texel_sizes[i] = maps->cascades[i].texel_size;
+    }
+    for (i = 0; i < 3; i++)
+        uniforms.direction[i] = -maps->direction[i];
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_SHADOWS);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, maps->texture);
+    glActiveTexture(GL_TEXTURE0);
+    uniforms_push(stream, UNIFORM_BINDING_SHADOWS, &uniforms, sizeof(uniforms));
+}
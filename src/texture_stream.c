@@ -0,0 +1,409 @@
+#include <bc_texture.h>
+#include <glad/glad.h>
+#include <image.h>
+#include <texture_stream.h>
+#include <vfs.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// textures used within this many frames want their full chain resident
+#define TEXTURE_KEEP_FRAMES 120
+
+static int has_extension(const char *path, const char *extension)
+{
+    size_t length = strlen(path), extension_length = strlen(extension);
+
+    return length >= extension_length && strcmp(path + length - extension_length, extension) == 0;
+}
+
+// takes over the levels of a compressed file, or decodes them when the driver can't sample the
+// format. returns the level count, 0 on failure.
+static unsigned int load_compressed(struct texture *texture)
+{
+    struct bc_texture compressed;
+    unsigned int i;
+
+    if (!bc_texture_decode(texture->file, texture->file_size, &compressed))
+        return 0;
+    texture->srgb = compressed.srgb;
+    if (bc_texture_supported(compressed.format, compressed.srgb))
+    {
+        texture->format = bc_texture_gl_format(compressed.format, compressed.srgb);
+        texture->compressed = 1;
+        memcpy(texture->mips, compressed.levels, sizeof(compressed.levels[0]) * compressed.level_count);
+        return compressed.level_count;
+    }
+
+    texture->format = compressed.srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+    for (i = 0; i < compressed.level_count; i++)
+    {
+        struct mip_level *mip = &texture->mips[i];
+        mip->width = compressed.levels[i].width;
+        mip->height = compressed.levels[i].height;
+        mip->size = (size_t)mip->width * mip->height * 4;
+        mip->pixels = (unsigned char *)malloc(mip->size);
+        if (mip->pixels == NULL)
+            break;
+        bc_decode(compressed.format, compressed.levels[i].pixels, mip->width, mip->height, mip->pixels);
+    }
+    bc_texture_free(&compressed);
+    return i;
+}
+
+// worker thread: decode and build the whole mip chain
+static void decode_task(void *arg)
+{
+    struct texture *texture = (struct texture *)arg;
+    struct image image;
+    unsigned int count = 0, i;
+    enum texture_state state = TEXTURE_FAILED;
+
+    if (texture->file != NULL && has_extension(texture->path, BC_TEXTURE_EXTENSION))
+    {
+        count = load_compressed(texture);
+        if (count > 0)
+            state = TEXTURE_DECODED;
+    }
+    else if (texture->file != NULL && image_decode(texture->file, texture->file_size, &image))
+    {
+        texture->mips[0].width = image.width;
+        texture->mips[0].height = image.height;
+        texture->mips[0].size = (size_t)image.width * image.height * 4;
+        texture->mips[0].pixels = image.pixels;
+        // already on a pool worker, so the chain is built on this thread alone
+        count = mip_generate(texture->mips, TEXTURE_MAX_MIPS, MIP_FILTER_KAISER, texture->srgb, NULL);
+        state = TEXTURE_DECODED;
+    }
+    free(texture->file);
+    texture->file = NULL;
+
+    // the GL thread leaves mip_count, resident_base and mips alone until state says decoded
+    pthread_mutex_lock(&texture->streamer->lock);
+    if (texture->mip_count == 0)
+    {
+        texture->mip_count = count;
+        texture->resident_base = count;
+    }
+    else if (count == texture->mip_count)
+    {
+        // read again for evicted levels: the ones still in VRAM are not needed
+        for (i = texture->resident_base; i < count; i++)
+        {
+            free(texture->mips[i].pixels);
+            texture->mips[i].pixels = NULL;
+        }
+    }
+    else
+    {
+        // the file changed under us; keep what is resident and stream no further
+        for (i = 0; i < count; i++)
+        {
+            free(texture->mips[i].pixels);
+            texture->mips[i].pixels = NULL;
+        }
+        state = TEXTURE_FAILED;
+    }
+    texture->state = state;
+    pthread_mutex_unlock(&texture->streamer->lock);
+}
+
+// worker thread: reads everything queued in one batch, then hands each file to a decode task.
+// keeps going until no more loads arrive.
+static void read_task(void *arg)
+{
+    struct texture_streamer *streamer = (struct texture_streamer *)arg;
+
+    for (;;)
+    {
+        struct texture *queue, *texture;
+        const char **paths;
+        unsigned char **data;
+        size_t *sizes;
+        unsigned int count = 0, i;
+
+        pthread_mutex_lock(&streamer->lock);
+        queue = streamer->read_queue;
+        streamer->read_queue = NULL;
+        streamer->reading = queue != NULL;
+        pthread_mutex_unlock(&streamer->lock);
+        if (queue == NULL)
+            return;
+
+        for (texture = queue; texture != NULL; texture = texture->next_read)
+            count++;
+        paths = (const char **)malloc(sizeof(*paths) * count);
+        data = (unsigned char **)malloc(sizeof(*data) * count);
+        sizes = (size_t *)malloc(sizeof(*sizes) * count);
+        if (paths != NULL && data != NULL && sizes != NULL)
+        {
+            for (texture = queue, i = 0; texture != NULL; texture = texture->next_read, i++)
+                paths[i] = texture->path;
+            vfs_read_batch(paths, count, data, sizes, streamer->pool);
+            for (texture = queue, i = 0; texture != NULL; texture = texture->next_read, i++)
+            {
+                texture->file = data[i];
+                texture->file_size = sizes[i];
+            }
+        }
+        else
+        {
+            for (texture = queue; texture != NULL; texture = texture->next_read)
+                texture->file = vfs_read(texture->path, &texture->file_size);
+        }
+        free(paths);
+        free(data);
+        free(sizes);
+
+        for (texture = queue; texture != NULL;)
+        {
+            struct texture *next = texture->next_read;
+            texture->next_read = NULL;
+            if (!thread_pool_submit(streamer->pool, decode_task, texture))
+                decode_task(texture);
+            texture = next;
+        }
+    }
+}
+
+int texture_streamer_init(struct texture_streamer *streamer, struct thread_pool *pool, size_t budget,
+    size_t upload_per_frame)
+{
+    memset(streamer, 0, sizeof(*streamer));
+    streamer->pool = pool;
+    streamer->budget = budget;
+    pthread_mutex_init(&streamer->lock, NULL);
+    return ring_buffer_create(&streamer->staging, upload_per_frame);
+}
+
+void texture_streamer_shutdown(struct texture_streamer *streamer)
+{
+    struct texture *texture, *next;
+    unsigned int i;
+
+    thread_pool_wait(streamer->pool);
+    for (texture = streamer->textures; texture != NULL; texture = next)
+    {
+        next = texture->next;
+        glDeleteTextures(1, &texture->id);
+        for (i = 0; i < texture->mip_count; i++)
+            free(texture->mips[i].pixels);
+        free(texture);
+    }
+    ring_buffer_destroy(&streamer->staging);
+    pthread_mutex_destroy(&streamer->lock);
+    memset(streamer, 0, sizeof(*streamer));
+}
+
+// hands the texture to the read task, starting one if none is running
+static void queue_read(struct texture_streamer *streamer, struct texture *texture)
+{
+    pthread_mutex_lock(&streamer->lock);
+    texture->state = TEXTURE_LOADING;
+    texture->next_read = streamer->read_queue;
+    streamer->read_queue = texture;
+    if (!streamer->reading)
+    {
+        streamer->reading = thread_pool_submit(streamer->pool, read_task, streamer);
+        if (!streamer->reading)
+        {
+            // the queue only ever holds this texture when no read task is around
+            streamer->read_queue = NULL;
+            texture->state = TEXTURE_FAILED;
+        }
+    }
+    pthread_mutex_unlock(&streamer->lock);
+}
+
+struct texture *texture_streamer_load(struct texture_streamer *streamer, const char *path, int srgb)
+{
+    struct texture *texture = (struct texture *)calloc(1, sizeof(*texture));
+
+    if (texture == NULL)
+        return NULL;
+    snprintf(texture->path, sizeof(texture->path), "%s", path);
+    texture->srgb = srgb;
+    texture->format = srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+    texture->state = TEXTURE_LOADING;
+    texture->streamer = streamer;
+    texture->last_used = streamer->frame;
+
+    glGenTextures(1, &texture->id);
+    glBindTexture(GL_TEXTURE_2D, texture->id);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    texture->next = streamer->textures;
+    streamer->textures = texture;
+    queue_read(streamer, texture);
+    return texture;
+}
+
+unsigned int texture_streamer_use(struct texture_streamer *streamer, struct texture *texture)
+{
+    texture->last_used = streamer->frame;
+    return texture->id;
+}
+
+// drops the finest resident level of a texture; the coarsest one always stays
+static void evict_level(struct texture_streamer *streamer, struct texture *texture)
+{
+    unsigned int level = texture->resident_base;
+
+    glBindTexture(GL_TEXTURE_2D, texture->id);
+    // a zero sized image releases the level's storage; it sits below the base level so the
+    // texture stays complete
+    if (texture->compressed)
+        glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)level, texture->format, 0, 0, 0, 0, NULL);
+    else
+        glTexImage2D(GL_TEXTURE_2D, (GLint)level, (GLint)texture->format, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, (GLint)level + 1);
+    texture->resident_base = level + 1;
+    texture->resident_bytes -= texture->mips[level].size;
+    streamer->resident -= texture->mips[level].size;
+    streamer->evictions++;
+}
+
+// least recently used texture (not used this frame) that still has a level to give up
+static struct texture *eviction_candidate(struct texture_streamer *streamer, unsigned long used_before)
+{
+    struct texture *texture, *best = NULL;
+
+    for (texture = streamer->textures; texture != NULL; texture = texture->next)
+    {
+        if (!texture->streaming || texture->resident_base + 1 >= texture->mip_count)
+            continue;
+        if (texture->last_used >= used_before)
+            continue;
+        if (best == NULL || texture->last_used < best->last_used ||
+            (texture->last_used == best->last_used && texture->resident_bytes > best->resident_bytes))
+            best = texture;
+    }
+    return best;
+}
+
+enum upload_result
+{
+    UPLOAD_DONE,
+    UPLOAD_OVER_BUDGET,     // nothing less recently used is left to evict
+    UPLOAD_STAGING_FULL     // this frame's share of the staging buffer is used up
+};
+
+static enum upload_result upload_level(struct texture_streamer *streamer, struct texture *texture)
+{
+    unsigned int level = texture->resident_base - 1;
+    struct mip_level *mip = &texture->mips[level];
+    size_t offset;
+
+    while (streamer->resident + mip->size > streamer->budget)
+    {
+        struct texture *victim = eviction_candidate(streamer, texture->last_used);
+        if (victim == NULL)
+            return UPLOAD_OVER_BUDGET;
+        evict_level(streamer, victim);
+    }
+
+    const void *source = mip->pixels;
+    if (mip->size <= streamer->staging.partition_size)
+    {
+        void *dst = ring_buffer_map(&streamer->staging, mip->size, 4, &offset);
+        if (dst == NULL)
+            return UPLOAD_STAGING_FULL;
+        memcpy(dst, mip->pixels, mip->size);
+        ring_buffer_unmap(&streamer->staging);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, streamer->staging.buffer);
+        source = (const void *)offset;
+    }
+    // else: larger than a whole staging partition, so it can only go through a driver-side copy
+
+    glBindTexture(GL_TEXTURE_2D, texture->id);
+    if (texture->compressed)
+        glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)level, texture->format, mip->width, mip->height, 0,
+            (GLsizei)mip->size, source);
+    else
+        glTexImage2D(GL_TEXTURE_2D, (GLint)level, (GLint)texture->format, mip->width, mip->height, 0, GL_RGBA,
+            GL_UNSIGNED_BYTE, source);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, (GLint)level);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)texture->mip_count - 1);
+
+    // the driver has its own copy now; an evicted level is decoded from the file again
+    free(mip->pixels);
+    mip->pixels = NULL;
+
+    texture->resident_base = level;
+    texture->resident_bytes += mip->size;
+    streamer->resident += mip->size;
+    streamer->uploads++;
+    return UPLOAD_DONE;
+}
+
+// the next level to upload was evicted after its pixels were freed: decode the whole file again.
+// finer levels that never made it to VRAM are dropped too, the decode brings them back.
+static void reload(struct texture_streamer *streamer, struct texture *texture)
+{
+    unsigned int i;
+
+    for (i = 0; i < texture->resident_base; i++)
+    {
+        free(texture->mips[i].pixels);
+        texture->mips[i].pixels = NULL;
+    }
+    texture->streaming = 0;
+    streamer->reloads++;
+    queue_read(streamer, texture);
+}
+
+void texture_streamer_update(struct texture_streamer *streamer)
+{
+    struct texture *texture;
+    int progress = 1, full = 0, tier;
+
+    streamer->frame++;
+    streamer->uploads = 0;
+    streamer->evictions = 0;
+    streamer->reloads = 0;
+    ring_buffer_begin_frame(&streamer->staging);
+
+    // one level per texture per pass, so every texture gets its coarse mips before any texture
+    // gets its fine ones. within a pass, textures drawn last frame go first.
+    while (progress && !full)
+    {
+        progress = 0;
+        for (tier = 0; tier < 2 && !full; tier++)
+        {
+            for (texture = streamer->textures; texture != NULL && !full; texture = texture->next)
+            {
+                if ((texture->last_used + 1 >= streamer->frame) != (tier == 0))
+                    continue;
+                if (!texture->streaming)
+                {
+                    pthread_mutex_lock(&streamer->lock);
+                    texture->streaming = texture->state == TEXTURE_DECODED;
+                    pthread_mutex_unlock(&streamer->lock);
+                }
+                if (!texture->streaming || texture->resident_base == 0)
+                    continue;
+                // textures nobody asked for in a while only keep their coarsest level
+                if (texture->resident_base < texture->mip_count && texture->last_used + TEXTURE_KEEP_FRAMES < streamer->frame)
+                    continue;
+                // an evicted level is only worth reading the file again for while the texture is drawn
+                if (texture->mips[texture->resident_base - 1].pixels == NULL)
+                {
+                    if (tier == 0)
+                        reload(streamer, texture);
+                    continue;
+                }
+
+                enum upload_result result = upload_level(streamer, texture);
+                progress |= result == UPLOAD_DONE;
+                full = result == UPLOAD_STAGING_FULL;
+            }
+        }
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    ring_buffer_end_frame(&streamer->staging);
+}
@@ -0,0 +1,214 @@
+#include <thread_pool.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static void *worker_main(void *arg)
+{
+    struct thread_pool *pool = (struct thread_pool *)arg;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;)
+    {
+        while (pool->head == NULL && !pool->quit)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        if (pool->head == NULL)
+            break;
+
+        struct thread_pool_task *task = pool->head;
+        pool->head = task->next;
+        if (pool->head == NULL)
+            pool->tail = NULL;
+        pthread_mutex_unlock(&pool->lock);
+
+        task->fn(task->arg);
+        free(task);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->outstanding == 0)
+            pthread_cond_broadcast(&pool->idle);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+unsigned int thread_pool_cpu_count(void)
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (unsigned int)count : 1;
+}
+
+int thread_pool_init(struct thread_pool *pool, unsigned int thread_count)
+{
+    unsigned int i;
+
+    memset(pool, 0, sizeof(*pool));
+    if (thread_count == 0)
+        thread_count = thread_pool_cpu_count();
+    pool->threads = (pthread_t *)malloc(thread_count * sizeof(*pool->threads));
+    if (pool->threads == NULL)
+        return 0;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+
+    for (i = 0; i < thread_count; i++)
+    {
+        if (pthread_create(&pool->threads[i], NULL, worker_main, pool) != 0)
+            break;
+    }
+    pool->thread_count = i;
+    if (i == 0)
+    {
+        thread_pool_shutdown(pool);
+        return 0;
+    }
+    return 1;
+}
+
+void thread_pool_shutdown(struct thread_pool *pool)
+{
+    unsigned int i;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (i = 0; i < pool->thread_count; i++)
+        pthread_join(pool->threads[i], NULL);
+
+    free(pool->threads);
+    pthread_cond_destroy(&pool->idle);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    memset(pool, 0, sizeof(*pool));
+}
+
+int thread_pool_submit(struct thread_pool *pool, thread_pool_fn fn, void *arg)
+{
+    struct thread_pool_task *task = (struct thread_pool_task *)malloc(sizeof(*task));
+
+    if (task == NULL)
+        return 0;
+    task->fn = fn;
+    task->arg = arg;
+    task->next = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->tail != NULL)
+        pool->tail->next = task;
+    else
+        pool->head = task;
+    pool->tail = task;
+    pool->outstanding++;
+    pthread_cond_signal(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    return 1;
+}
+
+void thread_pool_wait(struct thread_pool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    while (pool->outstanding > 0)
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// shared between the caller of thread_pool_parallel_for and its helper tasks; freed by whoever
+// drops the last reference, since helpers may only start running after the caller has returned
+struct parallel_for
+{
+    thread_pool_for_fn fn;
+    void *arg;
+    unsigned int count;
+    unsigned int next;
+    unsigned int done;
+    unsigned int refs;
+    pthread_mutex_t lock;
+    pthread_cond_t finished;
+};
+
+static int parallel_for_step(struct parallel_for *work)
+{
+    unsigned int index;
+
+    pthread_mutex_lock(&work->lock);
+    if (work->next >= work->count)
+    {
+        pthread_mutex_unlock(&work->lock);
+        return 0;
+    }
+    index = work->next++;
+    pthread_mutex_unlock(&work->lock);
+
+    work->fn(work->arg, index);
+
+    pthread_mutex_lock(&work->lock);
+    if (++work->done == work->count)
+        pthread_cond_broadcast(&work->finished);
+    pthread_mutex_unlock(&work->lock);
+    return 1;
+}
+
+static void parallel_for_release(struct parallel_for *work)
+{
+    int last;
+
+    pthread_mutex_lock(&work->lock);
+    last = --work->refs == 0;
+    pthread_mutex_unlock(&work->lock);
+    if (last)
+    {
+        pthread_cond_destroy(&work->finished);
+        pthread_mutex_destroy(&work->lock);
+        free(work);
+    }
+}
+
+static void parallel_for_helper(void *arg)
+{
+    struct parallel_for *work = (struct parallel_for *)arg;
+
+    while (parallel_for_step(work))
+        ;
+    parallel_for_release(work);
+}
+
+void thread_pool_parallel_for(struct thread_pool *pool, unsigned int count, thread_pool_for_fn fn, void *arg)
+{
+    struct parallel_for *work;
+    unsigned int helpers, i;
+
+    if (count == 0)
+        return;
+    work = pool != NULL && count > 1 ? (struct parallel_for *)calloc(1, sizeof(*work)) : NULL;
+    if (work == NULL)
+    {
+        for (i = 0; i < count; i++)
+            fn(arg, i);
+        return;
+    }
+
+    work->fn = fn;
+    work->arg = arg;
+    work->count = count;
+    pthread_mutex_init(&work->lock, NULL);
+    pthread_cond_init(&work->finished, NULL);
+
+    helpers = count - 1 < pool->thread_count ? count - 1 : pool->thread_count;
+    work->refs = 1 + helpers;
+    for (i = 0; i < helpers; i++)
+    {
+        if (!thread_pool_submit(pool, parallel_for_helper, work))
+            parallel_for_release(work);
+    }
+
+    while (parallel_for_step(work))
+        ;
+    pthread_mutex_lock(&work->lock);
+    while (work->done < work->count)
+        pthread_cond_wait(&work->finished, &work->lock);
+    pthread_mutex_unlock(&work->lock);
+    parallel_for_release(work);
+}
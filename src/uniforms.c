@@ -0,0 +1,48 @@
+#include <uniforms.h>
+
+#include <string.h>
+
+static const char *block_names[] = { "Frame", "Material", "Draw", "Lighting", "Shadows" };
+static const char *sampler_names[] = { "atlas", "materials", "lights", "lightGrid", "lightIndices", "shadowMap", "albedo" };
+
+void uniforms_bind_blocks(unsigned int program)
+{
+    GLint previous = 0, location;
+    unsigned int i;
+
+    for (i = 0; i < sizeof(block_names) / sizeof(block_names[0]); i++)
+    {
+        GLuint index = glGetUniformBlockIndex(program, block_names[i]);
+        if (index != GL_INVALID_INDEX)
+            glUniformBlockBinding(program, index, i);
+    }
+
+    // sampler units are plain uniforms, which 3.3 can only set on the current program
+    glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+    glUseProgram(program);
+    for (i = 0; i < sizeof(sampler_names) / sizeof(sampler_names[0]); i++)
+    {
+        location = glGetUniformLocation(program, sampler_names[i]);
+        if (location >= 0)
+            glUniform1i(location, (GLint)i);
+    }
+    glUseProgram((GLuint)previous);
+}
+
+int uniforms_push(struct ring_buffer *ring, enum uniform_binding binding, const void *data, size_t size)
+{
+    static GLint alignment = 0;
+    size_t offset;
+
+    if (alignment == 0)
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+    void *dst = ring_buffer_map(ring, size, (size_t)alignment, &offset);
+    if (dst == NULL)
+        return 0;
+    memcpy(dst, data, size);
+    ring_buffer_unmap(ring);
+
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, ring->buffer, (GLintptr)offset, (GLsizeiptr)size);
+    return 1;
+}
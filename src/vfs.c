@@ -0,0 +1,160 @@
+#include <vfs.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct mount
+{
+    struct pack pack;
+    char point[256];
+};
+
+static struct mount mounts[VFS_MAX_MOUNTS];
+static unsigned int mount_count;
+
+int vfs_mount(const char *pack_path, const char *mount_point)
+{
+    struct mount *mount;
+
+    if (mount_count == VFS_MAX_MOUNTS || strlen(mount_point) >= sizeof(mounts[0].point))
+        return 0;
+    mount = &mounts[mount_count];
+    if (!pack_open(&mount->pack, pack_path))
+        return 0;
+    snprintf(mount->point, sizeof(mount->point), "%s", mount_point);
+    mount_count++;
+    return 1;
+}
+
+void vfs_unmount_all(void)
+{
+    while (mount_count > 0)
+        pack_close(&mounts[--mount_count].pack);
+}
+
+// the pack entry that shadows path, if any
+static const struct pack_entry *resolve(const char *path, unsigned int *mount_index)
+{
+    unsigned int i = mount_count;
+
+    while (i-- > 0)
+    {
+        const struct pack_entry *entry;
+        size_t length = strlen(mounts[i].point);
+        const char *name = path;
+
+        if (length > 0)
+        {
+            if (strncmp(path, mounts[i].point, length) != 0 || path[length] != '/')
+                continue;
+            name = path + length + 1;
+        }
+        entry = pack_find(&mounts[i].pack, name);
+        if (entry != NULL)
+        {
+            *mount_index = i;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static unsigned char *read_file(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    unsigned char *data = NULL;
+    long length;
+
+    if (file == NULL)
+        return NULL;
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        data = (unsigned char *)malloc((size_t)length + 1);
+        if (data != NULL && fread(data, 1, (size_t)length, file) == (size_t)length)
+        {
+            data[length] = '\0';
+            if (size != NULL)
+                *size = (size_t)length;
+        }
+        else
+        {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(file);
+    return data;
+}
+
+unsigned char *vfs_read(const char *path, size_t *size)
+{
+    unsigned int mount;
+    const struct pack_entry *entry = resolve(path, &mount);
+
+    if (entry != NULL)
+        return pack_read(&mounts[mount].pack, entry, size);
+    return read_file(path, size);
+}
+
+void vfs_read_batch(const char *const *paths, unsigned int count, unsigned char **data, size_t *sizes,
+    struct thread_pool *pool)
+{
+    struct pack_read *reads = (struct pack_read *)malloc(sizeof(struct pack_read) * (count ? count : 1));
+    unsigned int *owners = (unsigned int *)malloc(sizeof(unsigned int) * (count ? count : 1));
+    unsigned int *mount_of = (unsigned int *)malloc(sizeof(unsigned int) * (count ? count : 1));
+    unsigned int i, mount;
+
+    if (reads == NULL || owners == NULL || mount_of == NULL)
+    {
+        // still correct, just one file at a time
+        for (i = 0; i < count; i++)
+            data[i] = vfs_read(paths[i], &sizes[i]);
+        free(reads);
+        free(owners);
+        free(mount_of);
+        return;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        data[i] = NULL;
+        sizes[i] = 0;
+        reads[i].entry = resolve(paths[i], &mount_of[i]);
+        if (reads[i].entry == NULL)
+            data[i] = read_file(paths[i], &sizes[i]);
+    }
+    for (mount = 0; mount < mount_count; mount++)
+    {
+        struct pack_read *batch;
+        unsigned int batch_count = 0;
+
+        // compact this pack's reads to the front of a scratch copy
+        for (i = 0; i < count; i++)
+        {
+            if (reads[i].entry != NULL && mount_of[i] == mount)
+                owners[batch_count++] = i;
+        }
+        if (batch_count == 0)
+            continue;
+        batch = (struct pack_read *)malloc(sizeof(struct pack_read) * batch_count);
+        if (batch == NULL)
+        {
+            for (i = 0; i < batch_count; i++)
+                data[owners[i]] = pack_read(&mounts[mount].pack, reads[owners[i]].entry, &sizes[owners[i]]);
+            continue;
+        }
+        for (i = 0; i < batch_count; i++)
+            batch[i].entry = reads[owners[i]].entry;
+        pack_read_batch(&mounts[mount].pack, batch, batch_count, pool);
+        for (i = 0; i < batch_count; i++)
+        {
+            data[owners[i]] = batch[i].data;
+            sizes[owners[i]] = batch[i].size;
+        }
+        free(batch);
+    }
+    free(reads);
+    free(owners);
+    free(mount_of);
+}
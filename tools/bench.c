@@ -0,0 +1,1217 @@
+// microbenchmarks for the CPU side of the engine and the headless render pool. run "bench" for the list.
+
+#include <glad/glad.h>
+#include <bc.h>
+#include <bc_texture.h>
+#include <camera.h>
+#include <cube_field.h>
+#include <image.h>
+#include <light_clusters.h>
+#include <math3d.h>
+#include <mip.h>
+#include <raster.h>
+#include <render_pool.h>
+#include <shader.h>
+#include <texture_stream.h>
+#include <thread_pool.h>
+#include <uniforms.h>
+
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static unsigned char clamp_byte(float value)
+{
+    return (unsigned char)(value < 0.0f ? 0.0f : value > 255.0f ? 255.0f : value + 0.5f);
+}
+
+// something with smooth gradients, hard edges and noise in every channel, so filters and block
+// encoders have work to do whichever channels they look at
+static void fill_test_image(struct mip_level *level, int width, int height, unsigned int seed)
+{
+    int x, y;
+
+    level->width = width;
+    level->height = height;
+    level->size = (size_t)width * height * 4;
+    level->pixels = (unsigned char *)malloc(level->size);
+    if (level->pixels == NULL)
+    {
+        fprintf(stderr, "bench: out of memory\n");
+        exit(1);
+    }
+    for (y = 0; y < height; y++)
+    {
+        for (x = 0; x < width; x++)
+        {
+            unsigned char *p = level->pixels + ((size_t)y * width + x) * 4;
+            float u = (float)x / (float)width, v = (float)y / (float)height, noise[3];
+            int i;
+
+            for (i = 0; i < 3; i++)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                noise[i] = (float)(seed >> 24) / 255.0f - 0.5f;
+            }
+            p[0] = clamp_byte(200.0f * u + 40.0f * sinf(v * 37.0f) + 32.0f * noise[0]);
+            p[1] = clamp_byte((((x / 6) ^ (y / 6)) & 1 ? 180.0f : 50.0f) + 60.0f * v + 32.0f * noise[1]);
+            p[2] = clamp_byte(128.0f + 90.0f * sinf((u + v) * 17.0f) + 48.0f * noise[2]);
+            p[3] = clamp_byte(200.0f * v + 40.0f * sinf(u * 29.0f + v * 11.0f) + 24.0f * noise[0]);
+        }
+    }
+}
+
+static const char *simd_name(enum mip_simd simd)
+{
+    return simd == MIP_SIMD_AVX2 ? "avx2" : simd == MIP_SIMD_SSE ? "sse" : "scalar";
+}
+
+// largest per-byte difference between two chains, to show the SIMD paths agree with the scalar one
+static int chain_difference(const struct mip_level *a, const struct mip_level *b, unsigned int count)
+{
+    int worst = 0;
+    unsigned int i;
+    size_t j;
+
+    for (i = 1; i < count; i++)
+    {
+        for (j = 0; j < a[i].size; j++)
+        {
+            int d = abs((int)a[i].pixels[j] - (int)b[i].pixels[j]);
+            worst = d > worst ? d : worst;
+        }
+    }
+    return worst;
+}
+
+// bench mips [size] [images]: full chains of size x size images in megapixels (of level 0) per second
+static int bench_mips(int argc, char **argv)
+{
+    int size = argc > 0 ? atoi(argv[0]) : 2048;
+    unsigned int images = argc > 1 ? (unsigned int)atoi(argv[1]) : 16;
+    static const char *filter_names[] = { "box", "kaiser" };
+    enum mip_simd best = mip_simd(), simd;
+    struct mip_level reference[MIP_MAX_LEVELS], levels[MIP_MAX_LEVELS];
+    struct mip_chain *chains;
+    struct thread_pool pool;
+    int filter, srgb;
+    unsigned int i, count;
+
+    if (size < 1 || images < 1)
+    {
+        fprintf(stderr, "usage: bench mips [size] [images]\n");
+        return 1;
+    }
+    fill_test_image(&reference[0], size, size, 1);
+    levels[0] = reference[0];
+    double megapixels = (double)size * size / 1e6;
+
+    printf("single thread, one %dx%d chain:\n", size, size);
+    for (filter = MIP_FILTER_BOX; filter <= MIP_FILTER_KAISER; filter++)
+    {
+        for (srgb = 0; srgb <= 1; srgb++)
+        {
+            mip_set_simd(MIP_SIMD_NONE);
+            count = mip_generate(reference, MIP_MAX_LEVELS, (enum mip_filter)filter, srgb, NULL);
+            for (simd = MIP_SIMD_NONE; simd <= best; simd++)
+            {
+                mip_set_simd(simd);
+                double start = now_seconds();
+                mip_generate(levels, MIP_MAX_LEVELS, (enum mip_filter)filter, srgb, NULL);
+                double elapsed = now_seconds() - start;
+                printf("  %-6s %-5s %-6s %8.1f MP/s  (max diff vs scalar %d)\n", filter_names[filter],
+                    srgb ? "srgb" : "unorm", simd_name(simd), megapixels / elapsed,
+                    chain_difference(reference, levels, count));
+                mip_free(levels, count);
+            }
+            mip_free(reference, count);
+        }
+    }
+    mip_set_simd(best);
+
+    if (!thread_pool_init(&pool, 0))
+    {
+        fprintf(stderr, "bench: no thread pool\n");
+        return 1;
+    }
+    printf("%u workers, kaiser srgb, %s:\n", pool.thread_count, simd_name(best));
+
+    double start = now_seconds();
+    count = mip_generate(levels, MIP_MAX_LEVELS, MIP_FILTER_KAISER, 1, &pool);
+    printf("  one chain, rows split   %8.1f MP/s\n", megapixels / (now_seconds() - start));
+    mip_free(levels, count);
+
+    chains = (struct mip_chain *)calloc(images, sizeof(*chains));
+    for (i = 0; chains != NULL && i < images; i++)
+    {
+        chains[i].levels = (struct mip_level *)calloc(MIP_MAX_LEVELS, sizeof(struct mip_level));
+        if (chains[i].levels == NULL)
+            break;
+        chains[i].levels[0] = reference[0];
+        chains[i].max_levels = MIP_MAX_LEVELS;
+        chains[i].srgb = 1;
+    }
+    if (chains != NULL && i == images)
+    {
+        start = now_seconds();
+        mip_generate_batch(chains, images, MIP_FILTER_KAISER, &pool);
+        printf("  %u chains, batched     %8.1f MP/s\n", images, megapixels * images / (now_seconds() - start));
+    }
+    for (i = 0; chains != NULL && i < images; i++)
+    {
+        if (chains[i].levels != NULL)
+            mip_free(chains[i].levels, chains[i].count);
+        free(chains[i].levels);
+    }
+    free(chains);
+
+    thread_pool_shutdown(&pool);
+    free(reference[0].pixels);
+    return 0;
+}
+
+// peak signal to noise ratio over the first channels of two RGBA8 images
+static double psnr(const unsigned char *a, const unsigned char *b, size_t pixels, int channels)
+{
+    double squared = 0.0;
+    size_t i;
+    int c;
+
+    for (i = 0; i < pixels; i++)
+    {
+        for (c = 0; c < channels; c++)
+        {
+            double d = (double)a[i * 4 + c] - b[i * 4 + c];
+            squared += d * d;
+        }
+    }
+    if (squared == 0.0)
+        return INFINITY;
+    return 10.0 * log10(255.0 * 255.0 / (squared / ((double)pixels * channels)));
+}
+
+// bench bc [image]: encode speed and PSNR of every format in both modes, on one thread and the pool
+static int bench_bc(int argc, char **argv)
+{
+    static const struct
+    {
+        const char *name;
+        enum bc_format format;
+        int channels;
+    } formats[] = {
+        { "bc1", BC_FORMAT_BC1, 3 },
+        { "bc3", BC_FORMAT_BC3, 4 },
+        { "bc4", BC_FORMAT_BC4, 1 },
+        { "bc5", BC_FORMAT_BC5, 2 },
+        { "bc7", BC_FORMAT_BC7, 4 },
+    };
+    struct mip_level source;
+    struct thread_pool pool;
+    unsigned char *blocks, *decoded;
+    size_t f;
+    int quality;
+
+    if (argc > 0)
+    {
+        struct image image;
+        if (!image_load(argv[0], &image))
+        {
+            fprintf(stderr, "bench: can't load %s\n", argv[0]);
+            return 1;
+        }
+        source.width = image.width;
+        source.height = image.height;
+        source.size = (size_t)image.width * image.height * 4;
+        source.pixels = image.pixels;
+    }
+    else
+        fill_test_image(&source, 1024, 1024, 7);
+
+    blocks = (unsigned char *)malloc(bc_image_size(BC_FORMAT_BC7, source.width, source.height));
+    decoded = (unsigned char *)malloc(source.size);
+    if (blocks == NULL || decoded == NULL || !thread_pool_init(&pool, 0))
+    {
+        fprintf(stderr, "bench: out of memory\n");
+        return 1;
+    }
+    double megapixels = (double)source.width * source.height / 1e6;
+
+    printf("%dx%d, %u workers:\n", source.width, source.height, pool.thread_count);
+    for (f = 0; f < sizeof(formats) / sizeof(formats[0]); f++)
+    {
+        for (quality = BC_QUALITY_FAST; quality <= BC_QUALITY_HIGH; quality++)
+        {
+            double start = now_seconds();
+            bc_encode(&source, formats[f].format, (enum bc_quality)quality, NULL, blocks);
+            double single = now_seconds() - start;
+            start = now_seconds();
+            bc_encode(&source, formats[f].format, (enum bc_quality)quality, &pool, blocks);
+            double pooled = now_seconds() - start;
+
+            bc_decode(formats[f].format, blocks, source.width, source.height, decoded);
+            printf("  %s %-4s %8.1f MP/s  %8.1f MP/s pooled  %6.2f dB\n", formats[f].name,
+                quality == BC_QUALITY_HIGH ? "high" : "fast", megapixels / single, megapixels / pooled,
+                psnr(source.pixels, decoded, (size_t)source.width * source.height, formats[f].channels));
+        }
+    }
+
+    thread_pool_shutdown(&pool);
+    free(blocks);
+    free(decoded);
+    free(source.pixels);
+    return 0;
+}
+
+// milliseconds per light_clusters_build, best of a few runs
+static double time_binning(struct light_clusters *clusters, const struct camera *camera, const struct light *lights,
+    unsigned int count)
+{
+    double best = 1e9;
+    int run;
+
+    for (run = 0; run < 5; run++)
+    {
+        double start = now_seconds();
+        light_clusters_build(clusters, camera, lights, count, 1600, 900);
+        double elapsed = now_seconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    return best * 1000.0;
+}
+
+// bench lights [max lights]: cluster binning time as the light count doubles, scalar against SSE
+// and on one thread against the pool, for a normal and a wide field of view (at 90 degrees and up
+// the last slice's clusters reach out as far as the padding lanes of the SSE path)
+static int bench_lights(int argc, char **argv)
+{
+    static const float fovs[] = { 1.0471976f, 1.8f };
+    unsigned int max_lights = argc > 0 ? (unsigned int)atoi(argv[0]) : 16384;
+    unsigned int seed = 1, count, i, f;
+    struct light_clusters scalar, simd;
+    struct thread_pool pool;
+    struct camera camera;
+    struct light *lights;
+
+    lights = (struct light *)malloc(sizeof(*lights) * (max_lights ? max_lights : 1));
+    if (max_lights < 1 || lights == NULL || !thread_pool_init(&pool, 0))
+    {
+        fprintf(stderr, "usage: bench lights [max lights]\n");
+        return 1;
+    }
+    // lights strewn through a slab in front of the camera, the way a large level would have them;
+    // the far end is past LIGHT_CLUSTERS_FAR, where only the last slice sees them
+    for (i = 0; i < max_lights; i++)
+    {
+        float position[3], color[3] = { 1.0f, 1.0f, 1.0f };
+        seed = seed * 1664525u + 1013904223u;
+        position[0] = ((seed >> 8) & 0xffff) / 65535.0f * 200.0f - 100.0f;
+        seed = seed * 1664525u + 1013904223u;
+        position[1] = ((seed >> 8) & 0xffff) / 65535.0f * 20.0f - 10.0f;
+        seed = seed * 1664525u + 1013904223u;
+        position[2] = ((seed >> 8) & 0xffff) / 65535.0f * -240.0f;
+        light_point(&lights[i], position, 2.0f + (float)(seed >> 28), color);
+    }
+    light_clusters_init(&scalar, NULL);
+    light_clusters_init(&simd, NULL);
+    scalar.simd = 0;
+
+    for (f = 0; f < sizeof(fovs) / sizeof(fovs[0]); f++)
+    {
+        camera_init(&camera, fovs[f], 16.0f / 9.0f, 0.1f, 1);
+        printf("%dx%dx%d clusters, fov_y %.2f, %u workers:\n", LIGHT_CLUSTERS_X, LIGHT_CLUSTERS_Y, LIGHT_CLUSTERS_Z,
+            fovs[f], pool.thread_count);
+        for (count = 256; count <= max_lights; count *= 2)
+        {
+            double scalar_ms = time_binning(&scalar, &camera, lights, count);
+            double simd_ms = time_binning(&simd, &camera, lights, count);
+            simd.pool = &pool;
+            double pooled_ms = time_binning(&simd, &camera, lights, count);
+            simd.pool = NULL;
+            int same = scalar.index_count == simd.index_count &&
+                memcmp(scalar.grid, simd.grid, sizeof(scalar.grid)) == 0 &&
+                memcmp(scalar.indices, simd.indices, sizeof(uint32_t) * simd.index_count) == 0;
+            printf("  %6u lights %8.3f ms scalar %8.3f ms sse %8.3f ms pooled  %6.1f lights/cluster%s\n", count,
+                scalar_ms, simd_ms, pooled_ms, (double)simd.index_count / LIGHT_CLUSTER_COUNT, same ? "" : "  MISMATCH");
+        }
+    }
+
+    light_clusters_shutdown(&scalar);
+    light_clusters_shutdown(&simd);
+    thread_pool_shutdown(&pool);
+    free(lights);
+    return 0;
+}
+
+// an occluded scene: walls close to the camera, drawn first, in front of main's cube field
+static void draw_raster_scene(struct raster_target *target, const struct camera *camera,
+    const struct raster_vertex_array *cube, const struct raster_pipeline *walls, const struct raster_pipeline *cubes)
+{
+    const float wall_color[4] = { 0.6f, 0.6f, 0.55f, 0.5f }, cube_color[4] = { 0.9f, 0.3f, 0.3f, 0.75f };
+    float model[16], scale[16];
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        mat4_translation(model, (float)(i - 1) * 5.0f, 0.0f, -6.0f);
+        mat4_scale(scale, 3.5f, 8.0f, 0.5f);
+        mat4_multiply(model, model, scale);
+        raster_draw(target, camera->view_projection, model, cube, wall_color, walls);
+    }
+    for (i = 0; i < CUBE_FIELD_COUNT; i++)
+    {
+        float position[3];
+        cube_field_position((unsigned int)i, position);
+        mat4_translation(model, position[0], position[1], position[2]);
+        raster_draw(target, camera->view_projection, model, cube, cube_color, cubes);
+    }
+}
+
+// bench raster [frames]: the CPU rasterizer on an occluded scene with and without hierarchical
+// depth, and how much of the scene each rejects
+static int bench_raster(int argc, char **argv)
+{
+    const float clear_color[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+    const struct raster_pipeline flat = { RASTER_SHADER_FLAT, RASTER_BLEND_NONE }, lit = { RASTER_SHADER_LIT, RASTER_BLEND_NONE };
+    const int width = 1280, height = 720;
+    unsigned int frames = argc > 0 ? (unsigned int)atoi(argv[0]) : 60, frame;
+    unsigned char *images[2] = { NULL, NULL };
+    struct thread_pool pool;
+    struct raster_vertex_array cube_array;
+    struct raster_target target;
+    struct mesh_data cube;
+    struct camera camera;
+    int hiz;
+
+    images[0] = (unsigned char *)malloc((size_t)width * height * 4);
+    images[1] = (unsigned char *)malloc((size_t)width * height * 4);
+    if (frames < 1 || images[0] == NULL || images[1] == NULL || !cube_mesh_create(&cube) ||
+        !thread_pool_init(&pool, 0) || !raster_target_init(&target, width, height, 1, 1, &pool))
+    {
+        fprintf(stderr, "usage: bench raster [frames]\n");
+        return 1;
+    }
+    raster_vertex_array_from_mesh(&cube_array, &cube);
+    target.light[0] = 0.36f;
+    target.light[1] = 0.8f;
+    target.light[2] = 0.48f;
+    camera_init(&camera, 1.0471976f, (float)width / (float)height, 0.1f, 1);
+    camera.position[1] = 1.0f;
+    camera.position[2] = 8.0f;
+    camera.pitch = -0.15f;
+
+    printf("%dx%d, %u frames, %u workers:\n", width, height, frames, pool.thread_count);
+    for (hiz = 1; hiz >= 0; hiz--)
+    {
+        struct raster_stats total;
+        uint64_t covered = 0;
+        double elapsed = 0.0;
+        size_t i;
+
+        memset(&total, 0, sizeof(total));
+        target.hierarchical_z = hiz;
+        for (frame = 0; frame < frames; frame++)
+        {
+            camera.yaw = 0.4f * sinf((float)frame * 6.2831853f / (float)frames);
+            camera_update(&camera);
+            double start = now_seconds();
+            raster_clear(&target, clear_color);
+            draw_raster_scene(&target, &camera, &cube_array, &flat, &lit);
+            raster_flush(&target);
+            elapsed += now_seconds() - start;
+            total.tiles_tested += target.stats.tiles_tested;
+            total.tiles_rejected += target.stats.tiles_rejected;
+            total.tiles_accepted += target.stats.tiles_accepted;
+            total.pixels_rejected += target.stats.pixels_rejected;
+            total.fragments += target.stats.fragments;
+            for (i = 0; i < (size_t)target.tiles_x * target.tiles_y * RASTER_TILE_SIZE * RASTER_TILE_SIZE; i++)
+                covered += target.depth[i] > 0.0f;
+        }
+        raster_read_pixels(&target, images[hiz]);
+        printf("  hi-z %-3s %7.2f ms/frame  %6u of %6u tiles rejected, %6u accepted  %8.0f pixels rejected  "
+            "%.2f fragments/covered pixel\n", hiz ? "on" : "off", elapsed * 1000.0 / frames,
+            total.tiles_rejected / frames, total.tiles_tested / frames, total.tiles_accepted / frames,
+            (double)total.pixels_rejected / frames, (double)total.fragments / (double)(covered ? covered : 1));
+    }
+    if (memcmp(images[0], images[1], (size_t)width * height * 4) != 0)
+        printf("  MISMATCH between hi-z on and off\n");
+
+    raster_target_destroy(&target);
+    thread_pool_shutdown(&pool);
+    mesh_free(&cube);
+    free(images[0]);
+    free(images[1]);
+    return 0;
+}
+
+// bench kernels [frames]: nanoseconds per covered pixel of every pipeline's specialized pixel loop
+// against the generic one, flushing on one thread
+static int bench_kernels(int argc, char **argv)
+{
+    static const struct raster_pipeline pipelines[] = {
+        { RASTER_SHADER_FLAT, RASTER_BLEND_NONE },
+        { RASTER_SHADER_FLAT, RASTER_BLEND_ALPHA },
+        { RASTER_SHADER_LIT, RASTER_BLEND_NONE },
+        { RASTER_SHADER_LIT, RASTER_BLEND_ALPHA },
+    };
+    const float clear_color[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+    const int width = 1280, height = 720;
+    unsigned int frames = argc > 0 ? (unsigned int)atoi(argv[0]) : 20, frame;
+    unsigned char *images[2] = { NULL, NULL };
+    struct raster_vertex_array cube_array;
+    struct raster_target target;
+    struct mesh_data cube;
+    struct camera camera;
+    size_t p;
+
+    images[0] = (unsigned char *)malloc((size_t)width * height * 4);
+    images[1] = (unsigned char *)malloc((size_t)width * height * 4);
+    if (frames < 1 || images[0] == NULL || images[1] == NULL || !cube_mesh_create(&cube) ||
+        !raster_target_init(&target, width, height, 1, 1, NULL))
+    {
+        fprintf(stderr, "usage: bench kernels [frames]\n");
+        return 1;
+    }
+    raster_vertex_array_from_mesh(&cube_array, &cube);
+    target.light[0] = 0.36f;
+    target.light[1] = 0.8f;
+    target.light[2] = 0.48f;
+    camera_init(&camera, 1.0471976f, (float)width / (float)height, 0.1f, 1);
+    camera.position[1] = 1.0f;
+    camera.position[2] = 8.0f;
+    camera.pitch = -0.15f;
+
+    printf("%dx%d, %u frames, one thread:\n", width, height, frames);
+    for (p = 0; p < sizeof(pipelines) / sizeof(pipelines[0]); p++)
+    {
+        double ns[2];
+        int specialized;
+
+        for (specialized = 1; specialized >= 0; specialized--)
+        {
+            double elapsed = 0.0;
+            uint64_t pixels = 0;
+
+            target.specialized = specialized;
+            for (frame = 0; frame < frames; frame++)
+            {
+                camera.yaw = 0.4f * sinf((float)frame * 6.2831853f / (float)frames);
+                camera_update(&camera);
+                raster_clear(&target, clear_color);
+                draw_raster_scene(&target, &camera, &cube_array, &pipelines[p], &pipelines[p]);
+                double start = now_seconds();
+                raster_flush(&target);
+                elapsed += now_seconds() - start;
+                pixels += target.stats.fragments + target.stats.pixels_rejected;
+            }
+            raster_read_pixels(&target, images[specialized]);
+            ns[specialized] = elapsed * 1e9 / (double)(pixels ? pixels : 1);
+        }
+        printf("  %-4s %-5s %6.2f ns/pixel specialized %6.2f ns/pixel generic  %.2fx%s\n",
+            pipelines[p].shader == RASTER_SHADER_LIT ? "lit" : "flat",
+            pipelines[p].blend == RASTER_BLEND_ALPHA ? "alpha" : "opaque", ns[1], ns[0], ns[0] / ns[1],
+            memcmp(images[0], images[1], (size_t)width * height * 4) ? "  MISMATCH" : "");
+    }
+
+    raster_target_destroy(&target);
+    mesh_free(&cube);
+    free(images[0]);
+    free(images[1]);
+    return 0;
+}
+
+// a size x size grid of quads rippling in front of the camera, every vertex shared by up to six
+// triangles
+static int make_ripple_mesh(struct mesh_data *mesh, unsigned int size)
+{
+    unsigned int x, y, i = 0;
+
+    memset(mesh, 0, sizeof(*mesh));
+    mesh->vertex_count = (size + 1) * (size + 1);
+    mesh->index_count = size * size * 6;
+    mesh->vertices = (struct mesh_vertex *)calloc(mesh->vertex_count, sizeof(*mesh->vertices));
+    mesh->indices = (uint32_t *)malloc(sizeof(*mesh->indices) * mesh->index_count);
+    if (mesh->vertices == NULL || mesh->indices == NULL)
+        return 0;
+    for (y = 0; y <= size; y++)
+    {
+        for (x = 0; x <= size; x++)
+        {
+            struct mesh_vertex *v = &mesh->vertices[y * (size + 1) + x];
+            float u = (float)x / size * 2.0f - 1.0f, w = (float)y / size * 2.0f - 1.0f;
+            v->position[0] = u * 8.0f;
+            v->position[1] = w * 4.5f;
+            v->position[2] = 0.3f * sinf(u * 20.0f) * cosf(w * 14.0f);
+            v->normal[0] = -6.0f * cosf(u * 20.0f) * cosf(w * 14.0f) / 8.0f;
+            v->normal[1] = 4.2f * sinf(u * 20.0f) * sinf(w * 14.0f) / 4.5f;
+            v->normal[2] = 1.0f;
+        }
+    }
+    for (y = 0; y < size; y++)
+    {
+        for (x = 0; x < size; x++)
+        {
+            uint32_t corner = y * (size + 1) + x;
+            mesh->indices[i++] = corner;
+            mesh->indices[i++] = corner + 1;
+            mesh->indices[i++] = corner + size + 2;
+            mesh->indices[i++] = corner;
+            mesh->indices[i++] = corner + size + 2;
+            mesh->indices[i++] = corner + size + 1;
+        }
+    }
+    return 1;
+}
+
+// milliseconds per raster_draw of the whole mesh, best of a few runs
+static double time_vertex_stage(struct raster_target *target, const float *view_projection,
+    const struct raster_vertex_array *array)
+{
+    const float color[4] = { 0.8f, 0.8f, 0.8f, 1.0f }, clear_color[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    const struct raster_pipeline lit = { RASTER_SHADER_LIT, RASTER_BLEND_NONE };
+    float model[16];
+    double best = 1e9;
+    int run;
+
+    mat4_translation(model, 0.0f, 0.0f, -8.0f);
+    for (run = 0; run < 5; run++)
+    {
+        raster_clear(target, clear_color);
+        double start = now_seconds();
+        raster_draw(target, view_projection, model, array, color, &lit);
+        double elapsed = now_seconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    return best * 1000.0;
+}
+
+// bench vertices [grid size]: the CPU rasterizer's vertex stage on one big shared-vertex mesh,
+// scalar against AVX2 and on one thread against the pool
+static int bench_vertices(int argc, char **argv)
+{
+    unsigned int size = argc > 0 ? (unsigned int)atoi(argv[0]) : 512;
+    struct raster_target single, pooled;
+    struct raster_vertex_array array;
+    struct thread_pool pool;
+    struct mesh_data mesh;
+    struct camera camera;
+
+    if (size < 1 || !make_ripple_mesh(&mesh, size) || !thread_pool_init(&pool, 0) ||
+        !raster_target_init(&single, 1280, 720, 1, 1, NULL) || !raster_target_init(&pooled, 1280, 720, 1, 1, &pool))
+    {
+        fprintf(stderr, "usage: bench vertices [grid size]\n");
+        return 1;
+    }
+    raster_vertex_array_from_mesh(&array, &mesh);
+    camera_init(&camera, 1.0471976f, 16.0f / 9.0f, 0.1f, 1);
+    camera_update(&camera);
+
+    printf("%u triangles, %u vertices, %u workers%s:\n", mesh.index_count / 3, mesh.vertex_count,
+        pool.thread_count, single.simd ? "" : " (no AVX2)");
+    single.simd = 0;
+    double scalar_ms = time_vertex_stage(&single, camera.view_projection, &array);
+    struct raster_triangle *scalar = (struct raster_triangle *)malloc(sizeof(*scalar) * single.triangle_count);
+    unsigned int scalar_count = single.triangle_count;
+    if (scalar != NULL)
+        memcpy(scalar, single.triangles, sizeof(*scalar) * scalar_count);
+    single.simd = pooled.simd;
+    double simd_ms = time_vertex_stage(&single, camera.view_projection, &array);
+    double pooled_ms = time_vertex_stage(&pooled, camera.view_projection, &array);
+    int same = scalar != NULL && scalar_count == single.triangle_count && scalar_count == pooled.triangle_count &&
+        memcmp(scalar, single.triangles, sizeof(*scalar) * scalar_count) == 0 &&
+        memcmp(scalar, pooled.triangles, sizeof(*scalar) * scalar_count) == 0;
+    printf("  %8.2f ms scalar %8.2f ms simd %8.2f ms pooled  %.1f Mtriangles/s pooled\n", scalar_ms, simd_ms,
+        pooled_ms, mesh.index_count / 3 / pooled_ms / 1000.0);
+    printf("  %u vertices transformed for %u indices (%.2f per vertex), %u triangles set up%s\n",
+        pooled.stats.vertices, mesh.index_count, (double)mesh.index_count / pooled.stats.vertices,
+        pooled.triangle_count, same ? "" : "  MISMATCH");
+
+    free(scalar);
+    raster_target_destroy(&single);
+    raster_target_destroy(&pooled);
+    thread_pool_shutdown(&pool);
+    mesh_free(&mesh);
+    return 0;
+}
+
+// bench msaa [frames]: frame time of the CPU rasterizer with 4x multisampling against without,
+// resolve included, and how many pixels needed samples of their own
+static int bench_msaa(int argc, char **argv)
+{
+    const float clear_color[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+    const struct raster_pipeline walls = { RASTER_SHADER_FLAT, RASTER_BLEND_ALPHA },
+        cubes = { RASTER_SHADER_LIT, RASTER_BLEND_NONE };
+    const int width = 1280, height = 720;
+    unsigned int frames = argc > 0 ? (unsigned int)atoi(argv[0]) : 30, frame;
+    unsigned char *image = (unsigned char *)malloc((size_t)width * height * 4);
+    struct raster_target targets[2];
+    struct raster_vertex_array cube_array;
+    struct thread_pool pool;
+    struct mesh_data cube;
+    struct camera camera;
+    double ms[2];
+    int t;
+
+    memset(targets, 0, sizeof(targets));
+    if (frames < 1 || image == NULL || !cube_mesh_create(&cube) || !thread_pool_init(&pool, 0) ||
+        !raster_target_init(&targets[0], width, height, 1, 1, &pool) ||
+        !raster_target_init(&targets[1], width, height, RASTER_MSAA_SAMPLES, 1, &pool))
+    {
+        fprintf(stderr, "usage: bench msaa [frames]\n");
+        return 1;
+    }
+    raster_vertex_array_from_mesh(&cube_array, &cube);
+    camera_init(&camera, 1.0471976f, (float)width / (float)height, 0.1f, 1);
+    camera.position[1] = 1.0f;
+    camera.position[2] = 8.0f;
+    camera.pitch = -0.15f;
+
+    printf("%dx%d, %u frames, %u workers:\n", width, height, frames, pool.thread_count);
+    for (t = 0; t < 2; t++)
+    {
+        struct raster_target *target = &targets[t];
+        uint64_t edge_pixels = 0;
+        double elapsed = 0.0;
+        int i;
+
+        target->light[0] = 0.36f;
+        target->light[1] = 0.8f;
+        target->light[2] = 0.48f;
+        for (frame = 0; frame < frames; frame++)
+        {
+            camera.yaw = 0.4f * sinf((float)frame * 6.2831853f / (float)frames);
+            camera_update(&camera);
+            double start = now_seconds();
+            raster_clear(target, clear_color);
+            draw_raster_scene(target, &camera, &cube_array, &walls, &cubes);
+            raster_flush(target);
+            raster_read_pixels(target, image);
+            elapsed += now_seconds() - start;
+            for (i = 0; target->tile_edges != NULL && i < target->tiles_x * target->tiles_y; i++)
+                edge_pixels += (uint64_t)__builtin_popcountll(target->tile_edges[i]);
+        }
+        ms[t] = elapsed * 1000.0 / frames;
+        printf("  %d sample%s %7.2f ms/frame  %8.0f edge pixels (%.1f%%)\n", target->samples,
+            target->samples > 1 ? "s" : " ", ms[t], (double)edge_pixels / frames,
+            100.0 * edge_pixels / frames / ((double)width * height));
+    }
+    printf("  multisampling costs %.2fx\n", ms[1] / ms[0]);
+
+    raster_target_destroy(&targets[0]);
+    raster_target_destroy(&targets[1]);
+    thread_pool_shutdown(&pool);
+    mesh_free(&cube);
+    free(image);
+    return 0;
+}
+
+// the GL scene bench render draws on every worker: main's cube field, one instanced draw, textured
+// with the test image. buffers, texture and program live in the pool's shared context; the vertex
+// array is per worker, since those aren't shared.
+struct render_scene
+{
+    unsigned int program;
+    unsigned int vertices;
+    unsigned int indices;
+    unsigned int offsets;
+    unsigned int texture;
+    unsigned int index_count;
+    unsigned int instance_count;
+    uint32_t *hashes;           // per job: FNV-1a of the pixels it read back
+    int failed;
+};
+
+// per worker: its vertex array, its Frame block, and the buffer frames are read back into. the
+// camera can't be a plain uniform: those belong to the program, which every worker shares.
+struct render_view
+{
+    unsigned int vertex_array;
+    unsigned int frame;
+    unsigned char *pixels;
+};
+
+#define RENDER_OFFSET_LOCATION 3
+
+static const char *render_vertex_source =
+    "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 2) in vec3 aNormal;\n"
+    "layout (location = 3) in vec3 aOffset;\n"
+    "layout (std140) uniform Frame\n"
+    "{\n"
+    "    mat4 view;\n"
+    "    mat4 projection;\n"
+    "    mat4 viewProjection;\n"
+    "    vec4 cameraPosition;\n"
+    "    vec4 time;\n"
+    "};\n"
+    "out vec3 normal;\n"
+    "out vec2 uv;\n"
+    "void main()\n"
+    "{\n"
+    "    vec3 position = aPos + aOffset;\n"
+    "    normal = aNormal;\n"
+    "    uv = position.xz * 0.05 + position.y * 0.1;\n"
+    "    gl_Position = viewProjection * vec4(position, 1.0);\n"
+    "}\n";
+
+static const char *render_fragment_source =
+    "#version 330 core\n"
+    "uniform sampler2D albedo;\n"
+    "in vec3 normal;\n"
+    "in vec2 uv;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "    float light = 0.3 + 0.7 * max(dot(normalize(normal), vec3(0.36, 0.8, 0.48)), 0.0);\n"
+    "    FragColor = vec4(texture(albedo, uv).rgb * light, 1.0);\n"
+    "}\n";
+
+// creates the scene's shared objects; runs with the shared context current
+static int create_render_scene(struct render_scene *scene, const struct mesh_data *cube)
+{
+    float offsets[CUBE_FIELD_COUNT * 3];
+    struct mip_level image;
+    char log[1024];
+    int i;
+
+    for (i = 0; i < CUBE_FIELD_COUNT; i++)
+        cube_field_position((unsigned int)i, &offsets[i * 3]);
+    scene->index_count = cube->index_count;
+    scene->instance_count = CUBE_FIELD_COUNT;
+    scene->program = shader_build_program(render_vertex_source, render_fragment_source, 0, log, sizeof(log));
+    if (scene->program == 0)
+    {
+        fprintf(stderr, "bench: %s\n", log);
+        return 0;
+    }
+    uniforms_bind_blocks(scene->program);
+
+    glGenBuffers(1, &scene->vertices);
+    glBindBuffer(GL_ARRAY_BUFFER, scene->vertices);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(cube->vertex_count * sizeof(*cube->vertices)), cube->vertices,
+        GL_STATIC_DRAW);
+    // uploaded through GL_ARRAY_BUFFER: the element binding belongs to a vertex array
+    glGenBuffers(1, &scene->indices);
+    glBindBuffer(GL_ARRAY_BUFFER, scene->indices);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(cube->index_count * sizeof(*cube->indices)), cube->indices,
+        GL_STATIC_DRAW);
+    glGenBuffers(1, &scene->offsets);
+    glBindBuffer(GL_ARRAY_BUFFER, scene->offsets);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(offsets), offsets, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    fill_test_image(&image, 256, 256, 7);
+    glGenTextures(1, &scene->texture);
+    glBindTexture(GL_TEXTURE_2D, scene->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, image.width, image.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image.pixels);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    free(image.pixels);
+    return 1;
+}
+
+static void destroy_render_scene(struct render_scene *scene)
+{
+    glDeleteProgram(scene->program);
+    glDeleteBuffers(1, &scene->vertices);
+    glDeleteBuffers(1, &scene->indices);
+    glDeleteBuffers(1, &scene->offsets);
+    glDeleteTextures(1, &scene->texture);
+}
+
+// render_pool_each: the worker's vertex array over the shared buffers, its Frame block and its depth
+// state
+static void create_render_view(struct render_worker *worker, void *arg, unsigned int index)
+{
+    struct render_scene *scene = (struct render_scene *)arg;
+    struct render_view *view = (struct render_view *)calloc(1, sizeof(*view));
+
+    (void)index;
+    worker->user = view;
+    if (view == NULL || (view->pixels = (unsigned char *)malloc((size_t)worker->pool->width *
+        worker->pool->height * 4)) == NULL)
+    {
+        scene->failed = 1;
+        return;
+    }
+    glGenVertexArrays(1, &view->vertex_array);
+    glBindVertexArray(view->vertex_array);
+    glBindBuffer(GL_ARRAY_BUFFER, scene->vertices);
+    glVertexAttribPointer(RASTER_POSITION_LOCATION, 3, GL_FLOAT, GL_FALSE, sizeof(struct mesh_vertex),
+        (void *)offsetof(struct mesh_vertex, position));
+    glEnableVertexAttribArray(RASTER_POSITION_LOCATION);
+    glVertexAttribPointer(RASTER_NORMAL_LOCATION, 3, GL_FLOAT, GL_FALSE, sizeof(struct mesh_vertex),
+        (void *)offsetof(struct mesh_vertex, normal));
+    glEnableVertexAttribArray(RASTER_NORMAL_LOCATION);
+    glBindBuffer(GL_ARRAY_BUFFER, scene->offsets);
+    glVertexAttribPointer(RENDER_OFFSET_LOCATION, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void *)0);
+    glVertexAttribDivisor(RENDER_OFFSET_LOCATION, 1);
+    glEnableVertexAttribArray(RENDER_OFFSET_LOCATION);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, scene->indices);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glGenBuffers(1, &view->frame);
+    glBindBuffer(GL_UNIFORM_BUFFER, view->frame);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(struct frame_uniforms), NULL, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, UNIFORM_BINDING_FRAME, view->frame);
+    camera_setup_depth();
+}
+
+static void destroy_render_view(struct render_worker *worker, void *arg, unsigned int index)
+{
+    struct render_view *view = (struct render_view *)worker->user;
+
+    (void)arg;
+    (void)index;
+    if (view != NULL)
+    {
+        glDeleteVertexArrays(1, &view->vertex_array);
+        glDeleteBuffers(1, &view->frame);
+        free(view->pixels);
+        free(view);
+    }
+    worker->user = NULL;
+}
+
+// one job: the scene from the job's own angle around the field, read back like an offline render
+static void render_job(struct render_worker *worker, void *arg, unsigned int index)
+{
+    struct render_scene *scene = (struct render_scene *)arg;
+    struct render_view *view = (struct render_view *)worker->user;
+    const int width = worker->pool->width, height = worker->pool->height;
+    struct frame_uniforms frame;
+    struct camera camera;
+    uint32_t hash = 2166136261u;
+    size_t i;
+
+    camera_init(&camera, 1.0471976f, (float)width / (float)height, 0.1f, GLAD_GL_ARB_clip_control);
+    camera.yaw = (float)index * 0.39269908f;
+    camera.pitch = -0.3f;
+    camera.position[0] = -40.0f * sinf(camera.yaw);
+    camera.position[1] = 12.0f;
+    camera.position[2] = 40.0f * cosf(camera.yaw);
+    camera_update(&camera);
+    memset(&frame, 0, sizeof(frame));
+    camera_fill_uniforms(&camera, &frame);
+
+    glBindBuffer(GL_UNIFORM_BUFFER, view->frame);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(frame), &frame);
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glUseProgram(scene->program);
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_ALBEDO);
+    glBindTexture(GL_TEXTURE_2D, scene->texture);
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArray(view->vertex_array);
+    glDrawElementsInstanced(GL_TRIANGLES, (GLsizei)scene->index_count, GL_UNSIGNED_INT, (void *)0,
+        (GLsizei)scene->instance_count);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, view->pixels);
+
+    for (i = 0; i < (size_t)width * height * 4; i++)
+        hash = (hash ^ view->pixels[i]) * 16777619u;
+    scene->hashes[index] = hash;
+}
+
+// bench render [max workers] [jobs]: frames per second of a render_pool rendering the cube field
+// from different angles, for 1, 2, 4 ... workers, each with a headless context of its own. every
+// job's image has to come out the same whatever the worker count. llvmpipe's own rasterizer threads
+// are off unless LP_NUM_THREADS says otherwise, so the scaling measured is the pool's.
+static int bench_render(int argc, char **argv)
+{
+    const int width = 1280, height = 720;
+    unsigned int max_workers = argc > 0 ? (unsigned int)atoi(argv[0]) : thread_pool_cpu_count();
+    unsigned int jobs = argc > 1 ? (unsigned int)atoi(argv[1]) : 64, workers;
+    uint32_t *reference = (uint32_t *)malloc(jobs * sizeof(uint32_t));
+    struct render_scene scene;
+    struct mesh_data cube;
+    double single = 0.0;
+
+    memset(&scene, 0, sizeof(scene));
+    scene.hashes = (uint32_t *)malloc(jobs * sizeof(uint32_t));
+    if (max_workers < 1 || jobs < 1 || reference == NULL || scene.hashes == NULL || !cube_mesh_create(&cube))
+    {
+        fprintf(stderr, "usage: bench render [max workers] [jobs]\n");
+        return 1;
+    }
+    setenv("LP_NUM_THREADS", "0", 0);
+
+    printf("%dx%d, %u jobs, LP_NUM_THREADS=%s:\n", width, height, jobs, getenv("LP_NUM_THREADS"));
+    for (workers = 1;; workers = workers * 2 < max_workers ? workers * 2 : max_workers)
+    {
+        struct render_pool pool;
+        double start, elapsed;
+
+        if (!render_pool_init(&pool, workers, width, height))
+        {
+            fprintf(stderr, "bench: no headless GL 3.3 context with %u workers\n", workers);
+            break;
+        }
+        if (!render_pool_begin_shared(&pool) || !create_render_scene(&scene, &cube))
+        {
+            render_pool_shutdown(&pool);
+            break;
+        }
+        render_pool_end_shared(&pool);
+        render_pool_each(&pool, create_render_view, &scene);
+
+        // one untimed job per worker first, so shader variants are compiled before the clock starts
+        if (!scene.failed)
+            render_pool_run(&pool, workers < jobs ? workers : jobs, render_job, &scene);
+        start = now_seconds();
+        if (!scene.failed)
+            render_pool_run(&pool, jobs, render_job, &scene);
+        elapsed = now_seconds() - start;
+
+        render_pool_each(&pool, destroy_render_view, NULL);
+        render_pool_begin_shared(&pool);
+        destroy_render_scene(&scene);
+        render_pool_end_shared(&pool);
+        render_pool_shutdown(&pool);
+        if (scene.failed)
+        {
+            fprintf(stderr, "bench: out of memory\n");
+            break;
+        }
+
+        if (workers == 1)
+        {
+            single = elapsed;
+            memcpy(reference, scene.hashes, jobs * sizeof(uint32_t));
+        }
+        printf("  %2u worker%s %8.1f frames/s  %5.2fx\n", workers, workers > 1 ? "s" : " ", jobs / elapsed,
+            single / elapsed);
+        if (memcmp(reference, scene.hashes, jobs * sizeof(uint32_t)) != 0)
+            printf("  MISMATCH against 1 worker\n");
+        if (workers == max_workers)
+            break;
+    }
+
+    mesh_free(&cube);
+    free(scene.hashes);
+    free(reference);
+    return 0;
+}
+
+// writes texture index of bench stream: a binary PPM for even indices, a BC1 .bct chain for odd ones
+static int write_stream_texture(const char *path, unsigned int index, int size, struct thread_pool *pool)
+{
+    struct mip_level levels[MIP_MAX_LEVELS];
+    int ok = 0;
+
+    fill_test_image(&levels[0], size, size, index + 1);
+    if (index % 2 == 0)
+    {
+        FILE *file = fopen(path, "wb");
+        size_t i;
+
+        if (file != NULL)
+        {
+            ok = fprintf(file, "P6\n%d %d\n255\n", size, size) > 0;
+            for (i = 0; ok && i < (size_t)size * size; i++)
+                ok = fwrite(levels[0].pixels + i * 4, 1, 3, file) == 3;
+            ok = fclose(file) == 0 && ok;
+        }
+    }
+    else
+    {
+        struct bc_texture compressed;
+        unsigned int count = mip_generate(levels, MIP_MAX_LEVELS, MIP_FILTER_KAISER, 0, pool);
+
+        if (bc_texture_build(&compressed, levels, count, BC_FORMAT_BC1, 0, BC_QUALITY_FAST, pool))
+        {
+            ok = bc_texture_save(&compressed, path);
+            bc_texture_free(&compressed);
+        }
+        mip_free(levels, count);
+    }
+    free(levels[0].pixels);
+    return ok;
+}
+
+static void remove_stream_textures(const char *directory, unsigned int count)
+{
+    char path[256];
+    unsigned int i;
+
+    for (i = 0; i < count; i++)
+    {
+        snprintf(path, sizeof(path), "%s/%u%s", directory, i, i % 2 ? BC_TEXTURE_EXTENSION : ".ppm");
+        unlink(path);
+    }
+    rmdir(directory);
+}
+
+// bench stream [textures] [budget MB] [frames]: texture_streamer_update in a 60 Hz frame loop under a
+// VRAM budget well below what the textures need, while the quarter of them in use slides from the
+// first to the last. half the files are images the workers decode and mipmap, half cooked BC1 chains.
+// reports the levels uploaded, evicted and read again, the time update takes on the GL thread and the
+// decoded pixels still held in memory at the end.
+static int bench_stream(int argc, char **argv)
+{
+    const int size = 512;
+    unsigned int count = argc > 0 ? (unsigned int)atoi(argv[0]) : 32;
+    int budget_mb = argc > 1 ? atoi(argv[1]) : 8;
+    unsigned int frames = argc > 2 ? (unsigned int)atoi(argv[2]) : 300, window, frame, i;
+    struct texture **textures = (struct texture **)calloc(count > 0 ? count : 1, sizeof(*textures));
+    char directory[] = "/tmp/bench_stream.XXXXXX", path[256];
+    unsigned long uploads = 0, evictions = 0, reloads = 0;
+    unsigned int compressed = 0, failed = 0;
+    size_t peak = 0, held = 0;
+    double total = 0.0, worst = 0.0, next;
+    struct texture_streamer streamer;
+    struct texture *texture;
+    struct render_pool gl;
+    struct thread_pool pool;
+
+    if (count < 2 || budget_mb < 1 || frames < 1 || textures == NULL || !thread_pool_init(&pool, 0))
+    {
+        fprintf(stderr, "usage: bench stream [textures] [budget MB] [frames]\n");
+        free(textures);
+        return 1;
+    }
+    window = count / 4 > 0 ? count / 4 : 1;
+    if (mkdtemp(directory) == NULL)
+    {
+        fprintf(stderr, "bench: can't create a directory under /tmp\n");
+        thread_pool_shutdown(&pool);
+        free(textures);
+        return 1;
+    }
+    for (i = 0; i < count; i++)
+    {
+        snprintf(path, sizeof(path), "%s/%u%s", directory, i, i % 2 ? BC_TEXTURE_EXTENSION : ".ppm");
+        if (!write_stream_texture(path, i, size, &pool))
+        {
+            fprintf(stderr, "bench: can't write %s\n", path);
+            remove_stream_textures(directory, count);
+            thread_pool_shutdown(&pool);
+            free(textures);
+            return 1;
+        }
+    }
+
+    // one worker is enough: the streamer runs on the shared context, on this thread
+    if (!render_pool_init(&gl, 1, 1, 1) || !render_pool_begin_shared(&gl))
+    {
+        fprintf(stderr, "bench: no headless GL 3.3 context\n");
+        remove_stream_textures(directory, count);
+        thread_pool_shutdown(&pool);
+        free(textures);
+        return 1;
+    }
+    texture_streamer_init(&streamer, &pool, (size_t)budget_mb * 1024 * 1024, 4 * 1024 * 1024);
+    for (i = 0; i < count; i++)
+    {
+        snprintf(path, sizeof(path), "%s/%u%s", directory, i, i % 2 ? BC_TEXTURE_EXTENSION : ".ppm");
+        textures[i] = texture_streamer_load(&streamer, path, 0);
+    }
+
+    printf("%u textures of %dx%d (%u images, %u .bct), %d MB budget, %u frames:\n", count, size, size,
+        (count + 1) / 2, count / 2, budget_mb, frames);
+    next = now_seconds();
+    for (frame = 0; frame < frames; frame++)
+    {
+        unsigned int first = (unsigned int)((unsigned long)frame * (count - window + 1) / frames);
+        double start = now_seconds(), elapsed, wait;
+
+        texture_streamer_update(&streamer);
+        elapsed = now_seconds() - start;
+        total += elapsed;
+        worst = elapsed > worst ? elapsed : worst;
+        uploads += streamer.uploads;
+        evictions += streamer.evictions;
+        reloads += streamer.reloads;
+        peak = streamer.resident > peak ? streamer.resident : peak;
+        for (i = first; i < first + window; i++)
+        {
+            if (textures[i] != NULL)
+                texture_streamer_use(&streamer, textures[i]);
+        }
+
+        // the time a real frame would spend drawing is the time decodes get between updates
+        next += 1.0 / 60.0;
+        wait = next - now_seconds();
+        if (wait > 0.0)
+        {
+            struct timespec ts;
+            ts.tv_sec = (time_t)wait;
+            ts.tv_nsec = (long)((wait - (double)ts.tv_sec) * 1e9);
+            nanosleep(&ts, NULL);
+        }
+    }
+
+    thread_pool_wait(&pool);
+    for (texture = streamer.textures; texture != NULL; texture = texture->next)
+    {
+        compressed += texture->compressed;
+        failed += texture->state == TEXTURE_FAILED;
+        for (i = 0; i < texture->mip_count; i++)
+            held += texture->mips[i].pixels != NULL ? texture->mips[i].size : 0;
+    }
+    printf("  uploads   %8lu levels\n", uploads);
+    printf("  evictions %8lu levels\n", evictions);
+    printf("  reloads   %8lu files read again for evicted levels\n", reloads);
+    printf("  resident  %8.2f MB at most, %.2f MB at the end\n", peak / 1048576.0, streamer.resident / 1048576.0);
+    printf("  update    %8.3f ms per frame, %.3f ms at worst\n", total * 1000.0 / frames, worst * 1000.0);
+    printf("  .bct      %8u uploaded compressed, %u decoded on the CPU\n", compressed, count / 2 - compressed);
+    printf("  decoded   %8.2f MB still in memory, waiting for an upload\n", held / 1048576.0);
+    if (failed > 0)
+        printf("  FAILED    %8u textures\n", failed);
+
+    texture_streamer_shutdown(&streamer);
+    render_pool_end_shared(&gl);
+    render_pool_shutdown(&gl);
+    thread_pool_shutdown(&pool);
+    remove_stream_textures(directory, count);
+    free(textures);
+    return 0;
+}
+
+struct benchmark
+{
+    const char *name;
+    const char *usage;
+    int (*run)(int argc, char **argv);
+};
+
+static const struct benchmark benchmarks[] = {
+    { "mips", "[size] [images]", bench_mips },
+    { "bc", "[image]", bench_bc },
+    { "lights", "[max lights]", bench_lights },
+    { "raster", "[frames]", bench_raster },
+    { "kernels", "[frames]", bench_kernels },
+    { "vertices", "[grid size]", bench_vertices },
+    { "msaa", "[frames]", bench_msaa },
+    { "render", "[max workers] [jobs]", bench_render },
+    { "stream", "[textures] [budget MB] [frames]", bench_stream },
+};
+
+int main(int argc, char **argv)
+{
+    size_t i;
+
+    for (i = 0; argc > 1 && i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++)
+    {
+        if (strcmp(argv[1], benchmarks[i].name) == 0)
+            return benchmarks[i].run(argc - 2, argv + 2);
+    }
+    fprintf(stderr, "usage: %s <benchmark> [args]\n", argv[0]);
+    for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++)
+        fprintf(stderr, "  %s %s\n", benchmarks[i].name, benchmarks[i].usage);
+    return 1;
+}
@@ -0,0 +1,725 @@
+// offline asset cooker: cook <source dir> <output dir> [-j threads] [-f]
+//
+// turns raw assets into the formats the engine loads at runtime, mirroring the source tree:
+//   .obj                -> .mesh (indexed, deduplicated vertices)
+//   .png .tga .ppm      -> .bct  (Kaiser mip chain, block compressed)
+//   .vert .frag         -> same name, includes expanded
+// <output dir>/cook.db remembers the size, mtime and content hash of every source file and, per
+// asset, the files it was built from. a run only re-reads files whose size or mtime changed and
+// only rebuilds assets whose inputs hash differently, spreading both over every core. -f rebuilds
+// everything.
+
+#include <bc_texture.h>
+#include <hash.h>
+#include <image.h>
+#include <mesh.h>
+#include <mip.h>
+#include <obj.h>
+#include <thread_pool.h>
+#include <vfs.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+// bump whenever a cooker's output changes, so every asset is rebuilt once
+#define COOK_VERSION 1
+#define COOK_DB "cook.db"
+#define MAX_INCLUDE_DEPTH 16
+#define MAX_PATH_LENGTH 1024
+
+enum asset_kind
+{
+    ASSET_NONE,                 // an input other assets may depend on, not cooked itself
+    ASSET_MESH,
+    ASSET_TEXTURE,
+    ASSET_SHADER
+};
+
+// a file of the source tree, as scanned now and as recorded by the last run
+struct source_file
+{
+    char *path;                 // relative to the source directory
+    enum asset_kind kind;
+    int present;                // found by this run's scan
+    int changed;                // size or mtime differ from the record: hash again
+    uint64_t size;
+    int64_t mtime;              // nanoseconds
+    uint64_t hash;              // of the contents
+    // the asset built from this file, if any
+    int has_record;
+    uint64_t key;               // inputs at the last successful cook
+    char **deps;                // relative paths, this file first
+    unsigned int dep_count;
+    int stale;
+    int failed;
+};
+
+struct cook
+{
+    char source_dir[MAX_PATH_LENGTH];
+    char output_dir[MAX_PATH_LENGTH];
+    struct source_file *files;
+    unsigned int file_count;
+    unsigned int file_capacity;
+    uint32_t *slots;            // open addressing by path: file index + 1, 0 when empty
+    uint32_t slot_count;
+    struct thread_pool pool;
+};
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static char *copy_string(const char *str)
+{
+    size_t length = strlen(str) + 1;
+    char *copy = (char *)malloc(length);
+
+    if (copy != NULL)
+        memcpy(copy, str, length);
+    return copy;
+}
+
+// directory/name, or name alone for an empty directory. returns 0 if it does not fit.
+static int join_path(char *out, size_t size, const char *directory, const char *name)
+{
+    int length = snprintf(out, size, "%s%s%s", directory, directory[0] && name[0] ? "/" : "", name);
+
+    return length >= 0 && (size_t)length < size;
+}
+
+static int has_extension(const char *path, const char *extension)
+{
+    size_t length = strlen(path), extension_length = strlen(extension);
+
+    return length >= extension_length && strcmp(path + length - extension_length, extension) == 0;
+}
+
+static enum asset_kind kind_of(const char *path)
+{
+    if (has_extension(path, ".obj"))
+        return ASSET_MESH;
+    if (has_extension(path, ".png") || has_extension(path, ".tga") || has_extension(path, ".ppm"))
+        return ASSET_TEXTURE;
+    if (has_extension(path, ".vert") || has_extension(path, ".frag"))
+        return ASSET_SHADER;
+    return ASSET_NONE;
+}
+
+// where the cooked form of a source file goes
+static int output_path(const struct cook *cook, const struct source_file *file, char *path, size_t size)
+{
+    const char *extension = file->kind == ASSET_MESH ? MESH_EXTENSION
+        : file->kind == ASSET_TEXTURE ? BC_TEXTURE_EXTENSION : NULL;
+    int length;
+
+    if (extension == NULL)
+        length = snprintf(path, size, "%s/%s", cook->output_dir, file->path);
+    else
+    {
+        const char *dot = strrchr(file->path, '.');
+        length = snprintf(path, size, "%s/%.*s%s", cook->output_dir, (int)(dot - file->path), file->path, extension);
+    }
+    return length > 0 && (size_t)length < size;
+}
+
+static struct source_file *find_file(const struct cook *cook, const char *path)
+{
+    uint32_t slot;
+
+    if (cook->slot_count == 0)
+        return NULL;
+    for (slot = (uint32_t)hash_string(HASH_SEED, path) & (cook->slot_count - 1); cook->slots[slot] != 0;
+         slot = (slot + 1) & (cook->slot_count - 1))
+    {
+        if (strcmp(cook->files[cook->slots[slot] - 1].path, path) == 0)
+            return &cook->files[cook->slots[slot] - 1];
+    }
+    return NULL;
+}
+
+static int grow_slots(struct cook *cook)
+{
+    uint32_t count = cook->slot_count ? cook->slot_count * 2 : 1024, i;
+    uint32_t *slots = (uint32_t *)calloc(count, sizeof(uint32_t));
+
+    if (slots == NULL)
+        return 0;
+    for (i = 0; i < cook->file_count; i++)
+    {
+        uint32_t slot = (uint32_t)hash_string(HASH_SEED, cook->files[i].path) & (count - 1);
+        while (slots[slot] != 0)
+            slot = (slot + 1) & (count - 1);
+        slots[slot] = i + 1;
+    }
+    free(cook->slots);
+    cook->slots = slots;
+    cook->slot_count = count;
+    return 1;
+}
+
+// the record for path, added if new. NULL if out of memory.
+static struct source_file *add_file(struct cook *cook, const char *path)
+{
+    struct source_file *file = find_file(cook, path);
+    uint32_t slot;
+
+    if (file != NULL)
+        return file;
+    if ((cook->file_count + 1) * 2 > cook->slot_count && !grow_slots(cook))
+        return NULL;
+    if (cook->file_count == cook->file_capacity)
+    {
+        unsigned int capacity = cook->file_capacity ? cook->file_capacity * 2 : 256;
+        struct source_file *files = (struct source_file *)realloc(cook->files, sizeof(*files) * capacity);
+        if (files == NULL)
+            return NULL;
+        cook->files = files;
+        cook->file_capacity = capacity;
+    }
+    file = &cook->files[cook->file_count];
+    memset(file, 0, sizeof(*file));
+    file->path = copy_string(path);
+    if (file->path == NULL)
+        return NULL;
+    file->kind = kind_of(path);
+    for (slot = (uint32_t)hash_string(HASH_SEED, path) & (cook->slot_count - 1); cook->slots[slot] != 0;
+         slot = (slot + 1) & (cook->slot_count - 1))
+        ;
+    cook->slots[slot] = ++cook->file_count;
+    return file;
+}
+
+static void free_deps(struct source_file *file)
+{
+    unsigned int i;
+
+    for (i = 0; i < file->dep_count; i++)
+        free(file->deps[i]);
+    free(file->deps);
+    file->deps = NULL;
+    file->dep_count = 0;
+}
+
+static int add_dep(char ***deps, unsigned int *count, const char *path)
+{
+    unsigned int i;
+    char **grown;
+
+    for (i = 0; i < *count; i++)
+    {
+        if (strcmp((*deps)[i], path) == 0)
+            return 1;
+    }
+    grown = (char **)realloc(*deps, sizeof(char *) * (*count + 1));
+    if (grown == NULL)
+        return 0;
+    *deps = grown;
+    if ((grown[*count] = copy_string(path)) == NULL)
+        return 0;
+    (*count)++;
+    return 1;
+}
+
+// cook.db: a version line, then tab separated records
+//   F <size> <mtime ns> <hash> <path>
+//   A <key> <path> <dep>...     (deps start with path itself)
+static void load_db(struct cook *cook)
+{
+    char path[MAX_PATH_LENGTH + 32];
+    unsigned char *text;
+    char *line, *next;
+
+    if (!join_path(path, sizeof(path), cook->output_dir, COOK_DB) || (text = vfs_read(path, NULL)) == NULL)
+        return;
+    if (strncmp((char *)text, "cook " , 5) != 0 || atoi((char *)text + 5) != COOK_VERSION)
+    {
+        // older cooker: the records do not describe what it would build now
+        free(text);
+        return;
+    }
+    for (line = strchr((char *)text, '\n'); line != NULL; line = next)
+    {
+        char *fields[4096];
+        unsigned int field_count = 0, i;
+        struct source_file *file;
+
+        line++;
+        next = strchr(line, '\n');
+        if (next != NULL)
+            *next = '\0';
+        for (fields[field_count++] = line; field_count < 4096 && (line = strchr(line, '\t')) != NULL;)
+        {
+            *line++ = '\0';
+            fields[field_count++] = line;
+        }
+
+        if (strcmp(fields[0], "F") == 0 && field_count == 5 && (file = add_file(cook, fields[4])) != NULL)
+        {
+            file->size = strtoull(fields[1], NULL, 10);
+            file->mtime = strtoll(fields[2], NULL, 10);
+            file->hash = strtoull(fields[3], NULL, 16);
+        }
+        else if (strcmp(fields[0], "A") == 0 && field_count >= 4 && (file = add_file(cook, fields[2])) != NULL)
+        {
+            file->has_record = 1;
+            file->key = strtoull(fields[1], NULL, 16);
+            for (i = 3; i < field_count; i++)
+            {
+                if (!add_dep(&file->deps, &file->dep_count, fields[i]))
+                    file->has_record = 0;
+            }
+        }
+    }
+    free(text);
+}
+
+static int save_db(const struct cook *cook)
+{
+    char path[MAX_PATH_LENGTH + 32], temporary[MAX_PATH_LENGTH + 32];
+    unsigned int i, j;
+    FILE *file;
+    int ok;
+
+    if (!join_path(path, sizeof(path), cook->output_dir, COOK_DB) ||
+        !join_path(temporary, sizeof(temporary), cook->output_dir, COOK_DB ".tmp") ||
+        (file = fopen(temporary, "w")) == NULL)
+        return 0;
+    fprintf(file, "cook %d\n", COOK_VERSION);
+    for (i = 0; i < cook->file_count; i++)
+    {
+        const struct source_file *source = &cook->files[i];
+        if (!source->present)
+            continue;
+        fprintf(file, "F\t%" PRIu64 "\t%" PRId64 "\t%016" PRIx64 "\t%s\n", source->size, source->mtime, source->hash,
+            source->path);
+        if (!source->has_record || source->failed)
+            continue;
+        fprintf(file, "A\t%016" PRIx64 "\t%s", source->key, source->path);
+        for (j = 0; j < source->dep_count; j++)
+            fprintf(file, "\t%s", source->deps[j]);
+        fputc('\n', file);
+    }
+    ok = !ferror(file);
+    ok &= fclose(file) == 0;
+    // replaced in one step, so an interrupted run leaves the previous database
+    ok = ok && rename(temporary, path) == 0;
+    if (!ok)
+        remove(temporary);
+    return ok;
+}
+
+static int64_t mtime_of(const struct stat *st)
+{
+#if defined(__APPLE__)
+    return (int64_t)st->st_mtimespec.tv_sec * 1000000000 + st->st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+    return (int64_t)st->st_mtim.tv_sec * 1000000000 + st->st_mtim.tv_nsec;
+#else
+    return (int64_t)st->st_mtime * 1000000000;
+#endif
+}
+
+static int scan(struct cook *cook, const char *relative)
+{
+    char path[MAX_PATH_LENGTH], name[MAX_PATH_LENGTH];
+    struct dirent *dirent;
+    DIR *dir;
+    int ok = 1;
+
+    if (!join_path(path, sizeof(path), cook->source_dir, relative) || (dir = opendir(path)) == NULL)
+    {
+        fprintf(stderr, "cook: cannot open %s\n", path);
+        return 0;
+    }
+    while (ok && (dirent = readdir(dir)) != NULL)
+    {
+        struct source_file *file;
+        struct stat st;
+
+        if (dirent->d_name[0] == '.' || strpbrk(dirent->d_name, "\t\n") != NULL)
+            continue;
+        if (!join_path(name, sizeof(name), relative, dirent->d_name) ||
+            !join_path(path, sizeof(path), cook->source_dir, name))
+        {
+            fprintf(stderr, "cook: path too long under %s\n", cook->source_dir);
+            ok = 0;
+            break;
+        }
+        if (stat(path, &st) != 0 || strcmp(path, cook->output_dir) == 0)
+            continue;
+        if (S_ISDIR(st.st_mode))
+            ok = scan(cook, name);
+        else if (S_ISREG(st.st_mode))
+        {
+            if ((file = add_file(cook, name)) == NULL)
+            {
+                ok = 0;
+                break;
+            }
+            file->present = 1;
+            file->changed = file->size != (uint64_t)st.st_size || file->mtime != mtime_of(&st);
+            file->size = (uint64_t)st.st_size;
+            file->mtime = mtime_of(&st);
+        }
+    }
+    closedir(dir);
+    return ok;
+}
+
+static void hash_task(void *arg, unsigned int index)
+{
+    struct cook *cook = (struct cook *)arg;
+    struct source_file *file = &cook->files[index];
+    char path[MAX_PATH_LENGTH];
+    unsigned char buffer[64 * 1024];
+    FILE *stream;
+    size_t read;
+
+    if (!file->present || !file->changed)
+        return;
+    file->hash = HASH_SEED;
+    if (!join_path(path, sizeof(path), cook->source_dir, file->path) || (stream = fopen(path, "rb")) == NULL)
+    {
+        file->present = 0;
+        return;
+    }
+    while ((read = fread(buffer, 1, sizeof(buffer), stream)) > 0)
+        file->hash = hash_bytes(file->hash, buffer, read);
+    fclose(stream);
+}
+
+// what an asset was built from: the cooker version, its kind and every input's path and contents.
+// 0 if an input is gone.
+static uint64_t asset_key(const struct cook *cook, enum asset_kind kind, char **deps, unsigned int dep_count)
+{
+    uint64_t key = HASH_SEED;
+    int version = COOK_VERSION;
+    unsigned int i;
+
+    key = hash_bytes(key, &version, sizeof(version));
+    key = hash_bytes(key, &kind, sizeof(kind));
+    for (i = 0; i < dep_count; i++)
+    {
+        const struct source_file *dep = find_file(cook, deps[i]);
+        if (dep == NULL || !dep->present)
+            return 0;
+        key = hash_string(key, deps[i]);
+        key = hash_bytes(key, &dep->hash, sizeof(dep->hash));
+    }
+    return key;
+}
+
+static int cook_mesh(const char *source, const char *output)
+{
+    struct mesh_data mesh;
+    char *text = (char *)vfs_read(source, NULL);
+    int ok;
+
+    if (text == NULL)
+        return 0;
+    ok = obj_parse(text, &mesh);
+    free(text);
+    if (!ok)
+        return 0;
+    ok = mesh.index_count > 0 && mesh_save(&mesh, output);
+    mesh_free(&mesh);
+    return ok;
+}
+
+// the format follows from the name and contents: *_normal maps keep two channels (BC5), *_mask
+// maps one (BC4), both linear; everything else is sRGB color, BC1 when opaque and BC7 otherwise
+static int cook_texture(struct cook *cook, struct source_file *file, const char *source, const char *output)
+{
+    struct mip_level levels[MIP_MAX_LEVELS];
+    struct bc_texture texture;
+    struct image image;
+    enum bc_format format = BC_FORMAT_BC1;
+    const char *dot = strrchr(file->path, '.');
+    unsigned int count;
+    size_t i;
+    int srgb = 1, ok;
+
+    if (!image_load(source, &image))
+        return 0;
+    if (dot - file->path >= 7 && strncmp(dot - 7, "_normal", 7) == 0)
+    {
+        format = BC_FORMAT_BC5;
+        srgb = 0;
+    }
+    else if (dot - file->path >= 5 && strncmp(dot - 5, "_mask", 5) == 0)
+    {
+        format = BC_FORMAT_BC4;
+        srgb = 0;
+    }
+    else
+    {
+        for (i = 0; i < (size_t)image.width * image.height; i++)
+        {
+            if (image.pixels[i * 4 + 3] != 255)
+            {
+                format = BC_FORMAT_BC7;
+                break;
+            }
+        }
+    }
+
+    levels[0].width = image.width;
+    levels[0].height = image.height;
+    levels[0].size = (size_t)image.width * image.height * 4;
+    levels[0].pixels = image.pixels;
+    // parallel_for lets a pool task use the pool, so one huge texture still uses every core
+    count = mip_generate(levels, MIP_MAX_LEVELS, MIP_FILTER_KAISER, srgb, &cook->pool);
+    ok = bc_texture_build(&texture, levels, count, format, srgb, BC_QUALITY_HIGH, &cook->pool);
+    mip_free(levels, count);
+    image_free(&image);
+    if (!ok)
+        return 0;
+    ok = bc_texture_save(&texture, output);
+    bc_texture_free(&texture);
+    return ok;
+}
+
+struct text
+{
+    char *data;
+    size_t length;
+    size_t capacity;
+};
+
+static int text_append(struct text *text, const char *data, size_t length)
+{
+    if (text->length + length + 1 > text->capacity)
+    {
+        size_t capacity = text->capacity ? text->capacity * 2 : 4096;
+        char *grown;
+        while (capacity < text->length + length + 1)
+            capacity *= 2;
+        grown = (char *)realloc(text->data, capacity);
+        if (grown == NULL)
+            return 0;
+        text->data = grown;
+        text->capacity = capacity;
+    }
+    memcpy(text->data + text->length, data, length);
+    text->length += length;
+    text->data[text->length] = '\0';
+    return 1;
+}
+
+// expands #include "file" the way the shader library does, relative to the top-level shader's
+// directory, so the runtime reads one self-contained file per stage. #line keeps compile errors on
+// the right line of the including file.
+static int expand_includes(struct cook *cook, struct source_file *file, const char *directory, const char *name,
+    int depth, struct text *out)
+{
+    char path[MAX_PATH_LENGTH], relative[MAX_PATH_LENGTH], marker[32];
+    const char *p;
+    char *source;
+    unsigned int line = 1;
+    int ok = 1;
+
+    if (depth > MAX_INCLUDE_DEPTH)
+    {
+        fprintf(stderr, "cook: %s: includes nested too deep\n", file->path);
+        return 0;
+    }
+    if (!join_path(relative, sizeof(relative), directory, name) ||
+        !join_path(path, sizeof(path), cook->source_dir, relative) || !add_dep(&file->deps, &file->dep_count, relative) || (source = (char *)vfs_read(path, NULL)) == NULL)
+    {
+        fprintf(stderr, "cook: %s: cannot read %s\n", file->path, relative);
+        return 0;
+    }
+    for (p = source; *p && ok; line++)
+    {
+        const char *end = strchr(p, '\n');
+        size_t length = end ? (size_t)(end - p) + 1 : strlen(p);
+        const char *directive = p;
+
+        while (*directive == ' ' || *directive == '\t')
+            directive++;
+        if (strncmp(directive, "#include", 8) == 0)
+        {
+            const char *open = strchr(directive, '"');
+            const char *close = open ? strchr(open + 1, '"') : NULL;
+            char include[256];
+            if (close == NULL || close > p + length)
+            {
+                fprintf(stderr, "cook: %s:%u: malformed #include\n", relative, line);
+                ok = 0;
+                break;
+            }
+            snprintf(include, sizeof(include), "%.*s", (int)(close - open - 1), open + 1);
+            ok = expand_includes(cook, file, directory, include, depth + 1, out);
+            snprintf(marker, sizeof(marker), "#line %u\n", line + 1);
+            ok = ok && text_append(out, marker, strlen(marker));
+        }
+        else
+            ok = text_append(out, p, length) && (end != NULL || text_append(out, "\n", 1));
+        p += length;
+    }
+    free(source);
+    return ok;
+}
+
+static int cook_shader(struct cook *cook, struct source_file *file, const char *source, const char *output)
+{
+    struct text text = { NULL, 0, 0 };
+    const char *slash = strrchr(file->path, '/');
+    char directory[MAX_PATH_LENGTH];
+    FILE *stream;
+    int ok;
+
+    (void)source;
+    snprintf(directory, sizeof(directory), "%.*s", slash ? (int)(slash - file->path) : 0, file->path);
+    ok = expand_includes(cook, file, directory, slash ? slash + 1 : file->path, 0, &text);
+    if (ok && (stream = fopen(output, "wb")) != NULL)
+    {
+        ok = fwrite(text.data, 1, text.length, stream) == text.length;
+        ok &= fclose(stream) == 0;
+        if (!ok)
+            remove(output);
+    }
+    else
+        ok = 0;
+    free(text.data);
+    return ok;
+}
+
+static void cook_task(void *arg, unsigned int index)
+{
+    struct cook *cook = (struct cook *)arg;
+    struct source_file *file = &cook->files[index];
+    char source[MAX_PATH_LENGTH], output[MAX_PATH_LENGTH];
+    int ok;
+
+    if (!file->stale)
+        return;
+    // inputs are rediscovered on every cook: an edit may have added or dropped includes
+    free_deps(file);
+    ok = join_path(source, sizeof(source), cook->source_dir, file->path) &&
+        output_path(cook, file, output, sizeof(output)) && add_dep(&file->deps, &file->dep_count, file->path);
+    if (ok && file->kind == ASSET_MESH)
+        ok = cook_mesh(source, output);
+    else if (ok && file->kind == ASSET_TEXTURE)
+        ok = cook_texture(cook, file, source, output);
+    else if (ok && file->kind == ASSET_SHADER)
+        ok = cook_shader(cook, file, source, output);
+    file->key = ok ? asset_key(cook, file->kind, file->deps, file->dep_count) : 0;
+    file->failed = !ok || file->key == 0;
+    file->has_record = !file->failed;
+    printf("%s %s\n", file->failed ? "FAILED" : "cooked", file->path);
+}
+
+// creates every missing directory on the way to path's parent
+static int make_parents(const char *path)
+{
+    char partial[MAX_PATH_LENGTH];
+    const char *slash;
+
+    for (slash = strchr(path + 1, '/'); slash != NULL; slash = strchr(slash + 1, '/'))
+    {
+        snprintf(partial, sizeof(partial), "%.*s", (int)(slash - path), path);
+        if (mkdir(partial, 0755) != 0 && errno != EEXIST)
+            return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    struct cook cook;
+    unsigned int threads = 0, i, asset_count = 0, stale_count = 0, failed_count = 0, removed_count = 0;
+    int force = 0, argi;
+    double start = now_seconds(), scanned, hashed;
+
+    memset(&cook, 0, sizeof(cook));
+    for (argi = 3; argi < argc; argi++)
+    {
+        if (strcmp(argv[argi], "-f") == 0)
+            force = 1;
+        else if (strcmp(argv[argi], "-j") == 0 && argi + 1 < argc)
+            threads = (unsigned int)atoi(argv[++argi]);
+    }
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: cook <source dir> <output dir> [-j threads] [-f]\n");
+        return 1;
+    }
+    snprintf(cook.source_dir, sizeof(cook.source_dir), "%s", argv[1]);
+    snprintf(cook.output_dir, sizeof(cook.output_dir), "%s", argv[2]);
+    if ((mkdir(cook.output_dir, 0755) != 0 && errno != EEXIST) || !thread_pool_init(&cook.pool, threads))
+    {
+        fprintf(stderr, "cook: cannot set up %s\n", cook.output_dir);
+        return 1;
+    }
+
+    if (!force)
+        load_db(&cook);
+    if (!scan(&cook, ""))
+    {
+        thread_pool_shutdown(&cook.pool);
+        return 1;
+    }
+    scanned = now_seconds();
+    thread_pool_parallel_for(&cook.pool, cook.file_count, hash_task, &cook);
+    hashed = now_seconds();
+
+    for (i = 0; i < cook.file_count; i++)
+    {
+        struct source_file *file = &cook.files[i];
+        char output[MAX_PATH_LENGTH];
+        struct stat st;
+
+        if (file->kind == ASSET_NONE || !output_path(&cook, file, output, sizeof(output)))
+            continue;
+        if (!file->present)
+        {
+            // the source is gone, so is what was cooked from it
+            if (file->has_record && remove(output) == 0)
+                removed_count++;
+            continue;
+        }
+        asset_count++;
+        file->stale = !file->has_record || stat(output, &st) != 0 ||
+            asset_key(&cook, file->kind, file->deps, file->dep_count) != file->key;
+        if (file->stale)
+        {
+            stale_count++;
+            if (!make_parents(output))
+                fprintf(stderr, "cook: cannot create the directory of %s\n", output);
+        }
+    }
+
+    // one task per file; up-to-date ones return at once
+    thread_pool_parallel_for(&cook.pool, cook.file_count, cook_task, &cook);
+    for (i = 0; i < cook.file_count; i++)
+        failed_count += cook.files[i].failed;
+    if (!save_db(&cook))
+        fprintf(stderr, "cook: cannot write %s/%s\n", cook.output_dir, COOK_DB);
+
+    printf("cook: %u assets, %u up to date, %u cooked, %u failed, %u removed\n", asset_count,
+        asset_count - stale_count, stale_count - failed_count, failed_count, removed_count);
+    printf("cook: scan %.3f s, hash %.3f s, cook %.3f s on %u threads\n", scanned - start, hashed - scanned,
+        now_seconds() - hashed, cook.pool.thread_count);
+
+    thread_pool_shutdown(&cook.pool);
+    for (i = 0; i < cook.file_count; i++)
+    {
+        free(cook.files[i].path);
+        free_deps(&cook.files[i]);
+    }
+    free(cook.files);
+    free(cook.slots);
+    return failed_count > 0;
+}
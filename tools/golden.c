@@ -0,0 +1,382 @@
+// golden image regression check for the CPU rasterizer: golden <check|update> [dir]
+//
+// renders every reference scene under each configuration below (threads, bin order, AVX2,
+// hierarchical depth, specialized kernels), which must all agree to the bit, then compares the
+// image against the one recorded in dir: <scene>.hash always, <scene>.ppm when it is there. a
+// mismatch writes <scene>.actual.ppm next to them and counts the pixels that changed. update
+// records the current images instead. references hold for one platform's libm and compiler; a
+// change that is meant to alter the output updates them in the same commit.
+
+#include <camera.h>
+#include <cube_field.h>
+#include <hash.h>
+#include <math3d.h>
+#include <raster.h>
+#include <thread_pool.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef GOLDEN_DIR
+#define GOLDEN_DIR "golden"
+#endif
+#define MAX_PATH_LENGTH 1024
+
+// the geometry scenes draw with
+struct scene_data
+{
+    struct raster_vertex_array quad;
+    struct raster_vertex_array cube;
+};
+
+struct scene
+{
+    const char *name;
+    int width;
+    int height;
+    int samples;
+    void (*draw)(struct raster_target *target, const struct scene_data *data);
+};
+
+// how a scene is rendered; every one must produce the same bits
+struct config
+{
+    const char *name;
+    int threads;                // workers in the pool, or -1 for none
+    int simd;                   // when the CPU has it
+    int hierarchical_z;
+    int specialized;
+    int reverse_bins;
+};
+
+static const struct config configs[] = {
+    { "plain", -1, 0, 0, 0, 0 },
+    { "default", -1, 1, 1, 1, 0 },
+    { "1 worker", 1, 1, 1, 1, 0 },
+    { "3 workers, bins reversed", 3, 1, 1, 1, 1 },
+    { "8 workers", 8, 1, 1, 1, 0 },
+    { "8 workers, scalar, generic, bins reversed", 8, 0, 1, 0, 1 },
+};
+
+static const float clear_color[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+
+// main()'s quad, as it sets it up
+static const float quad_vertices[] = {
+     0.5f,  0.5f, 0.0f,
+     0.5f, -0.5f, 0.0f,
+    -0.5f, -0.5f, 0.0f,
+    -0.5f,  0.5f, 0.0f
+};
+static const uint32_t quad_indices[] = { 0, 1, 3, 1, 2, 3 };
+
+static void setup_camera(struct camera *camera, const struct raster_target *target, float y, float z, float yaw,
+    float pitch)
+{
+    camera_init(camera, 1.0471976f, (float)target->width / (float)target->height, 0.1f, target->zero_to_one);
+    camera->position[1] = y;
+    camera->position[2] = z;
+    camera->yaw = yaw;
+    camera->pitch = pitch;
+    camera_update(camera);
+}
+
+// the first thing main() draws: the orange quad with basic.frag in front of the camera
+static void draw_quad(struct raster_target *target, const struct scene_data *data)
+{
+    const struct raster_pipeline flat = { RASTER_SHADER_FLAT, RASTER_BLEND_NONE };
+    const float color[4] = { 1.0f, 0.5f, 0.2f, 1.0f };
+    struct camera camera;
+    float model[16];
+
+    setup_camera(&camera, target, 0.0f, 3.0f, 0.0f, 0.0f);
+    mat4_identity(model);
+    raster_draw(target, camera.view_projection, model, &data->quad, color, &flat);
+}
+
+// a lit cube field behind three translucent walls: overdraw, blending, hierarchical depth
+static void draw_cubes(struct raster_target *target, const struct scene_data *data)
+{
+    const struct raster_pipeline walls = { RASTER_SHADER_FLAT, RASTER_BLEND_ALPHA },
+        cubes = { RASTER_SHADER_LIT, RASTER_BLEND_NONE };
+    const float wall_color[4] = { 0.6f, 0.6f, 0.55f, 0.5f }, cube_color[4] = { 0.9f, 0.3f, 0.3f, 1.0f };
+    struct camera camera;
+    float model[16], scale[16];
+    int i;
+
+    setup_camera(&camera, target, 1.0f, 8.0f, 0.2f, -0.15f);
+    for (i = 0; i < 3; i++)
+    {
+        mat4_translation(model, (float)(i - 1) * 5.0f, 0.0f, -6.0f);
+        mat4_scale(scale, 3.5f, 8.0f, 0.5f);
+        mat4_multiply(model, model, scale);
+        raster_draw(target, camera.view_projection, model, &data->cube, wall_color, &walls);
+    }
+    for (i = 0; i < CUBE_FIELD_COUNT; i++)
+    {
+        float position[3];
+        cube_field_position((unsigned int)i, position);
+        // the field's own heights come out of sinf, which libm and FMA contraction may round
+        // differently from machine to machine; a reference image can only use exact ones
+        position[1] = -2.0f + (float)(i * 7 % 5) * 0.25f;
+        mat4_translation(model, position[0], position[1], position[2]);
+        raster_draw(target, camera.view_projection, model, &data->cube, cube_color, &cubes);
+    }
+}
+
+// geometry through the near plane and far past the guard band: the clipper's cases
+static void draw_clipped(struct raster_target *target, const struct scene_data *data)
+{
+    const struct raster_pipeline lit = { RASTER_SHADER_LIT, RASTER_BLEND_NONE },
+        glass = { RASTER_SHADER_LIT, RASTER_BLEND_ALPHA };
+    const float ground_color[4] = { 0.4f, 0.7f, 0.4f, 1.0f }, cube_color[4] = { 0.3f, 0.4f, 0.9f, 0.6f };
+    struct camera camera;
+    float model[16], scale[16];
+
+    setup_camera(&camera, target, 0.5f, 0.0f, 0.3f, -0.2f);
+    mat4_translation(model, 0.0f, -1.0f, 0.0f);
+    mat4_scale(scale, 20000.0f, 0.1f, 20000.0f);
+    mat4_multiply(model, model, scale);
+    raster_draw(target, camera.view_projection, model, &data->cube, ground_color, &lit);
+    mat4_translation(model, 0.3f, 0.2f, -0.5f);
+    mat4_scale(scale, 1.5f, 1.5f, 1.5f);
+    mat4_multiply(model, model, scale);
+    raster_draw(target, camera.view_projection, model, &data->cube, cube_color, &glass);
+}
+
+static const struct scene scenes[] = {
+    { "quad", 800, 600, 1, draw_quad },
+    { "cubes", 640, 360, 1, draw_cubes },
+    { "cubes_msaa", 640, 360, RASTER_MSAA_SAMPLES, draw_cubes },
+    { "clipped", 640, 360, 1, draw_clipped },
+    { "clipped_msaa", 640, 360, RASTER_MSAA_SAMPLES, draw_clipped },
+};
+
+// renders scene under config into rgba, top row first
+static int render(const struct scene *scene, const struct scene_data *data, const struct config *config,
+    unsigned char *rgba)
+{
+    struct thread_pool pool;
+    struct raster_target target;
+    int y;
+
+    if (config->threads >= 0 && !thread_pool_init(&pool, (unsigned int)config->threads))
+        return 0;
+    if (!raster_target_init(&target, scene->width, scene->height, scene->samples, 1,
+        config->threads >= 0 ? &pool : NULL))
+    {
+        if (config->threads >= 0)
+            thread_pool_shutdown(&pool);
+        return 0;
+    }
+    target.simd = target.simd && config->simd;
+    target.hierarchical_z = config->hierarchical_z;
+    target.specialized = config->specialized;
+    target.reverse_bins = config->reverse_bins;
+    target.light[0] = 0.36f;
+    target.light[1] = 0.8f;
+    target.light[2] = 0.48f;
+    raster_clear(&target, clear_color);
+    scene->draw(&target, data);
+    raster_flush(&target);
+    raster_read_pixels(&target, rgba);
+    raster_target_destroy(&target);
+    if (config->threads >= 0)
+        thread_pool_shutdown(&pool);
+
+    // flipped so the images on disk are the right way up
+    size_t row = (size_t)scene->width * 4;
+    for (y = 0; y < scene->height / 2; y++)
+    {
+        unsigned char *top = rgba + row * y, *bottom = rgba + row * (scene->height - 1 - y);
+        size_t i;
+
+        for (i = 0; i < row; i++)
+        {
+            unsigned char t = top[i];
+            top[i] = bottom[i];
+            bottom[i] = t;
+        }
+    }
+    return 1;
+}
+
+static int write_ppm(const char *path, const unsigned char *rgba, int width, int height)
+{
+    FILE *file = fopen(path, "wb");
+    size_t i;
+    int ok;
+
+    if (file == NULL)
+        return 0;
+    ok = fprintf(file, "P6\n%d %d\n255\n", width, height) > 0;
+    for (i = 0; ok && i < (size_t)width * height; i++)
+        ok = fwrite(rgba + i * 4, 1, 3, file) == 3;
+    return fclose(file) == 0 && ok;
+}
+
+// reads an RGB ppm of the given size into rgba's first three channels
+static int read_ppm(const char *path, unsigned char *rgba, int width, int height)
+{
+    FILE *file = fopen(path, "rb");
+    int w, h, max, ok;
+    size_t i;
+
+    if (file == NULL)
+        return 0;
+    ok = fscanf(file, "P6 %d %d %d", &w, &h, &max) == 3 && w == width && h == height && max == 255 &&
+        fgetc(file) != EOF;
+    for (i = 0; ok && i < (size_t)width * height; i++)
+    {
+        ok = fread(rgba + i * 4, 1, 3, file) == 3;
+        rgba[i * 4 + 3] = 255;
+    }
+    fclose(file);
+    return ok;
+}
+
+static int read_hash(const char *path, uint64_t *hash)
+{
+    FILE *file = fopen(path, "r");
+    int ok;
+
+    if (file == NULL)
+        return 0;
+    ok = fscanf(file, "%" SCNx64, hash) == 1;
+    fclose(file);
+    return ok;
+}
+
+static int write_hash(const char *path, uint64_t hash)
+{
+    FILE *file = fopen(path, "w");
+    int ok;
+
+    if (file == NULL)
+        return 0;
+    ok = fprintf(file, "%016" PRIx64 "\n", hash) > 0;
+    return fclose(file) == 0 && ok;
+}
+
+// one scene: every configuration, then the references. returns 1 if it passed
+static int run_scene(const struct scene *scene, const struct scene_data *data, const char *dir, int update)
+{
+    size_t size = (size_t)scene->width * scene->height * 4, c, i;
+    unsigned char *first = (unsigned char *)malloc(size), *image = (unsigned char *)malloc(size);
+    char path[MAX_PATH_LENGTH];
+    uint64_t hash, expected;
+    int ok = first != NULL && image != NULL;
+
+    for (c = 0; ok && c < sizeof(configs) / sizeof(configs[0]); c++)
+    {
+        if (!render(scene, data, &configs[c], c == 0 ? first : image))
+        {
+            fprintf(stderr, "golden: %s: can't render (%s)\n", scene->name, configs[c].name);
+            ok = 0;
+        }
+        else if (c > 0 && memcmp(first, image, size) != 0)
+        {
+            for (i = 0; i < size && first[i] == image[i]; i++)
+                ;
+            printf("  %-14s FAIL  \"%s\" differs from \"%s\" at pixel (%d, %d)\n", scene->name, configs[c].name,
+                configs[0].name, (int)(i / 4 % scene->width), (int)(i / 4 / scene->width));
+            ok = 0;
+        }
+    }
+    if (!ok)
+    {
+        free(first);
+        free(image);
+        return 0;
+    }
+    // the alpha channel isn't in the ppm, so it isn't hashed either
+    for (i = 0; i < size; i += 4)
+        first[i + 3] = 255;
+    hash = hash_bytes(HASH_SEED, first, size);
+
+    if (update)
+    {
+        snprintf(path, sizeof(path), "%s/%s.hash", dir, scene->name);
+        ok = write_hash(path, hash);
+        snprintf(path, sizeof(path), "%s/%s.ppm", dir, scene->name);
+        ok = ok && write_ppm(path, first, scene->width, scene->height);
+        printf("  %-14s %s  %016" PRIx64 "\n", scene->name, ok ? "recorded" : "can't write", hash);
+    }
+    else
+    {
+        snprintf(path, sizeof(path), "%s/%s.hash", dir, scene->name);
+        if (!read_hash(path, &expected))
+        {
+            printf("  %-14s FAIL  no reference in %s\n", scene->name, path);
+            ok = 0;
+        }
+        else if (hash != expected)
+        {
+            printf("  %-14s FAIL  %016" PRIx64 ", expected %016" PRIx64 "\n", scene->name, hash, expected);
+            snprintf(path, sizeof(path), "%s/%s.ppm", dir, scene->name);
+            if (read_ppm(path, image, scene->width, scene->height))
+            {
+                unsigned int changed = 0, largest = 0;
+
+                for (i = 0; i < size; i += 4)
+                {
+                    unsigned int delta = 0, k;
+
+                    for (k = 0; k < 3; k++)
+                    {
+                        unsigned int d = (unsigned int)abs(first[i + k] - image[i + k]);
+                        delta = d > delta ? d : delta;
+                    }
+                    changed += delta > 0;
+                    largest = delta > largest ? delta : largest;
+                }
+                printf("                       %u pixels changed, by up to %u\n", changed, largest);
+            }
+            snprintf(path, sizeof(path), "%s/%s.actual.ppm", dir, scene->name);
+            if (write_ppm(path, first, scene->width, scene->height))
+                printf("                       wrote %s\n", path);
+            ok = 0;
+        }
+        else
+        {
+            printf("  %-14s ok    %016" PRIx64 "\n", scene->name, hash);
+        }
+    }
+    free(first);
+    free(image);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 2 ? argv[2] : GOLDEN_DIR;
+    struct scene_data data;
+    struct mesh_data cube;
+    size_t i;
+    int update, failed = 0;
+
+    if (argc < 2 || (strcmp(argv[1], "check") != 0 && strcmp(argv[1], "update") != 0))
+    {
+        fprintf(stderr, "usage: %s <check|update> [dir]\n", argv[0]);
+        return 1;
+    }
+    update = strcmp(argv[1], "update") == 0;
+    if (!cube_mesh_create(&cube))
+    {
+        fprintf(stderr, "golden: out of memory\n");
+        return 1;
+    }
+    raster_vertex_array_init(&data.quad, 4, quad_indices, 6);
+    raster_vertex_attrib_pointer(&data.quad, RASTER_POSITION_LOCATION, 3, 3 * sizeof(float), quad_vertices, 0);
+    raster_vertex_array_from_mesh(&data.cube, &cube);
+
+    printf("%u scenes, %u configurations each, references in %s:\n", (unsigned int)(sizeof(scenes) / sizeof(scenes[0])),
+        (unsigned int)(sizeof(configs) / sizeof(configs[0])), dir);
+    for (i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++)
+        failed += !run_scene(&scenes[i], &data, dir, update);
+    if (failed)
+        printf("%d of %u scenes failed\n", failed, (unsigned int)(sizeof(scenes) / sizeof(scenes[0])));
+    mesh_free(&cube);
+    return failed != 0;
+}
@@ -0,0 +1,83 @@
+// packs a directory tree: pack <out.pack> <dir> [--lz4]. names in the pack are relative to dir, so
+// mounting the pack at dir (vfs_mount) shadows the loose files.
+
+#include <pack.h>
+#include <vfs.h>
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static int add_tree(struct pack_writer *writer, const char *root, const char *relative,
+    enum pack_compression compression, const char *output)
+{
+    char path[4096], name[4096];
+    struct dirent *dirent;
+    DIR *dir;
+    int ok = 1;
+
+    snprintf(path, sizeof(path), "%s%s%s", root, relative[0] ? "/" : "", relative);
+    dir = opendir(path);
+    if (dir == NULL)
+    {
+        fprintf(stderr, "pack: cannot open %s\n", path);
+        return 0;
+    }
+    while (ok && (dirent = readdir(dir)) != NULL)
+    {
+        struct stat st;
+
+        if (dirent->d_name[0] == '.')
+            continue;
+        if (snprintf(name, sizeof(name), "%s%s%s", relative, relative[0] ? "/" : "", dirent->d_name) >=
+            (int)sizeof(name) || snprintf(path, sizeof(path), "%s/%s", root, name) >= (int)sizeof(path))
+        {
+            fprintf(stderr, "pack: path too long under %s\n", root);
+            ok = 0;
+            break;
+        }
+        if (stat(path, &st) != 0 || strcmp(path, output) == 0)
+            continue;
+        if (S_ISDIR(st.st_mode))
+            ok = add_tree(writer, root, name, compression, output);
+        else if (S_ISREG(st.st_mode))
+        {
+            size_t size = 0;
+            unsigned char *data = vfs_read(path, &size);
+            ok = data != NULL && pack_writer_add(writer, name, data, size, compression);
+            if (!ok)
+                fprintf(stderr, "pack: cannot add %s\n", path);
+            free(data);
+        }
+    }
+    closedir(dir);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    enum pack_compression compression = PACK_COMPRESSION_NONE;
+    struct pack_writer writer;
+    int ok;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: pack <out%s> <dir> [--lz4]\n", PACK_EXTENSION);
+        return 1;
+    }
+    if (argc > 3 && strcmp(argv[3], "--lz4") == 0)
+        compression = PACK_COMPRESSION_LZ4;
+    if (!pack_writer_open(&writer, argv[1]))
+    {
+        fprintf(stderr, "pack: cannot create %s\n", argv[1]);
+        return 1;
+    }
+    ok = add_tree(&writer, argv[2], "", compression, argv[1]);
+    printf("pack: %u files\n", writer.count);
+    ok = pack_writer_close(&writer) && ok;
+    if (!ok)
+        remove(argv[1]);
+    return ok ? 0 : 1;
+}